@@ -22,6 +22,26 @@
 	DllEntry char* Base_LkProperties(char** error, char* connectionInfo, const char* const filename, const char* const lkSchemasOptions, DataFormatTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
 	DllEntry char* Base_LkGetTable(char** error, char* connectionInfo, const char* const filename, const char* const selectClause, const char* const dictClause, const char* const sortClause, const char* const getTableOptions, const char* const customVars, uint32_t receiveTimeout);
 	DllEntry char* Base_LkResetCommonBlocks(char** error, char* connectionInfo, DataFormatTYPE outputFormat, uint32_t receiveTimeout);
+	DllEntry char* Base_LkReadPrepared(char** error, char* connectionInfo, const LkPreparedOperation* const prepared, const char* const recordIds, DataFormatTYPE inputFormat, DataFormatCruTYPE outputFormat, uint32_t receiveTimeout);
+	DllEntry char* Base_LkSelectPrepared(char** error, char* connectionInfo, const LkPreparedOperation* const prepared, uint32_t numPage, DataFormatCruTYPE outputFormat, uint32_t receiveTimeout);
+	DllEntry char* Base_LkGetTablePrepared(char** error, char* connectionInfo, const LkPreparedOperation* const prepared, uint32_t numPage, uint32_t receiveTimeout);
+
+	DllEntry LkFuture* Base_LkReadAsync(const char* const connectionInfo, const char* const filename, const char* const recordIds, const char* const dictionaries, const char* const readOptions, DataFormatTYPE inputFormat, DataFormatCruTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+	DllEntry LkFuture* Base_LkUpdateAsync(const char* const connectionInfo, const char* const filename, const char* const records, const char* const updateOptions, DataFormatTYPE inputFormat, DataFormatCruTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+	DllEntry LkFuture* Base_LkUpdatePartialAsync(const char* const connectionInfo, const char* const filename, const char* const records, const char* const dictionaries, const char* const updateOptions, DataFormatTYPE inputFormat, DataFormatCruTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+	DllEntry LkFuture* Base_LkNewAsync(const char* const connectionInfo, const char* const filename, const char* const records, const char* const newOptions, DataFormatTYPE inputFormat, DataFormatCruTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+	DllEntry LkFuture* Base_LkDeleteAsync(const char* const connectionInfo, const char* const filename, const char* const records, const char* const deleteOptions, DataFormatTYPE inputFormat, DataFormatTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+	DllEntry LkFuture* Base_LkSelectAsync(const char* const connectionInfo, const char* const filename, const char* const selectClause, const char* const sortClause, const char* const dictClause, const char* const preSelectClause, const char* const selectOptions, DataFormatCruTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+	DllEntry LkFuture* Base_LkSubroutineAsync(const char* const connectionInfo, const char* const subroutineName, uint32_t argsNumber, const char* const arguments, DataFormatTYPE inputFormat, DataFormatTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+	DllEntry LkFuture* Base_LkConversionAsync(const char* const connectionInfo, const char* const expression, const char* const code, CONVERSION_TYPE conversionType, DataFormatTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+	DllEntry LkFuture* Base_LkFormatAsync(const char* const connectionInfo, const char* const expression, const char* const formatSpec, DataFormatTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+	DllEntry LkFuture* Base_LkDictionariesAsync(const char* const connectionInfo, const char* const filename, DataFormatTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+	DllEntry LkFuture* Base_LkExecuteAsync(const char* const connectionInfo, const char* const statement, DataFormatTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+	DllEntry LkFuture* Base_LkGetVersionAsync(const char* const connectionInfo, DataFormatTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+	DllEntry LkFuture* Base_LkSchemasAsync(const char* const connectionInfo, const char* const lkSchemasOptions, DataFormatTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+	DllEntry LkFuture* Base_LkPropertiesAsync(const char* const connectionInfo, const char* const filename, const char* const lkPropertiesOptions, DataFormatSchPropTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+	DllEntry LkFuture* Base_LkGetTableAsync(const char* const connectionInfo, const char* const filename, const char* const selectClause, const char* const dictClause, const char* const sortClause, const char* const tableOptions, const char* const customVars, uint32_t receiveTimeout);
+	DllEntry LkFuture* Base_LkResetCommonBlocksAsync(const char* const connectionInfo, DataFormatTYPE outputFormat, uint32_t receiveTimeout);
 	---
 */
 #include "CompilerOptions.h"
@@ -45,3 +65,42 @@ DllEntry char* Base_LkSchemas(char** error, char* connectionInfo, const char* co
 DllEntry char* Base_LkProperties(char** error, char* connectionInfo, const char* const filename, const char* const lkSchemasOptions, DataFormatTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
 DllEntry char* Base_LkGetTable(char** error, char* connectionInfo, const char* const filename, const char* const selectClause, const char* const dictClause, const char* const sortClause, const char* const getTableOptions, const char* const customVars, uint32_t receiveTimeout);
 DllEntry char* Base_LkResetCommonBlocks(char** error, char* connectionInfo, DataFormatTYPE outputFormat, uint32_t receiveTimeout);
+
+/*
+	typedef: LkPreparedOperation
+	Read, Select or GetTable operation with its 3 items already composed, created by <LkPrepareRead>, <LkPrepareSelect> or <LkPrepareGetTable>.
+*/
+#ifndef LKPREPAREDOPERATIONTYPEDEFINED
+#define LKPREPAREDOPERATIONTYPEDEFINED 1
+	typedef struct LkPreparedOperation LkPreparedOperation;
+#endif
+
+DllEntry char* Base_LkReadPrepared(char** error, char* connectionInfo, const LkPreparedOperation* const prepared, const char* const recordIds, DataFormatTYPE inputFormat, DataFormatCruTYPE outputFormat, uint32_t receiveTimeout);
+DllEntry char* Base_LkSelectPrepared(char** error, char* connectionInfo, const LkPreparedOperation* const prepared, uint32_t numPage, DataFormatCruTYPE outputFormat, uint32_t receiveTimeout);
+DllEntry char* Base_LkGetTablePrepared(char** error, char* connectionInfo, const LkPreparedOperation* const prepared, uint32_t numPage, uint32_t receiveTimeout);
+
+/*
+	typedef: LkFuture
+	Result of an asynchronous operation, returned by the Base_Lk*Async functions. See <LinkarThreadPool.h>.
+*/
+#ifndef LKFUTURETYPEDEFINED
+#define LKFUTURETYPEDEFINED 1
+	typedef struct LkFuture LkFuture;
+#endif
+
+DllEntry LkFuture* Base_LkReadAsync(const char* const connectionInfo, const char* const filename, const char* const recordIds, const char* const dictionaries, const char* const readOptions, DataFormatTYPE inputFormat, DataFormatCruTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+DllEntry LkFuture* Base_LkUpdateAsync(const char* const connectionInfo, const char* const filename, const char* const records, const char* const updateOptions, DataFormatTYPE inputFormat, DataFormatCruTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+DllEntry LkFuture* Base_LkUpdatePartialAsync(const char* const connectionInfo, const char* const filename, const char* const records, const char* const dictionaries, const char* const updateOptions, DataFormatTYPE inputFormat, DataFormatCruTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+DllEntry LkFuture* Base_LkNewAsync(const char* const connectionInfo, const char* const filename, const char* const records, const char* const newOptions, DataFormatTYPE inputFormat, DataFormatCruTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+DllEntry LkFuture* Base_LkDeleteAsync(const char* const connectionInfo, const char* const filename, const char* const records, const char* const deleteOptions, DataFormatTYPE inputFormat, DataFormatTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+DllEntry LkFuture* Base_LkSelectAsync(const char* const connectionInfo, const char* const filename, const char* const selectClause, const char* const sortClause, const char* const dictClause, const char* const preSelectClause, const char* const selectOptions, DataFormatCruTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+DllEntry LkFuture* Base_LkSubroutineAsync(const char* const connectionInfo, const char* const subroutineName, uint32_t argsNumber, const char* const arguments, DataFormatTYPE inputFormat, DataFormatTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+DllEntry LkFuture* Base_LkConversionAsync(const char* const connectionInfo, const char* const expression, const char* const code, CONVERSION_TYPE conversionType, DataFormatTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+DllEntry LkFuture* Base_LkFormatAsync(const char* const connectionInfo, const char* const expression, const char* const formatSpec, DataFormatTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+DllEntry LkFuture* Base_LkDictionariesAsync(const char* const connectionInfo, const char* const filename, DataFormatTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+DllEntry LkFuture* Base_LkExecuteAsync(const char* const connectionInfo, const char* const statement, DataFormatTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+DllEntry LkFuture* Base_LkGetVersionAsync(const char* const connectionInfo, DataFormatTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+DllEntry LkFuture* Base_LkSchemasAsync(const char* const connectionInfo, const char* const lkSchemasOptions, DataFormatTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+DllEntry LkFuture* Base_LkPropertiesAsync(const char* const connectionInfo, const char* const filename, const char* const lkPropertiesOptions, DataFormatSchPropTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout);
+DllEntry LkFuture* Base_LkGetTableAsync(const char* const connectionInfo, const char* const filename, const char* const selectClause, const char* const dictClause, const char* const sortClause, const char* const tableOptions, const char* const customVars, uint32_t receiveTimeout);
+DllEntry LkFuture* Base_LkResetCommonBlocksAsync(const char* const connectionInfo, DataFormatTYPE outputFormat, uint32_t receiveTimeout);
@@ -0,0 +1,48 @@
+/*
+	File: LinkarFile.h
+	Header file for <LinkarFile.c>
+
+	Prototype Functions:
+	--- Code
+	DllEntry LkMappedFile* LkMapFile(const char* const path, LkStrView* content);
+	DllEntry void LkUnmapFile(LkMappedFile* mappedFile);
+	DllEntry LkBufferWriter* LkBufferWriterCreate(int fd, uint32_t bufferSize);
+	DllEntry BOOL LkBufferWriterAppend(LkBufferWriter* writer, const char* const item);
+	DllEntry BOOL LkBufferWriterNextBlock(LkBufferWriter* writer);
+	DllEntry BOOL LkBufferWriterClose(LkBufferWriter* writer);
+	---
+*/
+#include "CompilerOptions.h"
+#include "Types.h"
+
+/*
+	typedef: LkMappedFile
+	File mapped in memory by <LkMapFile>, so its content can be read without copying it into a malloc'd buffer.
+*/
+#ifndef LKMAPPEDFILETYPEDEFINED
+#define LKMAPPEDFILETYPEDEFINED 1
+	typedef struct LkMappedFile LkMappedFile;
+#endif
+
+/*
+	typedef: LkBufferWriter
+	Writer created by <LkBufferWriterCreate>, that writes the buffer of the New, Update or Delete Operations into a file descriptor while it is composed.
+*/
+#ifndef LKBUFFERWRITERTYPEDEFINED
+#define LKBUFFERWRITERTYPEDEFINED 1
+	typedef struct LkBufferWriter LkBufferWriter;
+#endif
+
+/*
+	Constants: LkBufferWriter_DEFAULT_BUFFER_SIZE
+
+	LkBufferWriter_DEFAULT_BUFFER_SIZE - (65536) Size of the memory buffer of a <LkBufferWriter> when 0 is passed to <LkBufferWriterCreate>.
+*/
+#define LkBufferWriter_DEFAULT_BUFFER_SIZE 65536
+
+DllEntry LkMappedFile* LkMapFile(const char* const path, LkStrView* content);
+DllEntry void LkUnmapFile(LkMappedFile* mappedFile);
+DllEntry LkBufferWriter* LkBufferWriterCreate(int fd, uint32_t bufferSize);
+DllEntry BOOL LkBufferWriterAppend(LkBufferWriter* writer, const char* const item);
+DllEntry BOOL LkBufferWriterNextBlock(LkBufferWriter* writer);
+DllEntry BOOL LkBufferWriterClose(LkBufferWriter* writer);
@@ -0,0 +1,158 @@
+/*
+	File: LinkarMemory.h
+	Header file for <LinkarMemory.c>
+
+	Prototype Functions:
+	--- Code
+	DllEntry LkArena* LkArenaCreate(uint32_t blockSize);
+	DllEntry void* LkArenaAlloc(LkArena* arena, uint32_t size);
+	DllEntry char* LkArenaCopy(LkArena* arena, const char* const str, uint32_t length);
+	DllEntry void LkArenaReset(LkArena* arena);
+	DllEntry void LkArenaDestroy(LkArena* arena);
+
+	DllEntry BOOL LkSetAllocator(LkMallocFunction mallocFunction, LkReallocFunction reallocFunction, LkFreeFunction freeFunction, void* context);
+	DllEntry BOOL LkSetMemoryAccounting(BOOL enabled);
+	DllEntry void* LkMalloc(size_t size);
+	DllEntry void* LkCalloc(size_t count, size_t size);
+	DllEntry void* LkRealloc(void* ptr, size_t size);
+	DllEntry void LkFree(void* ptr);
+	DllEntry void* LkMallocFrom(size_t size, const char* const entryPoint);
+	DllEntry void* LkCallocFrom(size_t count, size_t size, const char* const entryPoint);
+	DllEntry void* LkReallocFrom(void* ptr, size_t size, const char* const entryPoint);
+	DllEntry void LkGetMemoryStats(LkMemoryStats* stats);
+	DllEntry uint32_t LkGetMemoryEntryStats(LkMemoryEntryStats* entries, uint32_t capacity);
+	---
+*/
+#include "CompilerOptions.h"
+#include "Types.h"
+#include <stddef.h>
+
+/*
+	typedef: LkArena
+	Memory pool created by <LkArenaCreate>, where the *Arena functions of the library allocate their results.
+	All the memory allocated in the pool is released at once with <LkArenaReset> or <LkArenaDestroy>, instead of releasing every result one by one.
+*/
+#ifndef LKARENATYPEDEFINED
+#define LKARENATYPEDEFINED 1
+	typedef struct LkArena LkArena;
+#endif
+
+/*
+	Constants: LkArena_DEFAULT_BLOCK_SIZE
+
+	LkArena_DEFAULT_BLOCK_SIZE - (65536) Size of the memory blocks of a <LkArena> when 0 is passed to <LkArenaCreate>.
+*/
+#define LkArena_DEFAULT_BLOCK_SIZE 65536
+
+DllEntry LkArena* LkArenaCreate(uint32_t blockSize);
+DllEntry void* LkArenaAlloc(LkArena* arena, uint32_t size);
+DllEntry char* LkArenaCopy(LkArena* arena, const char* const str, uint32_t length);
+DllEntry void LkArenaReset(LkArena* arena);
+DllEntry void LkArenaDestroy(LkArena* arena);
+
+/*
+	typedef: LkMallocFunction
+	Allocation function installed with <LkSetAllocator>. It has the same behaviour as malloc.
+
+		--- Code
+		typedef void* (*LkMallocFunction)(void* context, size_t size);
+		---
+
+	typedef: LkReallocFunction
+	Reallocation function installed with <LkSetAllocator>. It has the same behaviour as realloc.
+
+		--- Code
+		typedef void* (*LkReallocFunction)(void* context, void* ptr, size_t size);
+		---
+
+	typedef: LkFreeFunction
+	Release function installed with <LkSetAllocator>. It has the same behaviour as free.
+
+		--- Code
+		typedef void (*LkFreeFunction)(void* context, void* ptr);
+		---
+*/
+#ifndef LKALLOCATORTYPEDEFINED
+#define LKALLOCATORTYPEDEFINED 1
+	typedef void* (*LkMallocFunction)(void* context, size_t size);
+	typedef void* (*LkReallocFunction)(void* context, void* ptr, size_t size);
+	typedef void (*LkFreeFunction)(void* context, void* ptr);
+#endif
+
+/*
+	typedef: LkMemoryStats
+	Totals of the memory allocated by the library, filled by <LkGetMemoryStats> when the accounting is enabled with <LkSetMemoryAccounting>.
+
+		--- Code
+		typedef struct
+		{
+			uint64_t liveBytes;
+			uint64_t peakBytes;
+			uint64_t allocations;
+			uint64_t frees;
+		} LkMemoryStats;
+		---
+
+		liveBytes - Bytes allocated and not released yet.
+		peakBytes - Highest value that liveBytes has reached.
+		allocations - Number of allocations and reallocations.
+		frees - Number of releases.
+
+	typedef: LkMemoryEntryStats
+	Memory allocated by one function of the library, filled by <LkGetMemoryEntryStats>.
+
+		--- Code
+		typedef struct
+		{
+			const char* entryPoint;
+			uint64_t liveBytes;
+			uint64_t peakBytes;
+			uint64_t allocations;
+			uint64_t totalBytes;
+		} LkMemoryEntryStats;
+		---
+
+		entryPoint - Name of the function that requested the memory, or "LkMalloc" for the memory requested directly with <LkMalloc>, <LkCalloc> or <LkRealloc>.
+		liveBytes - Bytes allocated by the function and not released yet.
+		peakBytes - Highest value that liveBytes has reached.
+		allocations - Number of allocations and reallocations made by the function.
+		totalBytes - Sum of the sizes of all those allocations.
+*/
+#ifndef LKMEMORYSTATSTYPEDEFINED
+#define LKMEMORYSTATSTYPEDEFINED 1
+	typedef struct
+	{
+		uint64_t liveBytes;
+		uint64_t peakBytes;
+		uint64_t allocations;
+		uint64_t frees;
+	} LkMemoryStats;
+
+	typedef struct
+	{
+		const char* entryPoint;
+		uint64_t liveBytes;
+		uint64_t peakBytes;
+		uint64_t allocations;
+		uint64_t totalBytes;
+	} LkMemoryEntryStats;
+#endif
+
+/*
+	Constants: LkMemory_MAX_ENTRY_POINTS
+
+	LkMemory_MAX_ENTRY_POINTS - (256) Maximum number of functions whose allocations are accounted separately. The allocations of the next functions are added to the "LkMalloc" entry.
+*/
+#define LkMemory_MAX_ENTRY_POINTS 256
+
+DllEntry BOOL LkSetAllocator(LkMallocFunction mallocFunction, LkReallocFunction reallocFunction, LkFreeFunction freeFunction, void* context);
+DllEntry BOOL LkSetMemoryAccounting(BOOL enabled);
+DllEntry void* LkMalloc(size_t size);
+DllEntry void* LkCalloc(size_t count, size_t size);
+DllEntry void* LkRealloc(void* ptr, size_t size);
+DllEntry void LkFree(void* ptr);
+DllEntry void* LkMallocFrom(size_t size, const char* const entryPoint);
+DllEntry void* LkCallocFrom(size_t count, size_t size, const char* const entryPoint);
+DllEntry void* LkReallocFrom(void* ptr, size_t size, const char* const entryPoint);
+DllEntry void LkGetMemoryStats(LkMemoryStats* stats);
+DllEntry uint32_t LkGetMemoryEntryStats(LkMemoryEntryStats* entries, uint32_t capacity);
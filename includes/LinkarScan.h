@@ -0,0 +1,35 @@
+/*
+	File: LinkarScan.h
+	Header file for <LinkarScan.c>
+
+	Prototype Functions:
+	--- Code
+	DllEntry const char* LkScanFindByte(const char* const str, uint32_t length, char byte);
+	DllEntry uint32_t LkScanCountByte(const char* const str, uint32_t length, char byte);
+	DllEntry const char* LkScanFindAny(const char* const str, uint32_t length, const char* const set, uint32_t setLength);
+	DllEntry uint8_t LkScanGetLevel();
+	---
+*/
+#include "CompilerOptions.h"
+#include "Types.h"
+
+/*
+	Constants: LkScanLEVEL
+
+	Instruction set used by the <LinkarScan.c> functions, as returned by <LkScanGetLevel>.
+
+		LkScanLEVEL_SCALAR - (0x00) Portable C code, one byte at a time.
+		LkScanLEVEL_SSE2 - (0x01) SSE2 instructions, 16 bytes at a time.
+		LkScanLEVEL_AVX2 - (0x02) AVX2 instructions, 32 bytes at a time.
+
+	LkScanFindAny_MAX_SET - Maximum number of chars of the "set" argument of <LkScanFindAny> that are checked with SIMD instructions. Longer sets use the scalar code.
+*/
+#define LkScanLEVEL_SCALAR 0x00
+#define LkScanLEVEL_SSE2 0x01
+#define LkScanLEVEL_AVX2 0x02
+#define LkScanFindAny_MAX_SET 8
+
+DllEntry const char* LkScanFindByte(const char* const str, uint32_t length, char byte);
+DllEntry uint32_t LkScanCountByte(const char* const str, uint32_t length, char byte);
+DllEntry const char* LkScanFindAny(const char* const str, uint32_t length, const char* const set, uint32_t setLength);
+DllEntry uint8_t LkScanGetLevel();
@@ -31,10 +31,73 @@
 	DllEntry char* LkComposeUpdateBuffer(const char* const recordIds, const char* const records, const char* const originalRecords);
 	DllEntry char* LkComposeNewBuffer(const char* const recordIds, const char* const records);
 	DllEntry char* LkComposeDeleteBuffer(const char* const recordIds, const char* const originalRecords);
+
+	DllEntry LkParsedResult* LkParseResult(const char* const lkString);
+	DllEntry BOOL LkParsedGetSection(const LkParsedResult* const parsedResult, const char* const tag, LkStrView* section);
+	DllEntry uint32_t LkParsedGetTotalRecords(const LkParsedResult* const parsedResult);
+	DllEntry void LkFreeParsedResult(LkParsedResult* parsedResult);
+
+	DllEntry LkSpan* LkStrSplitSpans(const char* const str, uint32_t length, const char delim, uint32_t* count);
+	DllEntry uint32_t LkStrSplitSpansInto(const char* const str, uint32_t length, const char delim, LkSpan* spans, uint32_t capacity);
+	DllEntry void LkFreeSpans(LkSpan* spans);
+
+	DllEntry void LkRecordIteratorInit(LkRecordIterator* iterator, const LkParsedResult* const parsedResult);
+	DllEntry BOOL LkRecordIteratorNext(LkRecordIterator* iterator, LkStrView* recordId, LkStrView* record, LkStrView* calculated, LkStrView* originalRecord);
+
+	DllEntry char** LkExtractRecordIdsArena(LkArena* arena, const char* const lkString, uint32_t* count);
+	DllEntry char** LkExtractRecordsArena(LkArena* arena, const char* const lkString, uint32_t* count);
+	DllEntry char** LkExtractErrorsArena(LkArena* arena, const char* const lkString, uint32_t* count);
+	DllEntry char** LkExtractRecordsCalculatedArena(LkArena* arena, const char* const lkString, uint32_t* count);
+	DllEntry char** LkExtractRecordsDictsArena(LkArena* arena, const char* const lkString, uint32_t* count);
+	DllEntry char** LkExtractRecordsCalculatedDictsArena(LkArena* arena, const char* const lkString, uint32_t* count);
+	DllEntry char** LkExtractRecordsIdDictsArena(LkArena* arena, const char* const lkString, uint32_t* count);
+	DllEntry char** LkExtractOriginalRecordsArena(LkArena* arena, const char* const lkString, uint32_t* count);
+	DllEntry char** LkExtractDictionariesArena(LkArena* arena, const char* const lkString, uint32_t* count);
+	DllEntry char* LkExtractConversionArena(LkArena* arena, const char* const lkString);
+	DllEntry char* LkExtractFormatArena(LkArena* arena, const char* const lkString);
+	DllEntry char* LkExtractCapturingArena(LkArena* arena, const char* const lkString);
+	DllEntry char* LkExtractReturningArena(LkArena* arena, const char* const lkString);
+	DllEntry char** LkExtractSubroutineArgsArena(LkArena* arena, const char* const lkString, uint32_t* count);
+	DllEntry char** LkExtractRowPropertiesArena(LkArena* arena, const char* const lkString, uint32_t* count);
+	DllEntry char** LkExtractRowHeadersArena(LkArena* arena, const char* const lkString, uint32_t* count);
+
+	DllEntry char* LkComposeRecordIdsArena(LkArena* arena, const char** const lstRecordIds, uint32_t count);
+	DllEntry char* LkComposeRecordsArena(LkArena* arena, const char** const lstRecords, uint32_t count);
+	DllEntry char* LkComposeOriginalRecordsArena(LkArena* arena, const char** const lstOriginalRecords, uint32_t count);
+	DllEntry char* LkComposeDictionariesArena(LkArena* arena, const char** const lstDictionaries, uint32_t count);
+	DllEntry char* LkComposeExpressionsArena(LkArena* arena, const char** const lstExpressions, uint32_t count);
+	DllEntry char* LkComposeSubroutineArgsArena(LkArena* arena, const char** const lstArgs, uint32_t count);
+	DllEntry char* LkComposeUpdateBufferArena(LkArena* arena, const char* const recordIds, const char* const records, const char* const originalRecords);
+	DllEntry char* LkComposeNewBufferArena(LkArena* arena, const char* const recordIds, const char* const records);
+	DllEntry char* LkComposeDeleteBufferArena(LkArena* arena, const char* const recordIds, const char* const originalRecords);
+
+	DllEntry LkColumns* LkExtractColumns(const char* const lkString, const uint32_t* const attributes, uint32_t numAttributes, uint32_t value);
+	DllEntry void LkFreeColumns(LkColumns* columns);
+
+	DllEntry LkInt64Column* LkDecodeColumnInt64(const char* const lkString, uint32_t attribute, uint32_t value, uint8_t impliedDecimals);
+	DllEntry LkDoubleColumn* LkDecodeColumnDouble(const char* const lkString, uint32_t attribute, uint32_t value, uint8_t impliedDecimals);
+	DllEntry void LkFreeInt64Column(LkInt64Column* column);
+	DllEntry void LkFreeDoubleColumn(LkDoubleColumn* column);
+	DllEntry LkSpan* LkStrSplitSpansParallel(const char* const str, uint32_t length, const char delim, const LkParallelConfig* const config, uint32_t* count);
+	DllEntry LkColumns* LkExtractColumnsParallel(const char* const lkString, const uint32_t* const attributes, uint32_t numAttributes, uint32_t value, const LkParallelConfig* const config);
+	DllEntry LkBufferBuilder* LkBufferBuilderCreate(uint32_t capacity);
+	DllEntry BOOL LkBufferBuilderAppendId(LkBufferBuilder* builder, const char* const recordId);
+	DllEntry BOOL LkBufferBuilderAppendRecord(LkBufferBuilder* builder, const char* const record);
+	DllEntry BOOL LkBufferBuilderAppendOriginalRecord(LkBufferBuilder* builder, const char* const originalRecord);
+	DllEntry char* LkBufferBuilderBuildUpdate(LkBufferBuilder* builder);
+	DllEntry char* LkBufferBuilderBuildNew(LkBufferBuilder* builder);
+	DllEntry char* LkBufferBuilderBuildDelete(LkBufferBuilder* builder);
+	DllEntry void LkBufferBuilderDestroy(LkBufferBuilder* builder);
+	DllEntry LkParsedResult* LkParseResultLength(const char* const lkString, uint32_t length);
+	DllEntry LkParsedResult* LkParseResultFromFile(const char* const path);
+	DllEntry char* LkComposeUpdatePartialBuffer(const char** const lstRecordIds, const char** const lstRecords, const char** const lstOriginalRecords, uint32_t count, const char** const lstDictionaryNames, uint32_t numDictionaryNames, char** dictionaries);
 	---
 */
 #include "CompilerOptions.h"
 #include "Types.h"
+#include "LinkarMemory.h"
+#include "LinkarThreadPool.h"
+#include "LinkarFile.h"
 
 /*
 	Constants: LkStrings MV
@@ -103,3 +166,214 @@ DllEntry char* LkComposeSubroutineArgs(const char** const lstArgs, uint32_t coun
 DllEntry char* LkComposeUpdateBuffer(const char* const recordIds, const char* const records, const char* const originalRecords);
 DllEntry char* LkComposeNewBuffer(const char* const recordIds, const char* const records);
 DllEntry char* LkComposeDeleteBuffer(const char* const recordIds, const char* const originalRecords);
+
+/*
+	typedef: LkParsedResult
+	Index of the sections of an MV <LkString>, created by <LkParseResult>.
+	It keeps the position and length of every section named in THIS_LIST, so they can be obtained as views without scanning or copying the <LkString> again.
+*/
+#ifndef LKPARSEDRESULTTYPEDEFINED
+#define LKPARSEDRESULTTYPEDEFINED 1
+	typedef struct LkParsedResult LkParsedResult;
+#endif
+
+DllEntry LkParsedResult* LkParseResult(const char* const lkString);
+DllEntry BOOL LkParsedGetSection(const LkParsedResult* const parsedResult, const char* const tag, LkStrView* section);
+DllEntry uint32_t LkParsedGetTotalRecords(const LkParsedResult* const parsedResult);
+DllEntry void LkFreeParsedResult(LkParsedResult* parsedResult);
+
+DllEntry LkSpan* LkStrSplitSpans(const char* const str, uint32_t length, const char delim, uint32_t* count);
+DllEntry uint32_t LkStrSplitSpansInto(const char* const str, uint32_t length, const char delim, LkSpan* spans, uint32_t capacity);
+DllEntry void LkFreeSpans(LkSpan* spans);
+
+/*
+	typedef: LkRecordIterator
+	State of a walk through the records of an MV <LkString>, started by <LkRecordIteratorInit>.
+	The RECORD_ID, RECORD, CALCULATED and ORIGINALRECORD sections are walked in lockstep, so every call to <LkRecordIteratorNext> returns the items of the same record.
+	A section is only scanned when its items are requested, so the sections that are never requested are not walked at all.
+	It can be declared as a local variable, because it doesn't allocate memory. Its fields must not be changed by the caller.
+
+		--- Code
+		typedef struct
+		{
+			LkStrView sections[4];
+			uint32_t positions[4];
+			uint32_t items[4];
+			uint32_t index;
+		} LkRecordIterator;
+		---
+
+		sections - The RECORD_ID, RECORD, CALCULATED and ORIGINALRECORD sections of the <LkString>.
+		positions - Offset of the next item of every section, or UINT32_MAX when the section has no more items.
+		items - Number of items of every section before its position. It is behind "index" for the sections that have not been requested.
+		index - Number of records returned so far. After <LkRecordIteratorNext> returns TRUE, it is the 1-based position of the current record.
+*/
+#ifndef LKRECORDITERATORTYPEDEFINED
+#define LKRECORDITERATORTYPEDEFINED 1
+	typedef struct
+	{
+		LkStrView sections[4];
+		uint32_t positions[4];
+		uint32_t items[4];
+		uint32_t index;
+	} LkRecordIterator;
+#endif
+
+DllEntry void LkRecordIteratorInit(LkRecordIterator* iterator, const LkParsedResult* const parsedResult);
+DllEntry BOOL LkRecordIteratorNext(LkRecordIterator* iterator, LkStrView* recordId, LkStrView* record, LkStrView* calculated, LkStrView* originalRecord);
+
+DllEntry char** LkExtractRecordIdsArena(LkArena* arena, const char* const lkString, uint32_t* count);
+DllEntry char** LkExtractRecordsArena(LkArena* arena, const char* const lkString, uint32_t* count);
+DllEntry char** LkExtractErrorsArena(LkArena* arena, const char* const lkString, uint32_t* count);
+DllEntry char** LkExtractRecordsCalculatedArena(LkArena* arena, const char* const lkString, uint32_t* count);
+DllEntry char** LkExtractRecordsDictsArena(LkArena* arena, const char* const lkString, uint32_t* count);
+DllEntry char** LkExtractRecordsCalculatedDictsArena(LkArena* arena, const char* const lkString, uint32_t* count);
+DllEntry char** LkExtractRecordsIdDictsArena(LkArena* arena, const char* const lkString, uint32_t* count);
+DllEntry char** LkExtractOriginalRecordsArena(LkArena* arena, const char* const lkString, uint32_t* count);
+DllEntry char** LkExtractDictionariesArena(LkArena* arena, const char* const lkString, uint32_t* count);
+DllEntry char* LkExtractConversionArena(LkArena* arena, const char* const lkString);
+DllEntry char* LkExtractFormatArena(LkArena* arena, const char* const lkString);
+DllEntry char* LkExtractCapturingArena(LkArena* arena, const char* const lkString);
+DllEntry char* LkExtractReturningArena(LkArena* arena, const char* const lkString);
+DllEntry char** LkExtractSubroutineArgsArena(LkArena* arena, const char* const lkString, uint32_t* count);
+DllEntry char** LkExtractRowPropertiesArena(LkArena* arena, const char* const lkString, uint32_t* count);
+DllEntry char** LkExtractRowHeadersArena(LkArena* arena, const char* const lkString, uint32_t* count);
+
+DllEntry char* LkComposeRecordIdsArena(LkArena* arena, const char** const lstRecordIds, uint32_t count);
+DllEntry char* LkComposeRecordsArena(LkArena* arena, const char** const lstRecords, uint32_t count);
+DllEntry char* LkComposeOriginalRecordsArena(LkArena* arena, const char** const lstOriginalRecords, uint32_t count);
+DllEntry char* LkComposeDictionariesArena(LkArena* arena, const char** const lstDictionaries, uint32_t count);
+DllEntry char* LkComposeExpressionsArena(LkArena* arena, const char** const lstExpressions, uint32_t count);
+DllEntry char* LkComposeSubroutineArgsArena(LkArena* arena, const char** const lstArgs, uint32_t count);
+DllEntry char* LkComposeUpdateBufferArena(LkArena* arena, const char* const recordIds, const char* const records, const char* const originalRecords);
+DllEntry char* LkComposeNewBufferArena(LkArena* arena, const char* const recordIds, const char* const records);
+DllEntry char* LkComposeDeleteBufferArena(LkArena* arena, const char* const recordIds, const char* const originalRecords);
+
+/*
+	typedef: LkColumns
+	Attributes of all the records of a <LkString> arranged as columns, created by <LkExtractColumns>.
+	Everything is allocated in only one memory block, that is released with <LkFreeColumns>.
+
+		--- Code
+		typedef struct
+		{
+			uint32_t attribute;
+			uint32_t* offsets;
+			char* data;
+		} LkColumn;
+
+		typedef struct
+		{
+			uint32_t numRecords;
+			uint32_t numColumns;
+			LkColumn* columns;
+		} LkColumns;
+		---
+
+		attribute - The attribute number of the column.
+		offsets - Array of numRecords + 1 elements with the offset of the value of every record inside "data". The last element is the total size of "data".
+		data - The values of all the records, one after another. Every value is NUL terminated.
+		numRecords - Number of records, that is the number of values of every column.
+		numColumns - Number of columns.
+		columns - Array with the columns.
+
+	Macros:
+		LkColumnGet(column, index) - The NUL terminated value of the record "index" (0-based) of a column.
+		LkColumnLength(column, index) - The length of the value of the record "index" (0-based) of a column.
+*/
+#ifndef LKCOLUMNSTYPEDEFINED
+#define LKCOLUMNSTYPEDEFINED 1
+	typedef struct
+	{
+		uint32_t attribute;
+		uint32_t* offsets;
+		char* data;
+	} LkColumn;
+
+	typedef struct
+	{
+		uint32_t numRecords;
+		uint32_t numColumns;
+		LkColumn* columns;
+	} LkColumns;
+
+	#define LkColumnGet(column, index) ((column)->data + (column)->offsets[index])
+	#define LkColumnLength(column, index) ((column)->offsets[(index) + 1] - (column)->offsets[index] - 1)
+#endif
+
+DllEntry LkColumns* LkExtractColumns(const char* const lkString, const uint32_t* const attributes, uint32_t numAttributes, uint32_t value);
+DllEntry void LkFreeColumns(LkColumns* columns);
+
+/*
+	typedef: LkInt64Column
+	Numbers of an attribute of all the records of a <LkString>, created by <LkDecodeColumnInt64>.
+
+		--- Code
+		typedef struct
+		{
+			uint32_t numRecords;
+			uint32_t numNulls;
+			int64_t* values;
+			uint8_t* nulls;
+		} LkInt64Column;
+		---
+
+		numRecords - Number of records, that is the number of elements of "values".
+		numNulls - Number of empty or not numeric values.
+		values - The number of every record.
+		nulls - Bitmap with one bit for every record, set when the value of the record is empty or it is not a number. Bit 0 of byte 0 is the first record.
+
+	typedef: LkDoubleColumn
+	Same as <LkInt64Column>, but "values" is an array of double. Created by <LkDecodeColumnDouble>.
+
+	Macros:
+		LkIsNull(column, index) - TRUE if the value of the record "index" (0-based) of a <LkInt64Column> or <LkDoubleColumn> is null.
+*/
+#ifndef LKNUMERICCOLUMNTYPEDEFINED
+#define LKNUMERICCOLUMNTYPEDEFINED 1
+	typedef struct
+	{
+		uint32_t numRecords;
+		uint32_t numNulls;
+		int64_t* values;
+		uint8_t* nulls;
+	} LkInt64Column;
+
+	typedef struct
+	{
+		uint32_t numRecords;
+		uint32_t numNulls;
+		double* values;
+		uint8_t* nulls;
+	} LkDoubleColumn;
+
+	#define LkIsNull(column, index) (((column)->nulls[(index) >> 3] >> ((index) & 7)) & 1)
+#endif
+
+DllEntry LkInt64Column* LkDecodeColumnInt64(const char* const lkString, uint32_t attribute, uint32_t value, uint8_t impliedDecimals);
+DllEntry LkDoubleColumn* LkDecodeColumnDouble(const char* const lkString, uint32_t attribute, uint32_t value, uint8_t impliedDecimals);
+DllEntry void LkFreeInt64Column(LkInt64Column* column);
+DllEntry void LkFreeDoubleColumn(LkDoubleColumn* column);
+DllEntry LkSpan* LkStrSplitSpansParallel(const char* const str, uint32_t length, const char delim, const LkParallelConfig* const config, uint32_t* count);
+DllEntry LkColumns* LkExtractColumnsParallel(const char* const lkString, const uint32_t* const attributes, uint32_t numAttributes, uint32_t value, const LkParallelConfig* const config);
+
+/*
+	typedef: LkBufferBuilder
+	Builder created by <LkBufferBuilderCreate>, that composes the buffer of the New, Update and Delete Operations one record at a time.
+*/
+#ifndef LKBUFFERBUILDERTYPEDEFINED
+#define LKBUFFERBUILDERTYPEDEFINED 1
+	typedef struct LkBufferBuilder LkBufferBuilder;
+#endif
+
+DllEntry LkBufferBuilder* LkBufferBuilderCreate(uint32_t capacity);
+DllEntry BOOL LkBufferBuilderAppendId(LkBufferBuilder* builder, const char* const recordId);
+DllEntry BOOL LkBufferBuilderAppendRecord(LkBufferBuilder* builder, const char* const record);
+DllEntry BOOL LkBufferBuilderAppendOriginalRecord(LkBufferBuilder* builder, const char* const originalRecord);
+DllEntry char* LkBufferBuilderBuildUpdate(LkBufferBuilder* builder);
+DllEntry char* LkBufferBuilderBuildNew(LkBufferBuilder* builder);
+DllEntry char* LkBufferBuilderBuildDelete(LkBufferBuilder* builder);
+DllEntry void LkBufferBuilderDestroy(LkBufferBuilder* builder);
+DllEntry LkParsedResult* LkParseResultLength(const char* const lkString, uint32_t length);
+DllEntry LkParsedResult* LkParseResultFromFile(const char* const path);
+DllEntry char* LkComposeUpdatePartialBuffer(const char** const lstRecordIds, const char** const lstRecords, const char** const lstOriginalRecords, uint32_t count, const char** const lstDictionaryNames, uint32_t numDictionaryNames, char** dictionaries);
@@ -0,0 +1,152 @@
+/*
+	File: LinkarThreadPool.h
+	Header file for <LinkarThreadPool.c>
+
+	Prototype Functions:
+	--- Code
+	DllEntry LkThreadPool* LkThreadPoolCreate(uint32_t numThreads);
+	DllEntry uint32_t LkThreadPoolGetNumThreads(const LkThreadPool* const pool);
+	DllEntry BOOL LkThreadPoolSubmit(LkThreadPool* pool, LkThreadPoolFunction function, void* argument);
+	DllEntry void LkThreadPoolRun(LkThreadPool* pool, uint32_t numTasks, LkParallelTask task, void* context);
+	DllEntry void LkThreadPoolDestroy(LkThreadPool* pool);
+
+	DllEntry void LkSetAsyncThreadPool(LkThreadPool* pool);
+	DllEntry LkThreadPool* LkGetAsyncThreadPool();
+	DllEntry LkFuture* LkFutureSubmit(LkThreadPool* pool, LkFutureFunction function, void* argument, LkThreadPoolFunction releaseArgument);
+	DllEntry uint8_t LkFutureGetState(LkFuture* future);
+	DllEntry BOOL LkFutureWaitFor(LkFuture* future, uint32_t milliseconds);
+	DllEntry BOOL LkFutureWait(LkFuture* future);
+	DllEntry BOOL LkFutureCancel(LkFuture* future);
+	DllEntry void LkFutureSetCallback(LkFuture* future, LkFutureCallback callback, void* userData);
+	DllEntry char* LkFutureGetResult(LkFuture* future, char** error);
+	DllEntry void LkFutureDestroy(LkFuture* future);
+	---
+*/
+#include "CompilerOptions.h"
+#include "Types.h"
+
+/*
+	typedef: LkThreadPool
+	Group of worker threads created by <LkThreadPoolCreate>, that can be shared by all the parallel functions of the library.
+*/
+#ifndef LKTHREADPOOLTYPEDEFINED
+#define LKTHREADPOOLTYPEDEFINED 1
+	typedef struct LkThreadPool LkThreadPool;
+#endif
+
+/*
+	typedef: LkThreadPoolFunction
+	Function executed by a worker thread, submitted with <LkThreadPoolSubmit>.
+
+		--- Code
+		typedef void (*LkThreadPoolFunction)(void* argument);
+		---
+
+	typedef: LkParallelTask
+	Function executed once for every task of <LkThreadPoolRun>.
+
+		--- Code
+		typedef void (*LkParallelTask)(void* context, uint32_t index);
+		---
+*/
+typedef void (*LkThreadPoolFunction)(void* argument);
+typedef void (*LkParallelTask)(void* context, uint32_t index);
+
+/*
+	typedef: LkParallelConfig
+	Options of the *Parallel functions of the library.
+
+		--- Code
+		typedef struct
+		{
+			LkThreadPool* pool;
+			uint32_t minChunkSize;
+		} LkParallelConfig;
+		---
+
+		pool - The thread pool that executes the work. If NULL, the work is done by the calling thread.
+		minChunkSize - Minimum number of bytes of every piece of work. Smaller strings are processed by the calling thread only. If 0, <LkParallelConfig_DEFAULT_CHUNK_SIZE> is used.
+*/
+#ifndef LKPARALLELCONFIGTYPEDEFINED
+#define LKPARALLELCONFIGTYPEDEFINED 1
+	typedef struct
+	{
+		LkThreadPool* pool;
+		uint32_t minChunkSize;
+	} LkParallelConfig;
+#endif
+
+/*
+	Constants: LkParallelConfig_DEFAULT_CHUNK_SIZE
+
+	LkParallelConfig_DEFAULT_CHUNK_SIZE - (1048576) Minimum size of the pieces of work when the minChunkSize of <LkParallelConfig> is 0.
+*/
+#define LkParallelConfig_DEFAULT_CHUNK_SIZE 1048576
+
+DllEntry LkThreadPool* LkThreadPoolCreate(uint32_t numThreads);
+DllEntry uint32_t LkThreadPoolGetNumThreads(const LkThreadPool* const pool);
+DllEntry BOOL LkThreadPoolSubmit(LkThreadPool* pool, LkThreadPoolFunction function, void* argument);
+DllEntry void LkThreadPoolRun(LkThreadPool* pool, uint32_t numTasks, LkParallelTask task, void* context);
+DllEntry void LkThreadPoolDestroy(LkThreadPool* pool);
+
+/*
+	typedef: LkFuture
+	Result of an asynchronous operation, returned by <LkFutureSubmit> and by the Base_Lk*Async functions. It must be released with <LkFutureDestroy>.
+*/
+#ifndef LKFUTURETYPEDEFINED
+#define LKFUTURETYPEDEFINED 1
+	typedef struct LkFuture LkFuture;
+#endif
+
+/*
+	typedef: LkFutureFunction
+	Function executed asynchronously by <LkFutureSubmit>. It returns the result, and sets the error, like the synchronous operations.
+
+		--- Code
+		typedef char* (*LkFutureFunction)(void* argument, char** error);
+		---
+
+	typedef: LkFutureCallback
+	Function called when a <LkFuture> finishes, set with <LkFutureSetCallback>.
+
+		--- Code
+		typedef void (*LkFutureCallback)(LkFuture* future, void* userData);
+		---
+*/
+#ifndef LKFUTUREFUNCTIONTYPEDEFINED
+#define LKFUTUREFUNCTIONTYPEDEFINED 1
+	typedef char* (*LkFutureFunction)(void* argument, char** error);
+	typedef void (*LkFutureCallback)(LkFuture* future, void* userData);
+#endif
+
+/*
+	Constants: LkFuture states
+
+	LkFuture_PENDING - (0) The future is waiting for a free thread of the pool.
+	LkFuture_RUNNING - (1) The operation is being executed.
+	LkFuture_DONE - (2) The operation has finished, and its result can be taken with <LkFutureGetResult>.
+	LkFuture_CANCELLED - (3) The future was cancelled before it started.
+
+	Constants: LkFuture waits
+
+	LkFuture_INFINITE - (0xFFFFFFFF) Time for <LkFutureWaitFor> that waits until the future finishes.
+	LkFuture_DEFAULT_THREADS - (16) Number of threads of the pool created by <LkGetAsyncThreadPool> when no pool has been set with <LkSetAsyncThreadPool>.
+*/
+#define LkFuture_PENDING 0
+#define LkFuture_RUNNING 1
+#define LkFuture_DONE 2
+#define LkFuture_CANCELLED 3
+
+#define LkFuture_INFINITE 0xFFFFFFFF
+#define LkFuture_DEFAULT_THREADS 16
+
+DllEntry void LkSetAsyncThreadPool(LkThreadPool* pool);
+DllEntry LkThreadPool* LkGetAsyncThreadPool();
+DllEntry LkFuture* LkFutureSubmit(LkThreadPool* pool, LkFutureFunction function, void* argument, LkThreadPoolFunction releaseArgument);
+DllEntry uint8_t LkFutureGetState(LkFuture* future);
+DllEntry BOOL LkFutureWaitFor(LkFuture* future, uint32_t milliseconds);
+DllEntry BOOL LkFutureWait(LkFuture* future);
+DllEntry BOOL LkFutureCancel(LkFuture* future);
+DllEntry void LkFutureSetCallback(LkFuture* future, LkFutureCallback callback, void* userData);
+DllEntry char* LkFutureGetResult(LkFuture* future, char** error);
+DllEntry void LkFutureDestroy(LkFuture* future);
@@ -0,0 +1,161 @@
+/*
+	File: MvDynArray.h
+	Header file for <MvDynArray.c>
+
+	Prototype Functions:
+	--- Code
+	DllEntry LkDynArray* LkParseDynArray(const char* const str, uint32_t length);
+	DllEntry uint32_t LkDynArrayCount(const LkDynArray* const dynArray, int32_t field, int32_t value);
+	DllEntry BOOL LkDynArrayGet(const LkDynArray* const dynArray, int32_t field, int32_t value, int32_t subvalue, LkStrView* item);
+	DllEntry void LkFreeDynArray(LkDynArray* dynArray);
+	DllEntry LkDynArrayShape* LkShape(const char* const str, uint32_t length);
+	DllEntry void LkFreeShape(LkDynArrayShape* shape);
+	DllEntry void LkMvCursorInit(LkMvCursor* cursor, const char* const str, uint32_t length);
+	DllEntry BOOL LkMvCursorNext(LkMvCursor* cursor, LkStrView* item, uint8_t* delimiter);
+	DllEntry LkDynArrayEditor* LkDynArrayEditorCreate(const char* const str, uint32_t length);
+	DllEntry BOOL LkDynArrayEditorReplace(LkDynArrayEditor* editor, const char* const newVal, int32_t field, int32_t value, int32_t subvalue);
+	DllEntry BOOL LkDynArrayEditorInsert(LkDynArrayEditor* editor, const char* const newVal, int32_t field, int32_t value, int32_t subvalue);
+	DllEntry BOOL LkDynArrayEditorDelete(LkDynArrayEditor* editor, int32_t field, int32_t value, int32_t subvalue);
+	DllEntry char* LkDynArrayEditorToString(const LkDynArrayEditor* const editor);
+	DllEntry void LkDynArrayEditorDestroy(LkDynArrayEditor* editor);
+	---
+*/
+#include "CompilerOptions.h"
+#include "Types.h"
+
+/*
+	typedef: LkDynArray
+	Index of the fields, values and subvalues of a dynamic array, created by <LkParseDynArray>.
+	Any field, value or subvalue can be obtained from it in constant time, as a view into the dynamic array.
+*/
+#ifndef LKDYNARRAYTYPEDEFINED
+#define LKDYNARRAYTYPEDEFINED 1
+	typedef struct LkDynArray LkDynArray;
+#endif
+
+DllEntry LkDynArray* LkParseDynArray(const char* const str, uint32_t length);
+DllEntry uint32_t LkDynArrayCount(const LkDynArray* const dynArray, int32_t field, int32_t value);
+DllEntry BOOL LkDynArrayGet(const LkDynArray* const dynArray, int32_t field, int32_t value, int32_t subvalue, LkStrView* item);
+DllEntry void LkFreeDynArray(LkDynArray* dynArray);
+
+/*
+	typedef: LkDynArrayShape
+	Number of fields of a dynamic array, values of every field and subvalues of every value, created by <LkShape>.
+	Everything is allocated in only one memory block, that is released with <LkFreeShape>.
+
+		--- Code
+		typedef struct
+		{
+			uint32_t numFields;
+			uint32_t numValues;
+			uint32_t maxValues;
+			uint32_t maxSubvalues;
+			uint32_t* valuesPerField;
+			uint32_t* firstValue;
+			uint32_t* subvaluesPerValue;
+		} LkDynArrayShape;
+		---
+
+		numFields - Number of fields. An empty dynamic array has one empty field.
+		numValues - Total number of values of all the fields.
+		maxValues - The greatest number of values of a field.
+		maxSubvalues - The greatest number of subvalues of a value.
+		valuesPerField - Array of numFields elements with the number of values of every field. An empty field has one empty value.
+		firstValue - Array of numFields elements with the index in "subvaluesPerValue" of the first value of every field.
+		subvaluesPerValue - Array of numValues elements with the number of subvalues of every value, for all the values of all the fields one after another.
+*/
+#ifndef LKDYNARRAYSHAPETYPEDEFINED
+#define LKDYNARRAYSHAPETYPEDEFINED 1
+	typedef struct
+	{
+		uint32_t numFields;
+		uint32_t numValues;
+		uint32_t maxValues;
+		uint32_t maxSubvalues;
+		uint32_t* valuesPerField;
+		uint32_t* firstValue;
+		uint32_t* subvaluesPerValue;
+	} LkDynArrayShape;
+#endif
+
+DllEntry LkDynArrayShape* LkShape(const char* const str, uint32_t length);
+DllEntry void LkFreeShape(LkDynArrayShape* shape);
+
+/*
+	typedef: LkMvCursor
+	Position of a walk through a dynamic array, initialized by <LkMvCursorInit> and advanced by <LkMvCursorNext>.
+	It doesn't allocate memory, so it is usually a local variable.
+
+		--- Code
+		typedef struct
+		{
+			const char* str;
+			uint32_t length;
+			uint32_t position;
+			uint32_t field;
+			uint32_t value;
+			uint32_t subvalue;
+			uint8_t delimiter;
+		} LkMvCursor;
+		---
+
+		str - The dynamic array.
+		length - Length of "str".
+		position - Offset in "str" of the next element.
+		field - Field of the last element obtained, starting with 1.
+		value - Value of the last element obtained, starting with 1.
+		subvalue - Subvalue of the last element obtained, starting with 1.
+		delimiter - Code of the mark found after the last element obtained.
+*/
+#ifndef LKMVCURSORTYPEDEFINED
+#define LKMVCURSORTYPEDEFINED 1
+	typedef struct
+	{
+		const char* str;
+		uint32_t length;
+		uint32_t position;
+		uint32_t field;
+		uint32_t value;
+		uint32_t subvalue;
+		uint8_t delimiter;
+	} LkMvCursor;
+#endif
+
+/*
+	Constants: LkMvCursor
+	Codes of the marks returned by <LkMvCursorNext>. They are the same codes of the REMOVE statement of MV BASIC.
+
+	LkMvCursor_END - (0) There are no more elements.
+	LkMvCursor_IM - (1) <DBMV_Mark_IM>.
+	LkMvCursor_AM - (2) <DBMV_Mark_AM>.
+	LkMvCursor_VM - (3) <DBMV_Mark_VM>.
+	LkMvCursor_SM - (4) <DBMV_Mark_SM>.
+	LkMvCursor_TM - (5) <DBMV_Mark_TM>.
+	LkMvCursor_FIRST - (0xFF) Set by <LkMvCursorInit> before the first element is obtained.
+*/
+#define LkMvCursor_END 0
+#define LkMvCursor_IM 1
+#define LkMvCursor_AM 2
+#define LkMvCursor_VM 3
+#define LkMvCursor_SM 4
+#define LkMvCursor_TM 5
+#define LkMvCursor_FIRST 0xFF
+
+DllEntry void LkMvCursorInit(LkMvCursor* cursor, const char* const str, uint32_t length);
+DllEntry BOOL LkMvCursorNext(LkMvCursor* cursor, LkStrView* item, uint8_t* delimiter);
+
+/*
+	typedef: LkDynArrayEditor
+	Editor created by <LkDynArrayEditorCreate>, that applies many replacements, insertions and deletions to a dynamic array and builds the final string only once.
+*/
+#ifndef LKDYNARRAYEDITORTYPEDEFINED
+#define LKDYNARRAYEDITORTYPEDEFINED 1
+	typedef struct LkDynArrayEditor LkDynArrayEditor;
+#endif
+
+DllEntry LkDynArrayEditor* LkDynArrayEditorCreate(const char* const str, uint32_t length);
+DllEntry BOOL LkDynArrayEditorReplace(LkDynArrayEditor* editor, const char* const newVal, int32_t field, int32_t value, int32_t subvalue);
+DllEntry BOOL LkDynArrayEditorInsert(LkDynArrayEditor* editor, const char* const newVal, int32_t field, int32_t value, int32_t subvalue);
+DllEntry BOOL LkDynArrayEditorDelete(LkDynArrayEditor* editor, int32_t field, int32_t value, int32_t subvalue);
+DllEntry char* LkDynArrayEditorToString(const LkDynArrayEditor* const editor);
+DllEntry void LkDynArrayEditorDestroy(LkDynArrayEditor* editor);
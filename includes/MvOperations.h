@@ -7,21 +7,86 @@
 	DllEntry uint32_t LkCount(const char* const str, char delimiter);
 	DllEntry uint32_t LkDCount(const char* const str, char delimiter);
 	DllEntry char* LkExtract(const char* const str, int32_t field, int32_t value, int32_t subvalue);
-	static char* AddMarks(const char* const str, int32_t numMarcas, char mark);
 	DllEntry char* LkReplace(const char* const str, const char* const newVal, int32_t field, int32_t value, int32_t subvalue);
-	static uint32_t _strFind(const char* const str, const char* const searchStr);
-	static char* _strReplace(const char* const str, uint32_t pos, uint32_t length, const char* newStr);
 	DllEntry char* LkChange(const char* const str, const char* const oldStr, const char* const newStr, int32_t occurrences, int32_t start);
+
+	DllEntry char* LkExtractArena(LkArena* arena, const char* const str, int32_t field, int32_t value, int32_t subvalue);
+	DllEntry char* LkReplaceArena(LkArena* arena, const char* const str, const char* const newVal, int32_t field, int32_t value, int32_t subvalue);
+	DllEntry char* LkChangeArena(LkArena* arena, const char* const str, const char* const oldStr, const char* const newStr, int32_t occurrence, int32_t start);
+
+	DllEntry LkBatchResult* LkExtractBatch(const char** const records, uint32_t count, int32_t field, int32_t value, int32_t subvalue, const LkParallelConfig* const config);
+	DllEntry LkBatchResult* LkReplaceBatch(const char** const records, uint32_t count, const char* const newVal, int32_t field, int32_t value, int32_t subvalue, const LkParallelConfig* const config);
+	DllEntry LkBatchResult* LkChangeBatch(const char** const records, uint32_t count, const char* const oldStr, const char* const newStr, int32_t occurrence, int32_t start, const LkParallelConfig* const config);
+	DllEntry LkBatchResult* LkParsedExtractBatch(const LkParsedResult* const parsedResult, int32_t field, int32_t value, int32_t subvalue, const LkParallelConfig* const config);
+	DllEntry LkBatchResult* LkParsedReplaceBatch(const LkParsedResult* const parsedResult, const char* const newVal, int32_t field, int32_t value, int32_t subvalue, const LkParallelConfig* const config);
+	DllEntry LkBatchResult* LkParsedChangeBatch(const LkParsedResult* const parsedResult, const char* const oldStr, const char* const newStr, int32_t occurrence, int32_t start, const LkParallelConfig* const config);
+	DllEntry void LkFreeBatchResult(LkBatchResult* batchResult);
+
+	DllEntry BOOL LkExtractView(const char* const str, uint32_t length, int32_t field, int32_t value, int32_t subvalue, LkStrView* item);
+	DllEntry uint32_t LkExtractInto(const char* const str, uint32_t length, int32_t field, int32_t value, int32_t subvalue, char* buffer, uint32_t capacity);
+
+	DllEntry BOOL LkLocate(const char* const str, const char* const searchValue, int32_t field, int32_t value, LocateOrderTYPE order, uint32_t* position);
+
+	DllEntry char* LkInsert(const char* const str, const char* const newVal, int32_t field, int32_t value, int32_t subvalue);
+	DllEntry char* LkDelete(const char* const str, int32_t field, int32_t value, int32_t subvalue);
 	---
 */
 #include "CompilerOptions.h"
 #include "Types.h"
+#include "LinkarMemory.h"
+#include "LinkarStrings.h"
+#include "MvDynArray.h"
 
 DllEntry uint32_t LkCount(const char* const str, char delimiter);
 DllEntry uint32_t LkDCount(const char* const str, char delimiter);
 DllEntry char* LkExtract(const char* const str, int32_t field, int32_t value, int32_t subvalue);
-static char* AddMarks(const char* const str, int32_t numMarcas, char mark);
 DllEntry char* LkReplace(const char* const str, const char* const newVal, int32_t field, int32_t value, int32_t subvalue);
-static uint32_t _strFind(const char* const str, const char* const searchStr);
-static char* _strReplace(const char* const str, uint32_t pos, uint32_t length, const char* newStr);
 DllEntry char* LkChange(const char* const str, const char* const oldStr, const char* const newStr, int32_t occurrence, int32_t start);
+
+DllEntry char* LkExtractArena(LkArena* arena, const char* const str, int32_t field, int32_t value, int32_t subvalue);
+DllEntry char* LkReplaceArena(LkArena* arena, const char* const str, const char* const newVal, int32_t field, int32_t value, int32_t subvalue);
+DllEntry char* LkChangeArena(LkArena* arena, const char* const str, const char* const oldStr, const char* const newStr, int32_t occurrence, int32_t start);
+
+/*
+	typedef: LkBatchResult
+	Results of a batch function, like <LkExtractBatch>, one for every record.
+	Everything is allocated in only one memory block, that is released with <LkFreeBatchResult>.
+
+		--- Code
+		typedef struct
+		{
+			uint32_t count;
+			uint32_t* offsets;
+			char* data;
+		} LkBatchResult;
+		---
+
+		count - Number of results.
+		offsets - Array of count + 1 elements with the offset of every result inside "data". The last element is the total size of "data".
+		data - All the results, one after another. Every result is NUL terminated.
+*/
+#ifndef LKBATCHRESULTTYPEDEFINED
+#define LKBATCHRESULTTYPEDEFINED 1
+	typedef struct
+	{
+		uint32_t count;
+		uint32_t* offsets;
+		char* data;
+	} LkBatchResult;
+#endif
+
+DllEntry LkBatchResult* LkExtractBatch(const char** const records, uint32_t count, int32_t field, int32_t value, int32_t subvalue, const LkParallelConfig* const config);
+DllEntry LkBatchResult* LkReplaceBatch(const char** const records, uint32_t count, const char* const newVal, int32_t field, int32_t value, int32_t subvalue, const LkParallelConfig* const config);
+DllEntry LkBatchResult* LkChangeBatch(const char** const records, uint32_t count, const char* const oldStr, const char* const newStr, int32_t occurrence, int32_t start, const LkParallelConfig* const config);
+DllEntry LkBatchResult* LkParsedExtractBatch(const LkParsedResult* const parsedResult, int32_t field, int32_t value, int32_t subvalue, const LkParallelConfig* const config);
+DllEntry LkBatchResult* LkParsedReplaceBatch(const LkParsedResult* const parsedResult, const char* const newVal, int32_t field, int32_t value, int32_t subvalue, const LkParallelConfig* const config);
+DllEntry LkBatchResult* LkParsedChangeBatch(const LkParsedResult* const parsedResult, const char* const oldStr, const char* const newStr, int32_t occurrence, int32_t start, const LkParallelConfig* const config);
+DllEntry void LkFreeBatchResult(LkBatchResult* batchResult);
+
+DllEntry BOOL LkExtractView(const char* const str, uint32_t length, int32_t field, int32_t value, int32_t subvalue, LkStrView* item);
+DllEntry uint32_t LkExtractInto(const char* const str, uint32_t length, int32_t field, int32_t value, int32_t subvalue, char* buffer, uint32_t capacity);
+
+DllEntry BOOL LkLocate(const char* const str, const char* const searchValue, int32_t field, int32_t value, LocateOrderTYPE order, uint32_t* position);
+
+DllEntry char* LkInsert(const char* const str, const char* const newVal, int32_t field, int32_t value, int32_t subvalue);
+DllEntry char* LkDelete(const char* const str, int32_t field, int32_t value, int32_t subvalue);
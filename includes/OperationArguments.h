@@ -20,6 +20,13 @@
 	DllEntry char* LkGetLkPropertiesArgs(const char* const filename, const char* const lkPropertiesOptions, const char* const customVars);
 	DllEntry char* LkGetGetTableArgs(const char* const filename, const char* const selectClause, const char* const dictClause, const char* const sortClause, const char* const tableOptions, const char* const customVars);
 	DllEntry char* LkGetResetCommonBlocksArgs();
+	DllEntry uint32_t LkEncodeOperationArgs(const char* const customVars, const char* const options, const char* const* const inputItems, const char* const separators, uint32_t numItems, char* buffer, uint32_t capacity);
+	DllEntry LkPreparedOperation* LkPrepareRead(const char* const filename, const char* const dictionaries, const char* const readOptions, const char* const customVars);
+	DllEntry LkPreparedOperation* LkPrepareSelect(const char* const filename, const char* const selectClause, const char* const sortClause, const char* const dictClause, const char* const preSelectClause, const char* const selectOptions, const char* const customVars);
+	DllEntry LkPreparedOperation* LkPrepareGetTable(const char* const filename, const char* const selectClause, const char* const dictClause, const char* const sortClause, const char* const tableOptions, const char* const customVars);
+	DllEntry char* LkGetPreparedReadArgs(const LkPreparedOperation* const prepared, const char* const recordIds);
+	DllEntry char* LkGetPreparedPageArgs(const LkPreparedOperation* const prepared, uint8_t operationCode, uint32_t numPage);
+	DllEntry void LkFreePreparedOperation(LkPreparedOperation* prepared);
 	---
 */
 #include "CompilerOptions.h"
@@ -43,3 +50,21 @@ DllEntry char* LkGetLkSchemasArgs(const char* const lkSchemasOptions, const char
 DllEntry char* LkGetLkPropertiesArgs(const char* const filename, const char* const lkPropertiesOptions, const char* const customVars);
 DllEntry char* LkGetGetTableArgs(const char* const filename, const char* const selectClause, const char* const dictClause, const char* const sortClause, const char* const tableOptions, const char* const customVars);
 DllEntry char* LkGetResetCommonBlocksArgs();
+DllEntry uint32_t LkEncodeOperationArgs(const char* const customVars, const char* const options, const char* const* const inputItems, const char* const separators, uint32_t numItems, char* buffer, uint32_t capacity);
+
+/*
+	typedef: LkPreparedOperation
+	Read, Select or GetTable operation with its 3 items already composed, created by <LkPrepareRead>, <LkPrepareSelect> or <LkPrepareGetTable>.
+	Only the part that changes between calls, the recordIds or the numPage, is composed again every time.
+*/
+#ifndef LKPREPAREDOPERATIONTYPEDEFINED
+#define LKPREPAREDOPERATIONTYPEDEFINED 1
+	typedef struct LkPreparedOperation LkPreparedOperation;
+#endif
+
+DllEntry LkPreparedOperation* LkPrepareRead(const char* const filename, const char* const dictionaries, const char* const readOptions, const char* const customVars);
+DllEntry LkPreparedOperation* LkPrepareSelect(const char* const filename, const char* const selectClause, const char* const sortClause, const char* const dictClause, const char* const preSelectClause, const char* const selectOptions, const char* const customVars);
+DllEntry LkPreparedOperation* LkPrepareGetTable(const char* const filename, const char* const selectClause, const char* const dictClause, const char* const sortClause, const char* const tableOptions, const char* const customVars);
+DllEntry char* LkGetPreparedReadArgs(const LkPreparedOperation* const prepared, const char* const recordIds);
+DllEntry char* LkGetPreparedPageArgs(const LkPreparedOperation* const prepared, uint8_t operationCode, uint32_t numPage);
+DllEntry void LkFreePreparedOperation(LkPreparedOperation* prepared);
@@ -4,9 +4,6 @@
 
 	Prototype Functions:
 	--- Code
-	static char* LkCreateCommonOptions(BOOL calculated, BOOL conversion, BOOL formatSpec, BOOL originalRecords);
-	static char* LkCreateReadAfterCommonOptions(BOOL readAfter, BOOL calculated, BOOL conversion, BOOL formatSpec, BOOL originalRecords);
-	
 	DllEntry char* LkCreateReadOptions(BOOL calculated, BOOL conversion, BOOL formatSpec, BOOL originalRecords);
 	DllEntry char* LkCreateUpdateOptions(BOOL optimisticLock, BOOL readAfter, BOOL calculated, BOOL conversion, BOOL formatSpec, BOOL originalRecords);
 	
@@ -27,29 +24,31 @@
 	static const char* const GetStrSchemaType(SchemaTYPE schemaType);
 	static const char* const GetStrRowHeadersType(RowHeadersTYPE rowHeadersType);
 	
-	static char* LkCreateLkSchemasOptions(SchemaTYPE schemaType, RowHeadersTYPE rowHeaders, BOOL sqlMode, BOOL rowProperties, BOOL onlyVisibles, BOOL pagination, uint32_t regPage, uint32_t numPage);
+	static char* LkCreateLkSchemasOptions(SchemaTYPE schemaType, RowHeadersTYPE rowHeaders, BOOL sqlMode, BOOL rowProperties, BOOL onlyVisibles, BOOL pagination, uint32_t regPage, uint32_t numPage, const char* const entryPoint);
 	DllEntry char* LkCreateSchOptionsTypeLKSCHEMAS(RowHeadersTYPE rowHeaders, BOOL rowProperties, BOOL onlyVisibles, BOOL pagination, uint32_t regPage, uint32_t numPage);
 	DllEntry char* LkCreateSchOptionsTypeSQLMODE(BOOL onlyVisibles, BOOL pagination, uint32_t regPage, uint32_t numPage);
 	DllEntry char* LkCreateSchOptionsTypeDICTIONARIES(RowHeadersTYPE rowHeaders, BOOL pagination, uint32_t regPage, uint32_t numPage);
 	
-	static char* LkCreateLkPropertiesOptions(SchemaTYPE schemaType, RowHeadersTYPE rowHeaders, BOOL sqlMode, BOOL rowProperties, BOOL onlyVisibles, BOOL usePropertyNames, BOOL pagination, uint32_t regPage, uint32_t numPage);
+	static char* LkCreateLkPropertiesOptions(SchemaTYPE schemaType, RowHeadersTYPE rowHeaders, BOOL sqlMode, BOOL rowProperties, BOOL onlyVisibles, BOOL usePropertyNames, BOOL pagination, uint32_t regPage, uint32_t numPage, const char* const entryPoint);
 	DllEntry char* LkCreatePropOptionsTypeLKSCHEMAS(RowHeadersTYPE rowHeaders, BOOL rowProperties, BOOL onlyVisibles, BOOL usePropertyNames, BOOL pagination, uint32_t regPage, uint32_t numPage);
 	DllEntry char* LkCreatePropOptionsTypeSQLMODE(BOOL onlyVisibles, BOOL pagination, uint32_t regPage, uint32_t numPage);
 	DllEntry char* LkCreatePropOptionsTypeDICTIONARIES(RowHeadersTYPE rowHeaders, BOOL pagination, uint32_t regPage, uint32_t numPage);
 	
-	static char* LkCreateLkGetTableOptions(SchemaTYPE schemaType, RowHeadersTYPE rowHeaders, BOOL sqlMode, BOOL rowProperties, BOOL onlyVisibles, BOOL usePropertyNames, BOOL repeatValues, BOOL applyConversion, BOOL applyFormat, BOOL calculated, BOOL pagination, uint32_t regPage, uint32_t numPage);
+	static char* LkCreateLkGetTableOptions(SchemaTYPE schemaType, RowHeadersTYPE rowHeaders, BOOL sqlMode, BOOL rowProperties, BOOL onlyVisibles, BOOL usePropertyNames, BOOL repeatValues, BOOL applyConversion, BOOL applyFormat, BOOL calculated, BOOL pagination, uint32_t regPage, uint32_t numPage, const char* const entryPoint);
 	DllEntry char* LkCreateTableOptionsTypeLKSCHEMAS(RowHeadersTYPE rowHeaders, BOOL rowProperties, BOOL onlyVisibles, BOOL usePropertyNames, BOOL repeatValues, BOOL applyConversion, BOOL applyFormat, BOOL calculated, BOOL pagination, uint32_t regPage, uint32_t numPage);
 	DllEntry char* LkCreateTableOptionsTypeSQLMODE(BOOL onlyVisibles, BOOL applyConversion, BOOL applyFormat, BOOL calculated, BOOL pagination, uint32_t regPage, uint32_t numPage);
 	DllEntry char* LkCreateTableOptionsTypeDICTIONARIES(RowHeadersTYPE rowHeaders, BOOL repeatValues, BOOL applyConversion, BOOL applyFormat, BOOL calculated, BOOL pagination, uint32_t regPage, uint32_t numPage);
 	DllEntry char* LkCreateTableOptionsTypeNONE(RowHeadersTYPE rowHeaders, BOOL repeatValues, BOOL pagination, uint32_t regPage, uint32_t numPage);
+	
+	DllEntry const char* LkGetReadOptions(BOOL calculated, BOOL conversion, BOOL formatSpec, BOOL originalRecords);
+	DllEntry const char* LkGetUpdateOptions(BOOL optimisticLockControl, BOOL readAfter, BOOL calculated, BOOL conversion, BOOL formatSpec, BOOL originalRecords);
+	DllEntry uint32_t LkFormatSelectOptions(char* buffer, uint32_t capacity, BOOL onlyRecordId, BOOL pagination, uint32_t regPage, uint32_t numPage, BOOL calculated, BOOL conversion, BOOL formatSpec, BOOL originalRecords);
+	DllEntry const char* LkGetDefaultOptions(uint8_t operationCode);
 	---	
 */
 #include "CompilerOptions.h"
 #include "Types.h"
 
-static char* LkCreateCommonOptions(BOOL calculated, BOOL conversion, BOOL formatSpec, BOOL originalRecords);
-static char* LkCreateReadAfterCommonOptions(BOOL readAfter, BOOL calculated, BOOL conversion, BOOL formatSpec, BOOL originalRecords);
-
 DllEntry char* LkCreateReadOptions(BOOL calculated, BOOL conversion, BOOL formatSpec, BOOL originalRecords);
 DllEntry char* LkCreateUpdateOptions(BOOL optimisticLock, BOOL readAfter, BOOL calculated, BOOL conversion, BOOL formatSpec, BOOL originalRecords);
 
@@ -70,18 +69,30 @@ DllEntry char* LkAddArgumentSubroutine(const char* const arguments, const char*
 static const char* const GetStrSchemaType(SchemaTYPE schemaType);
 static const char* const GetStrRowHeadersType(RowHeadersTYPE rowHeadersType);
 
-static char* LkCreateLkSchemasOptions(SchemaTYPE schemaType, RowHeadersTYPE rowHeaders, BOOL sqlMode, BOOL rowProperties, BOOL onlyVisibles, BOOL pagination, uint32_t regPage, uint32_t numPage);
+static char* LkCreateLkSchemasOptions(SchemaTYPE schemaType, RowHeadersTYPE rowHeaders, BOOL sqlMode, BOOL rowProperties, BOOL onlyVisibles, BOOL pagination, uint32_t regPage, uint32_t numPage, const char* const entryPoint);
 DllEntry char* LkCreateSchOptionsTypeLKSCHEMAS(RowHeadersTYPE rowHeaders, BOOL rowProperties, BOOL onlyVisibles, BOOL pagination, uint32_t regPage, uint32_t numPage);
 DllEntry char* LkCreateSchOptionsTypeSQLMODE(BOOL onlyVisibles, BOOL pagination, uint32_t regPage, uint32_t numPage);
 DllEntry char* LkCreateSchOptionsTypeDICTIONARIES(RowHeadersTYPE rowHeaders, BOOL pagination, uint32_t regPage, uint32_t numPage);
 
-static char* LkCreateLkPropertiesOptions(SchemaTYPE schemaType, RowHeadersTYPE rowHeaders, BOOL sqlMode, BOOL rowProperties, BOOL onlyVisibles, BOOL usePropertyNames, BOOL pagination, uint32_t regPage, uint32_t numPage);
+static char* LkCreateLkPropertiesOptions(SchemaTYPE schemaType, RowHeadersTYPE rowHeaders, BOOL sqlMode, BOOL rowProperties, BOOL onlyVisibles, BOOL usePropertyNames, BOOL pagination, uint32_t regPage, uint32_t numPage, const char* const entryPoint);
 DllEntry char* LkCreatePropOptionsTypeLKSCHEMAS(RowHeadersTYPE rowHeaders, BOOL rowProperties, BOOL onlyVisibles, BOOL usePropertyNames, BOOL pagination, uint32_t regPage, uint32_t numPage);
 DllEntry char* LkCreatePropOptionsTypeSQLMODE(BOOL onlyVisibles, BOOL pagination, uint32_t regPage, uint32_t numPage);
 DllEntry char* LkCreatePropOptionsTypeDICTIONARIES(RowHeadersTYPE rowHeaders, BOOL pagination, uint32_t regPage, uint32_t numPage);
 
-static char* LkCreateLkGetTableOptions(SchemaTYPE schemaType, RowHeadersTYPE rowHeaders, BOOL sqlMode, BOOL rowProperties, BOOL onlyVisibles, BOOL usePropertyNames, BOOL repeatValues, BOOL applyConversion, BOOL applyFormat, BOOL calculated, BOOL pagination, uint32_t regPage, uint32_t numPage);
+static char* LkCreateLkGetTableOptions(SchemaTYPE schemaType, RowHeadersTYPE rowHeaders, BOOL sqlMode, BOOL rowProperties, BOOL onlyVisibles, BOOL usePropertyNames, BOOL repeatValues, BOOL applyConversion, BOOL applyFormat, BOOL calculated, BOOL pagination, uint32_t regPage, uint32_t numPage, const char* const entryPoint);
 DllEntry char* LkCreateTableOptionsTypeLKSCHEMAS(RowHeadersTYPE rowHeaders, BOOL rowProperties, BOOL onlyVisibles, BOOL usePropertyNames, BOOL repeatValues, BOOL applyConversion, BOOL applyFormat, BOOL calculated, BOOL pagination, uint32_t regPage, uint32_t numPage);
 DllEntry char* LkCreateTableOptionsTypeSQLMODE(BOOL onlyVisibles, BOOL applyConversion, BOOL applyFormat, BOOL calculated, BOOL pagination, uint32_t regPage, uint32_t numPage);
 DllEntry char* LkCreateTableOptionsTypeDICTIONARIES(RowHeadersTYPE rowHeaders, BOOL repeatValues, BOOL applyConversion, BOOL applyFormat, BOOL calculated, BOOL pagination, uint32_t regPage, uint32_t numPage);
 DllEntry char* LkCreateTableOptionsTypeNONE(RowHeadersTYPE rowHeaders, BOOL repeatValues, BOOL pagination, uint32_t regPage, uint32_t numPage);
+
+/*
+	Constants: LkOptions_MAX_LENGTH
+
+	LkOptions_MAX_LENGTH - (64) Size of a buffer big enough for the options written by <LkFormatSelectOptions>, including the NUL terminator.
+*/
+#define LkOptions_MAX_LENGTH 64
+
+DllEntry const char* LkGetReadOptions(BOOL calculated, BOOL conversion, BOOL formatSpec, BOOL originalRecords);
+DllEntry const char* LkGetUpdateOptions(BOOL optimisticLockControl, BOOL readAfter, BOOL calculated, BOOL conversion, BOOL formatSpec, BOOL originalRecords);
+DllEntry uint32_t LkFormatSelectOptions(char* buffer, uint32_t capacity, BOOL onlyRecordId, BOOL pagination, uint32_t regPage, uint32_t numPage, BOOL calculated, BOOL conversion, BOOL formatSpec, BOOL originalRecords);
+DllEntry const char* LkGetDefaultOptions(uint8_t operationCode);
@@ -264,6 +264,83 @@ typedef uint8_t SchemaTYPE;
 #define SchemaTYPE_DICTIONARIES 0x02
 #define SchemaTYPE_NONE 0x03
 
+/*
+	typedef: LocateOrderTYPE
+	Indicates how the items are sorted when they are searched with <LkLocate>.
+	There are 5 possible options:
+
+		NONE - Not sorted. The items are checked one by one.
+		AL - Ascending, left-justified. The items are compared char by char.
+		AR - Ascending, right-justified. The items are compared as if the shorter one was padded with spaces on the left, so numbers are sorted by their value.
+		DL - Descending, left-justified.
+		DR - Descending, right-justified.
+
+		--- Code
+		typedef uint8_t LocateOrderTYPE;
+		---
+
+	Defined constants of LocateOrderTYPE:
+		Used to define the options NONE, AL, AR, DL and DR.
+
+		--- Code
+		#define LocateOrderTYPE_NONE 0x00
+		#define LocateOrderTYPE_AL 0x01
+		#define LocateOrderTYPE_AR 0x02
+		#define LocateOrderTYPE_DL 0x03
+		#define LocateOrderTYPE_DR 0x04
+		---
+*/
+typedef uint8_t LocateOrderTYPE;
+#define LocateOrderTYPE_NONE 0x00
+#define LocateOrderTYPE_AL 0x01
+#define LocateOrderTYPE_AR 0x02
+#define LocateOrderTYPE_DL 0x03
+#define LocateOrderTYPE_DR 0x04
+
+/*
+	typedef: LkStrView
+	A read-only fragment of another string, given by a pointer to its first char and its length.
+	The fragment is not NUL terminated and it is not a copy, so it is valid while the string it points into is valid.
+
+		--- Code
+		typedef struct
+		{
+			const char* str;
+			uint32_t length;
+		} LkStrView;
+		---
+*/
+#ifndef LKSTRVIEWTYPEDEFINED
+#define LKSTRVIEWTYPEDEFINED 1
+	typedef struct
+	{
+		const char* str;
+		uint32_t length;
+	} LkStrView;
+#endif
+
+/*
+	typedef: LkSpan
+	Position of an item inside a string, given by the offset of its first char and its length.
+	Used by the split functions that do not copy the items, like <LkStrSplitSpans>.
+
+		--- Code
+		typedef struct
+		{
+			uint32_t offset;
+			uint32_t length;
+		} LkSpan;
+		---
+*/
+#ifndef LKSPANTYPEDEFINED
+#define LKSPANTYPEDEFINED 1
+	typedef struct
+	{
+		uint32_t offset;
+		uint32_t length;
+	} LkSpan;
+#endif
+
 
 /*
 	Constants: DBMV_Mark (char)
@@ -7,6 +7,7 @@
 
 #include "Linkar.h"
 #include "OperationArguments.h"
+#include "LinkarMemory.h"
 #include "CommandsDirect.h"
 
 #include <malloc.h>
@@ -47,7 +48,7 @@ DllEntry char* LkSendCommand(char** error, const char* const credentialOptions,
 	
 	char* result = LkExecuteDirectOperation(error, credentialOptions, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout);
 	
-	free(operationArguments);
+	LkFree(operationArguments);
 	
 	return result;
 }
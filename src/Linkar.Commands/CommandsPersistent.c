@@ -7,6 +7,7 @@
 
 #include "Linkar.h"
 #include "OperationArguments.h"
+#include "LinkarMemory.h"
 #include "ConnectionInfo.h"
 #include "CommandsPersistent.h"
 
@@ -146,7 +147,7 @@ DllEntry char* LkSendCommand(char** error, char** connectionInfo, const char* co
 	
 	char* result = LkExecutePersistentOperation(error, connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout);
 	
-	free(operationArguments);
+	LkFree(operationArguments);
 		
 	return result;
 }
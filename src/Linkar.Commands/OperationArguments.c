@@ -17,6 +17,7 @@
 */
 
 #include "OperationArguments.h"
+#include "LinkarMemory.h"
 #include <string.h>
 #include <stdlib.h>
 #include <malloc.h>
@@ -41,7 +42,7 @@ DllEntry char* LkGetSendCommandArgs(const char* const command)
 		lenCommand = strlen(command);
 	
 	int len = lenCommand + 2*strlen(ASCII_US_str) + 1;
-	char* operationArguments = malloc(len);
+	char* operationArguments = LkMallocFrom(len, __func__);
 	if(operationArguments != NULL)
 	{
 		strcpy(operationArguments, ASCII_US_str);
@@ -54,4 +55,4 @@ DllEntry char* LkGetSendCommandArgs(const char* const command)
 	
 	return operationArguments;
 }
-	
\ No newline at end of file
+	
\ No newline at end of file
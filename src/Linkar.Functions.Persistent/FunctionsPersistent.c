@@ -19,11 +19,14 @@
 #include "Linkar.h"
 #include "FunctionsPersistent.h"
 #include "OperationArguments.h"
+#include "LinkarMemory.h"
 #include "ConnectionInfo.h"
 #include "LinkarStringsHelper.h"
 #include "LinkarStrings.h"
+#include "LinkarThreadPool.h"
 
 #include <malloc.h>
+#include <string.h>
 
 /*
 	Function: Base_LkLogin
@@ -137,7 +140,7 @@ DllEntry char* Base_LkRead(char** error, char* connectionInfo, const char* const
 	
 	char* result = LkExecutePersistentOperation(error, &connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout);
 	
-	free(operationArguments);
+	LkFree(operationArguments);
 	
 	return result;
 }
@@ -186,7 +189,7 @@ DllEntry char* Base_LkUpdate(char** error, char* connectionInfo, const char* con
 
 	char* result = LkExecutePersistentOperation(error, &connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout);
 	
-	free(operationArguments);
+	LkFree(operationArguments);
 	
 	return result;	
 }
@@ -236,7 +239,7 @@ DllEntry char* Base_LkUpdatePartial(char** error, char* connectionInfo, const ch
 
 	char* result = LkExecutePersistentOperation(error, &connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout);
 	
-	free(operationArguments);
+	LkFree(operationArguments);
 	
 	return result;	
 }
@@ -288,7 +291,7 @@ DllEntry char* Base_LkNew(char** error, char* connectionInfo, const char* const
 	
 	char* result = LkExecutePersistentOperation(error, &connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout);	
 
-	free(operationArguments);
+	LkFree(operationArguments);
 	
 	return result;	
 }
@@ -344,7 +347,7 @@ DllEntry char* Base_LkDelete(char** error, char* connectionInfo, const char* con
 	
 	char* result = LkExecutePersistentOperation(error, &connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout);
 	
-	free(operationArguments);
+	LkFree(operationArguments);
 	
 	return result;
 }
@@ -395,7 +398,7 @@ DllEntry char* Base_LkSelect(char** error, char* connectionInfo, const char* con
 	
 	char* result = LkExecutePersistentOperation(error, &connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout);
 	
-	free(operationArguments);
+	LkFree(operationArguments);
 	
 	return result;
 }
@@ -436,7 +439,7 @@ DllEntry char* Base_LkSubroutine(char** error, char* connectionInfo, const char*
 	
 	char* result = LkExecutePersistentOperation(error, &connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout);
 	
-	free(operationArguments);
+	LkFree(operationArguments);
 	
 	return result;	
 }
@@ -477,7 +480,7 @@ DllEntry char* Base_LkConversion(char** error, char* connectionInfo, const char*
 	
 	char* result = LkExecutePersistentOperation(error, &connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout);
 	
-	free(operationArguments);
+	LkFree(operationArguments);
 	
 	return result;	
 }
@@ -515,7 +518,7 @@ DllEntry char* Base_LkFormat(char** error, char* connectionInfo, const char* con
 	
 	char* result = LkExecutePersistentOperation(error, &connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout);
 	
-	free(operationArguments);
+	LkFree(operationArguments);
 	
 	return result;	
 }
@@ -552,7 +555,7 @@ DllEntry char* Base_LkDictionaries(char** error, char* connectionInfo, const cha
 	
 	char* result = LkExecutePersistentOperation(error, &connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout);
 	
-	free(operationArguments);
+	LkFree(operationArguments);
 	
 	return result;	
 }
@@ -589,7 +592,7 @@ DllEntry char* Base_LkExecute(char** error, char* connectionInfo, const char* co
 	
 	char* result = LkExecutePersistentOperation(error, &connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout);
 	
-	free(operationArguments);
+	LkFree(operationArguments);
 	
 	return result;	
 }
@@ -647,7 +650,7 @@ DllEntry char* Base_LkGetVersion(char** error, char* connectionInfo, DataFormatT
 	
 	char* result = LkExecutePersistentOperation(error, &connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout);
 	
-	free(operationArguments);
+	LkFree(operationArguments);
 	
 	return result;	
 }
@@ -698,7 +701,7 @@ DllEntry char* Base_LkSchemas(char** error, char* connectionInfo, const char* co
 	
 	char* result = LkExecutePersistentOperation(error, &connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout);
 	
-	free(operationArguments);
+	LkFree(operationArguments);
 	
 	return result;	
 }
@@ -750,7 +753,7 @@ DllEntry char* Base_LkProperties(char** error, char* connectionInfo, const char*
 	
 	char* result = LkExecutePersistentOperation(error, &connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout);
 	
-	free(operationArguments);
+	LkFree(operationArguments);
 	
 	return result;	
 }
@@ -807,7 +810,7 @@ DllEntry char* Base_LkGetTable(char** error, char* connectionInfo, const char* c
 	
 	char* result = LkExecutePersistentOperation(error, &connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout);
 	
-	free(operationArguments);
+	LkFree(operationArguments);
 	
 	return result;	
 }
@@ -843,7 +846,720 @@ DllEntry char* Base_LkResetCommonBlocks(char** error, char* connectionInfo, Data
 	
 	char* result = LkExecutePersistentOperation(error, &connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout);
 	
-	free(operationArguments);
+	LkFree(operationArguments);
 	
 	return result;	
 }
+
+/*
+	Function: Base_LkReadPrepared
+		Reads one or several records of a file, with a Read operation prepared with <LkPrepareRead>.
+		The filename, dictionaries, options and customVars are composed only once, when the operation is prepared.
+		
+	Arguments:
+		error - System or communication errors with LinkarSERVER.
+		connectionInfo - String that is returned by the Login function and that contains all the necessary data of the connection.
+		prepared - The operation prepared with <LkPrepareRead>.
+		recordIds - It's the records codes list to read, separated by the Record Separator character (30). Use <LkComposeRecordIds> to compose this string.
+		inputFormat - Indicates in what format you wish to send the record ids: MV, XML or JSON.
+		outputFormat - Indicates in what format you want to receive the data resulting from the Read, New, Update and Select operations: MV, XML, XML_DICT, XML_SCH, JSON, JSON_DICT or JSON_SCH
+		receiveTimeout - It's the maximum time in seconds that the client will keep waiting the answer by the server. Values less than or equal to 0, waits indefinitely.
+		
+	Returns:
+		The results of the operation, or NULL if "prepared" is not a Read operation.
+		
+	See Also:
+		<LkPrepareRead>
+
+		<LkLogin>
+		
+		<LkLogout>
+		
+		<LkCreateConnectionInfo>
+		
+		<Release Memory>
+*/
+DllEntry char* Base_LkReadPrepared(char** error, char* connectionInfo, const LkPreparedOperation* const prepared, const char* const recordIds, DataFormatTYPE inputFormat, DataFormatCruTYPE outputFormat, uint32_t receiveTimeout)
+{
+	uint8_t operationCode = OP_CODE_READ;
+	char* operationArguments = LkGetPreparedReadArgs(prepared, recordIds);
+	if(operationArguments == NULL)
+		return NULL;
+	
+	char* result = LkExecutePersistentOperation(error, &connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout);
+	
+	LkFree(operationArguments);
+	
+	return result;
+}
+
+/*
+	Function: Base_LkSelectPrepared
+		Executes a Query in the Database, with a Select operation prepared with <LkPrepareSelect>.
+		The clauses, options and customVars are composed only once, when the operation is prepared, and only the page changes in every call.
+		
+	Arguments:
+		error - System or communication errors with LinkarSERVER.
+		connectionInfo - String that is returned by the Login function and that contains all the necessary data of the connection.
+		prepared - The operation prepared with <LkPrepareSelect>.
+		numPage - The page to obtain. It is ignored if the options of the prepared operation don't use pagination.
+		outputFormat - Indicates in what format you want to receive the data resulting from the Read, New, Update and Select operations: MV, XML, XML_DICT, XML_SCH, JSON, JSON_DICT or JSON_SCH.
+		receiveTimeout - It's the maximum time in seconds that the client will keep waiting the answer by the server. Values less than or equal to 0, waits indefinitely.
+		
+	Returns:
+		The results of the operation, or NULL if "prepared" is not a Select operation.
+		
+	See Also:
+		<LkPrepareSelect>
+
+		<LkLogin>
+		
+		<LkLogout>
+		
+		<LkCreateConnectionInfo>
+		
+		<Release Memory>
+*/
+DllEntry char* Base_LkSelectPrepared(char** error, char* connectionInfo, const LkPreparedOperation* const prepared, uint32_t numPage, DataFormatCruTYPE outputFormat, uint32_t receiveTimeout)
+{
+	uint8_t operationCode = OP_CODE_SELECT;
+	char* operationArguments = LkGetPreparedPageArgs(prepared, operationCode, numPage);
+	if(operationArguments == NULL)
+		return NULL;
+	DataFormatTYPE inputFormat = DataFormatTYPE_MV;
+	
+	char* result = LkExecutePersistentOperation(error, &connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout);
+	
+	LkFree(operationArguments);
+	
+	return result;
+}
+
+/*
+	Function: Base_LkGetTablePrepared
+		Returns a query result in a table format, with a GetTable operation prepared with <LkPrepareGetTable>.
+		The clauses, options and customVars are composed only once, when the operation is prepared, and only the page changes in every call.
+		
+	Arguments:
+		error - System or communication errors with LinkarSERVER.
+		connectionInfo - String that is returned by the Login function and that contains all the necessary data of the connection.
+		prepared - The operation prepared with <LkPrepareGetTable>.
+		numPage - The page to obtain. It is ignored if the options of the prepared operation don't use pagination.
+		receiveTimeout - It's the maximum time in seconds that the client will keep waiting the answer by the server. Values less than or equal to 0, waits indefinitely.
+		
+	Returns:
+		The results of the operation, or NULL if "prepared" is not a GetTable operation.
+		
+	See Also:
+		<LkPrepareGetTable>
+
+		<LkLogin>
+		
+		<LkLogout>
+		
+		<LkCreateConnectionInfo>
+		
+		<Release Memory>
+*/
+DllEntry char* Base_LkGetTablePrepared(char** error, char* connectionInfo, const LkPreparedOperation* const prepared, uint32_t numPage, uint32_t receiveTimeout)
+{
+	uint8_t operationCode = OP_CODE_GETTABLE;
+	char* operationArguments = LkGetPreparedPageArgs(prepared, operationCode, numPage);
+	if(operationArguments == NULL)
+		return NULL;
+	DataFormatTYPE inputFormat = DataFormatTYPE_MV;
+	DataFormatTYPE outputFormat = DataFormatSchTYPE_TABLE;
+	
+	char* result = LkExecutePersistentOperation(error, &connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout);
+	
+	LkFree(operationArguments);
+	
+	return result;	
+}
+
+/*
+	Struct: AsyncPersistentOperation
+		Persistent operation queued by the Base_Lk*Async functions. The connectionInfo string is copied in the same block, after the struct, so the caller can release its strings as soon as the function returns.
+*/
+typedef struct
+{
+	char* connectionInfo;
+	char* operationArguments;
+	uint8_t operationCode;
+	uint8_t inputFormat;
+	uint8_t outputFormat;
+	uint32_t receiveTimeout;
+} AsyncPersistentOperation;
+
+static char* RunPersistentOperation(void* argument, char** error)
+{
+	AsyncPersistentOperation* operation = (AsyncPersistentOperation*)argument;
+	char* connectionInfo = operation->connectionInfo;
+	
+	return LkExecutePersistentOperation(error, &connectionInfo, operation->operationCode, operation->operationArguments, operation->inputFormat, operation->outputFormat, operation->receiveTimeout);
+}
+
+static void ReleasePersistentOperation(void* argument)
+{
+	AsyncPersistentOperation* operation = (AsyncPersistentOperation*)argument;
+	
+	LkFree(operation->operationArguments);
+	LkFree(operation);
+}
+
+/*
+	Function: ExecutePersistentAsync
+		Queues a persistent operation in the pool returned by <LkGetAsyncThreadPool>. It takes the ownership of operationArguments, that is released when the operation finishes or can not be queued.
+*/
+static LkFuture* ExecutePersistentAsync(const char* const connectionInfo, uint8_t operationCode, char* operationArguments, uint8_t inputFormat, uint8_t outputFormat, uint32_t receiveTimeout, const char* const entryPoint)
+{
+	if(operationArguments == NULL)
+		return NULL;
+	
+	size_t length = connectionInfo != NULL ? strlen(connectionInfo) + 1 : 0;
+	AsyncPersistentOperation* operation = LkMallocFrom(sizeof(AsyncPersistentOperation) + length, entryPoint);
+	if(operation == NULL)
+	{
+		LkFree(operationArguments);
+		return NULL;
+	}
+	
+	operation->connectionInfo = NULL;
+	if(connectionInfo != NULL)
+	{
+		operation->connectionInfo = (char*)(operation + 1);
+		memcpy(operation->connectionInfo, connectionInfo, length);
+	}
+	operation->operationArguments = operationArguments;
+	operation->operationCode = operationCode;
+	operation->inputFormat = inputFormat;
+	operation->outputFormat = outputFormat;
+	operation->receiveTimeout = receiveTimeout;
+	
+	LkFuture* future = LkFutureSubmit(NULL, RunPersistentOperation, operation, ReleasePersistentOperation);
+	if(future == NULL)
+		ReleasePersistentOperation(operation);
+	
+	return future;
+}
+
+/*
+	Function: Base_LkReadAsync
+		Reads one or several records of a file.
+		The operation is executed in the thread pool returned by <LkGetAsyncThreadPool>, so the calling thread does not wait for the answer of the server.
+		
+	Arguments:
+		connectionInfo - String that is returned by the Login function and that contains all the necessary data of the connection.
+		filename - File name to read.
+		recordIds - It's the records codes list to read, separated by the Record Separator character (30). Use <LkComposeRecordIds> to compose this string
+		dictionaries - List of dictionaries to read, separated by space. If dictionaries are not indicated the function will read the complete buffer. You may use the format LKFLDx where x is the attribute number.
+		readOptions - Object that defines the different reading options of the Function: Calculated, dictClause, conversion, formatSpec, originalRecords.
+		inputFormat - Indicates in what format you wish to send the record ids: MV, XML or JSON.
+		outputFormat - Indicates in what format you want to receive the data resulting from the Read, New, Update and Select operations: MV, XML, XML_DICT, XML_SCH, JSON, JSON_DICT or JSON_SCH.
+		customVars - It's a free text that will travel until the database to make the admin being able to manage additional behaviours in the standard routine SUB.LK.MAIN.CONTROL.CUSTOM. This routine will be called if the argument has content.
+		receiveTimeout - It's the maximum time in seconds that the client will keep waiting the answer by the server. Values less than or equal to 0, waits indefinitely. Values less than or equal to 0, waits indefinitely.
+		
+	Returns:
+		The <LkFuture> of the operation, or NULL if it could not be submitted. Its result is taken with <LkFutureGetResult>, and it must be released with <LkFutureDestroy>.
+		
+	See Also:
+		<Base_LkRead>
+		
+		<LkFutureGetResult>
+		
+		<LkSetAsyncThreadPool>
+*/
+DllEntry LkFuture* Base_LkReadAsync(const char* const connectionInfo, const char* const filename, const char* const recordIds, const char* const dictionaries, const char* const readOptions, DataFormatTYPE inputFormat, DataFormatCruTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout)
+{
+	uint8_t operationCode = OP_CODE_READ;
+	char* operationArguments = LkGetReadArgs(filename, recordIds, dictionaries, readOptions, customVars);
+	
+	return ExecutePersistentAsync(connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout, __func__);
+}
+
+/*
+	Function: Base_LkUpdateAsync
+		Update one or several records of a file.
+		The operation is executed in the thread pool returned by <LkGetAsyncThreadPool>, so the calling thread does not wait for the answer of the server.
+		
+	Arguments:
+		connectionInfo - String that is returned by the Login function and that contains all the necessary data of the connection.
+		filename - File name where you are going to write.
+		records - Are the records you want to update. Inside this string are the recordIds, the records, and the originalRecords.
+		updateOptions - Object that defines the different writing options of the Function: optimisticLockControl, readAfter, calculated, dictionaries, conversion, formatSpec, originalRecords.
+		inputFormat - Indicates in what format you wish to send the resultant writing data: MV, XML or JSON.
+		outputFormat - Indicates in what format you want to receive the data resulting from the Read, New, Update and Select operations: MV, XML, XML_DICT, XML_SCH, JSON, JSON_DICT or JSON_SCH.
+		customVars - It's a free text that will travel until the database to make the admin being able to manage additional behaviours in the standard routine SUB.LK.MAIN.CONTROL.CUSTOM. This routine will be called if the argument has content.
+		receiveTimeout - It's the maximum time in seconds that the client will keep waiting the answer by the server. Values less than or equal to 0, waits indefinitely.
+		
+	Returns:
+		The <LkFuture> of the operation, or NULL if it could not be submitted. Its result is taken with <LkFutureGetResult>, and it must be released with <LkFutureDestroy>.
+		
+	See Also:
+		<Base_LkUpdate>
+		
+		<LkFutureGetResult>
+		
+		<LkSetAsyncThreadPool>
+*/
+DllEntry LkFuture* Base_LkUpdateAsync(const char* const connectionInfo, const char* const filename, const char* const records, const char* const updateOptions, DataFormatTYPE inputFormat, DataFormatCruTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout)
+{
+	uint8_t operationCode = OP_CODE_UPDATE;
+	char* operationArguments = LkGetUpdateArgs(filename, records, updateOptions, customVars);
+	
+	return ExecutePersistentAsync(connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout, __func__);
+}
+
+/*
+	Function: Base_LkUpdatePartialAsync
+		Update one or more attributes of one or more file records.
+		The operation is executed in the thread pool returned by <LkGetAsyncThreadPool>, so the calling thread does not wait for the answer of the server.
+		
+	Arguments:
+		connectionInfo - String that is returned by the Login function and that contains all the necessary data of the connection.
+		filename - File name where you are going to write.
+		records - Are the records you want to update. Inside this string are the recordIds, the records, and the originalRecords.
+		dictionaries - List of dictionaries to write, separated by space. In MV output format is mandatory. You may use the format LKFLDx where x is the attribute number.
+		updateOptions - Object that defines the different writing options of the Function: optimisticLockControl, readAfter, calculated, dictionaries, conversion, formatSpec, originalRecords.
+		inputFormat - Indicates in what format you wish to send the resultant writing data: MV, XML or JSON.
+		outputFormat - Indicates in what format you want to receive the data resulting from the Read, New, Update and Select operations: MV, XML, XML_DICT, XML_SCH, JSON, JSON_DICT or JSON_SCH.
+		customVars - It's a free text that will travel until the database to make the admin being able to manage additional behaviours in the standard routine SUB.LK.MAIN.CONTROL.CUSTOM. This routine will be called if the argument has content.
+		receiveTimeout - It's the maximum time in seconds that the client will keep waiting the answer by the server. Values less than or equal to 0, waits indefinitely.
+		
+	Returns:
+		The <LkFuture> of the operation, or NULL if it could not be submitted. Its result is taken with <LkFutureGetResult>, and it must be released with <LkFutureDestroy>.
+		
+	See Also:
+		<Base_LkUpdatePartial>
+		
+		<LkFutureGetResult>
+		
+		<LkSetAsyncThreadPool>
+*/
+DllEntry LkFuture* Base_LkUpdatePartialAsync(const char* const connectionInfo, const char* const filename, const char* const records, const char* const dictionaries, const char* const updateOptions, DataFormatTYPE inputFormat, DataFormatCruTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout)
+{
+	uint8_t operationCode = OP_CODE_UPDATEPARTIAL;
+	char* operationArguments = LkGetUpdatePartialArgs(filename, records, dictionaries, updateOptions, customVars);
+	
+	return ExecutePersistentAsync(connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout, __func__);
+}
+
+/*
+	Function: Base_LkNewAsync
+		Creates one or several records of a file.
+		The operation is executed in the thread pool returned by <LkGetAsyncThreadPool>, so the calling thread does not wait for the answer of the server.
+		
+	Arguments:
+		connectionInfo - String that is returned by the Login function and that contains all the necessary data of the connection.
+		filename - File name where you are going to write.
+		records - Are the records you want to write. Inside this string are the recordIds, and the records.
+		newOptions - String that defines the following writing options of the Function: recordIdType, readAfter, calculated, dictionaries, conversion, formatSpec, originalRecords.
+		inputFormat - Indicates in what format you wish to send the resultant writing data: MV, XML or JSON.
+		outputFormat - Indicates in what format you want to receive the data resulting from the Read, New, Update and Select operations: MV, XML, XML_DICT, XML_SCH, JSON, JSON_DICT or JSON_SCH.
+		customVars - It's a free text that will travel until the database to make the admin being able to manage additional behaviours in the standard routine SUB.LK.MAIN.CONTROL.CUSTOM. This routine will be called if the argument has content.
+		receiveTimeout - It's the maximum time in seconds that the client will keep waiting the answer by the server. Values less than or equal to 0, waits indefinitely.
+		
+	Returns:
+		The <LkFuture> of the operation, or NULL if it could not be submitted. Its result is taken with <LkFutureGetResult>, and it must be released with <LkFutureDestroy>.
+		
+	See Also:
+		<Base_LkNew>
+		
+		<LkFutureGetResult>
+		
+		<LkSetAsyncThreadPool>
+*/
+DllEntry LkFuture* Base_LkNewAsync(const char* const connectionInfo, const char* const filename, const char* const records, const char* const newOptions, DataFormatTYPE inputFormat, DataFormatCruTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout)
+{
+	uint8_t operationCode = OP_CODE_NEW;
+	char* operationArguments = LkGetNewArgs(filename, records, newOptions, customVars);
+	
+	return ExecutePersistentAsync(connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout, __func__);
+}
+
+/*
+	Function: Base_LkDeleteAsync
+		Deletes one or several records in file.
+		The operation is executed in the thread pool returned by <LkGetAsyncThreadPool>, so the calling thread does not wait for the answer of the server.
+		
+	Arguments:
+		connectionInfo - String that is returned by the Login function and that contains all the necessary data of the connection.
+		filename - It's the file name where the records are going to be deleted. DICT in case of deleting a record that belongs to a dictionary.
+		records - It's the records list to be deleted.
+		deleteOptions - Object that defines the different Function options: optimisticLockControl, recoverRecordIdType.
+		inputFormat - Indicates in what format you wish to send the resultant deleting data: MV, XML or JSON.
+		outputFormat - Indicates in what format you want to receive the data resulting from the operation: MV, XML or JSON.
+		customVars - It's a free text that will travel until the database to make the admin being able to manage additional behaviours in the standard routine SUB.LK.MAIN.CONTROL.CUSTOM. This routine will be called if the argument has content.
+		receiveTimeout - It's the maximum time in seconds that the client will keep waiting the answer by the server. Values less than or equal to 0, waits indefinitely.
+		
+	Returns:
+		The <LkFuture> of the operation, or NULL if it could not be submitted. Its result is taken with <LkFutureGetResult>, and it must be released with <LkFutureDestroy>.
+		
+	See Also:
+		<Base_LkDelete>
+		
+		<LkFutureGetResult>
+		
+		<LkSetAsyncThreadPool>
+*/
+DllEntry LkFuture* Base_LkDeleteAsync(const char* const connectionInfo, const char* const filename, const char* const records, const char* const deleteOptions, DataFormatTYPE inputFormat, DataFormatTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout)
+{
+	uint8_t operationCode = OP_CODE_DELETE;
+	char* operationArguments = LkGetDeleteArgs(filename, records, deleteOptions, customVars);
+	
+	return ExecutePersistentAsync(connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout, __func__);
+}
+
+/*
+	Function: Base_LkSelectAsync
+		Executes a Query in the Database.
+		The operation is executed in the thread pool returned by <LkGetAsyncThreadPool>, so the calling thread does not wait for the answer of the server.
+		
+	Arguments:
+		connectionInfo - String that is returned by the Login function and that contains all the necessary data of the connection.
+		filename - File name where the select operation will be perform. For example LK.ORDERS
+		selectClause - Fragment of the phrase that indicate the selection condition. For example WITH CUSTOMER = '1'
+		sortClause - Fragment of the phrase that indicates the selection order. If there is a selection rule, Linkar will execute a SSELECT, otherwise Linkar will execute a SELECT. For example BY CUSTOMER
+		dictClause - Is the list of dictionaries to read, separated by space. If dictionaries are not indicated the function will read the complete buffer. For example CUSTOMER DATE ITEM. You may use the format LKFLDx where x is the attribute number.
+		preSelectClause - It's an optional statement that will execute before the main Select.
+		selectOptions - String that defines the different reading options of the Function: calculated, dictionaries, conversion, formatSpec, originalRecords, onlyItemId, pagination, regPage, numPage.
+		outputFormat - Indicates in what format you want to receive the data resulting from the Read, New, Update and Select operations: MV, XML, XML_DICT, XML_SCH, JSON, JSON_DICT or JSON_SCH.
+		customVars - It's a free text that will travel until the database to make the admin being able to manage additional behaviours in the standard routine SUB.LK.MAIN.CONTROL.CUSTOM. This routine will be called if the argument has content.
+		receiveTimeout - It's the maximum time in seconds that the client will keep waiting the answer by the server. Values less than or equal to 0, waits indefinitely.
+		
+	Returns:
+		The <LkFuture> of the operation, or NULL if it could not be submitted. Its result is taken with <LkFutureGetResult>, and it must be released with <LkFutureDestroy>.
+		
+	See Also:
+		<Base_LkSelect>
+		
+		<LkFutureGetResult>
+		
+		<LkSetAsyncThreadPool>
+*/
+DllEntry LkFuture* Base_LkSelectAsync(const char* const connectionInfo, const char* const filename, const char* const selectClause, const char* const sortClause, const char* const dictClause, const char* const preSelectClause, const char* const selectOptions, DataFormatCruTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout)
+{
+	uint8_t operationCode = OP_CODE_SELECT;
+	char* operationArguments = LkGetSelectArgs(filename, selectClause, sortClause, dictClause, preSelectClause, selectOptions, customVars);
+	DataFormatTYPE inputFormat = DataFormatTYPE_MV;
+	
+	return ExecutePersistentAsync(connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout, __func__);
+}
+
+/*
+	Function: Base_LkSubroutineAsync
+		Executes a subroutine.
+		The operation is executed in the thread pool returned by <LkGetAsyncThreadPool>, so the calling thread does not wait for the answer of the server.
+		
+	Arguments:
+		connectionInfo - String that is returned by the Login function and that contains all the necessary data of the connection.
+		subroutineName - Subroutine name you want to execute.
+		argsNumber - The number of arguments.
+		arguments - The subroutine arguments list.
+		inputFormat - Indicates in what format you wish to send the subroutine arguments: MV, XML or JSON.
+		outputFormat - Indicates in what format you want to receive the data resulting from the operation: MV, XML or JSON.
+		customVars - It's a free text that will travel until the database to make the admin being able to manage additional behaviours in the standard routine SUB.LK.MAIN.CONTROL.CUSTOM. This routine will be called if the argument has content.
+		receiveTimeout - It's the maximum time in seconds that the client will keep waiting the answer by the server. Values less than or equal to 0, waits indefinitely.
+		
+	Returns:
+		The <LkFuture> of the operation, or NULL if it could not be submitted. Its result is taken with <LkFutureGetResult>, and it must be released with <LkFutureDestroy>.
+		
+	See Also:
+		<Base_LkSubroutine>
+		
+		<LkFutureGetResult>
+		
+		<LkSetAsyncThreadPool>
+*/
+DllEntry LkFuture* Base_LkSubroutineAsync(const char* const connectionInfo, const char* const subroutineName, uint32_t argsNumber, const char* const arguments, DataFormatTYPE inputFormat, DataFormatTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout)
+{
+	uint8_t operationCode = OP_CODE_SUBROUTINE;
+	char* operationArguments = LkGetSubroutineArgs(subroutineName, argsNumber, arguments, customVars);
+	
+	return ExecutePersistentAsync(connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout, __func__);
+}
+
+/*
+	Function: Base_LkConversionAsync
+		Returns the result of executing ICONV() or OCONV() functions from a expression list in the Database.
+		The operation is executed in the thread pool returned by <LkGetAsyncThreadPool>, so the calling thread does not wait for the answer of the server.
+		
+	Arguments:
+		connectionInfo - String that is returned by the Login function and that contains all the necessary data of the connection.
+		conversionType - Indicates the conversion type, input or output: Input=ICONV(); OUTPUT=OCONV()
+		expression - The data or expression to convert. It can have MV marks, in which case the conversion will execute in each value obeying the original MV mark.
+		code - The conversion code. It will have to obey the Database conversions specifications.
+		outputFormat - Indicates in what format you want to receive the data resulting from the operation: MV, XML or JSON.
+		customVars - It's a free text that will travel until the database to make the admin being able to manage additional behaviours in the standard routine SUB.LK.MAIN.CONTROL.CUSTOM. This routine will be called if the argument has content.
+		receiveTimeout - It's the maximum time in seconds that the client will keep waiting the answer by the server. Values less than or equal to 0, waits indefinitely.
+		
+	Returns:
+		The <LkFuture> of the operation, or NULL if it could not be submitted. Its result is taken with <LkFutureGetResult>, and it must be released with <LkFutureDestroy>.
+		
+	See Also:
+		<Base_LkConversion>
+		
+		<LkFutureGetResult>
+		
+		<LkSetAsyncThreadPool>
+*/
+DllEntry LkFuture* Base_LkConversionAsync(const char* const connectionInfo, const char* const expression, const char* const code, CONVERSION_TYPE conversionType, DataFormatTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout)
+{
+	uint8_t operationCode = OP_CODE_CONVERSION;
+	char* operationArguments = LkGetConversionArgs(expression, code, conversionType, customVars);
+	DataFormatTYPE inputFormat = DataFormatTYPE_MV;
+	
+	return ExecutePersistentAsync(connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout, __func__);
+}
+
+/*
+	Function: Base_LkFormatAsync
+		Returns the result of executing the FMT function in a expressions list in the Database.
+		The operation is executed in the thread pool returned by <LkGetAsyncThreadPool>, so the calling thread does not wait for the answer of the server.
+		
+	Arguments:
+		connectionInfo - String that is returned by the Login function and that contains all the necessary data of the connection.
+		expression - The data or expression to format. It can contain MV marks, in which case the conversion in each value will be executed according to the original MV mark.
+		formatSpec - Specified format.
+		outputFormat - Indicates in what format you want to receive the data resulting from the operation: MV, XML or JSON.
+		customVars - It's a free text that will travel until the database to make the admin being able to manage additional behaviours in the standard routine SUB.LK.MAIN.CONTROL.CUSTOM. This routine will be called if the argument has content.
+		receiveTimeout - It's the maximum time in seconds that the client will keep waiting the answer by the server. Values less than or equal to 0, waits indefinitely.
+		
+	Returns:
+		The <LkFuture> of the operation, or NULL if it could not be submitted. Its result is taken with <LkFutureGetResult>, and it must be released with <LkFutureDestroy>.
+		
+	See Also:
+		<Base_LkFormat>
+		
+		<LkFutureGetResult>
+		
+		<LkSetAsyncThreadPool>
+*/
+DllEntry LkFuture* Base_LkFormatAsync(const char* const connectionInfo, const char* const expression, const char* const formatSpec, DataFormatTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout)
+{
+	uint8_t operationCode = OP_CODE_FORMAT;
+	char* operationArguments = LkGetFormatArgs(expression, formatSpec, customVars);
+	DataFormatTYPE inputFormat = DataFormatTYPE_MV;
+	
+	return ExecutePersistentAsync(connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout, __func__);
+}
+
+/*
+	Function: Base_LkDictionariesAsync
+		Returns all the dictionaries of a file.
+		The operation is executed in the thread pool returned by <LkGetAsyncThreadPool>, so the calling thread does not wait for the answer of the server.
+		
+	Arguments:
+		connectionInfo - String that is returned by the Login function and that contains all the necessary data of the connection.
+		filename - File name.
+		outputFormat - Indicates in what format you want to receive the data resulting from the operation: MV, XML or JSON.
+		customVars - It's a free text that will travel until the database to make the admin being able to manage additional behaviours in the standard routine SUB.LK.MAIN.CONTROL.CUSTOM. This routine will be called if the argument has content.
+		receiveTimeout - It's the maximum time in seconds that the client will keep waiting the answer by the server. Values less than or equal to 0, waits indefinitely.
+		
+	Returns:
+		The <LkFuture> of the operation, or NULL if it could not be submitted. Its result is taken with <LkFutureGetResult>, and it must be released with <LkFutureDestroy>.
+		
+	See Also:
+		<Base_LkDictionaries>
+		
+		<LkFutureGetResult>
+		
+		<LkSetAsyncThreadPool>
+*/
+DllEntry LkFuture* Base_LkDictionariesAsync(const char* const connectionInfo, const char* const filename, DataFormatTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout)
+{
+	uint8_t operationCode = OP_CODE_DICTIONARIES;
+	char* operationArguments = LkGetDictionariesArgs(filename, customVars);
+	DataFormatTYPE inputFormat = DataFormatTYPE_MV;
+	
+	return ExecutePersistentAsync(connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout, __func__);
+}
+
+/*
+	Function: Base_LkExecuteAsync
+		Allows the execution of any command from the Database.
+		The operation is executed in the thread pool returned by <LkGetAsyncThreadPool>, so the calling thread does not wait for the answer of the server.
+		
+	Arguments:
+		connectionInfo - String that is returned by the Login function and that contains all the necessary data of the connection.
+		statement - The command you want to execute in the Database.
+		outputFormat - Indicates in what format you want to receive the data resulting from the operation: MV, XML or JSON.
+		customVars - It's a free text that will travel until the database to make the admin being able to manage additional behaviours in the standard routine SUB.LK.MAIN.CONTROL.CUSTOM. This routine will be called if the argument has content.
+		receiveTimeout - It's the maximum time in seconds that the client will keep waiting the answer by the server. Values less than or equal to 0, waits indefinitely.
+		
+	Returns:
+		The <LkFuture> of the operation, or NULL if it could not be submitted. Its result is taken with <LkFutureGetResult>, and it must be released with <LkFutureDestroy>.
+		
+	See Also:
+		<Base_LkExecute>
+		
+		<LkFutureGetResult>
+		
+		<LkSetAsyncThreadPool>
+*/
+DllEntry LkFuture* Base_LkExecuteAsync(const char* const connectionInfo, const char* const statement, DataFormatTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout)
+{
+	uint8_t operationCode = OP_CODE_EXECUTE;
+	char* operationArguments = LkGetExecuteArgs(statement, customVars);
+	DataFormatTYPE inputFormat = DataFormatTYPE_MV;
+	
+	return ExecutePersistentAsync(connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout, __func__);
+}
+
+/*
+	Function: Base_LkGetVersionAsync
+		Allows getting the server version.
+		The operation is executed in the thread pool returned by <LkGetAsyncThreadPool>, so the calling thread does not wait for the answer of the server.
+		
+	Arguments:
+		connectionInfo - String that is returned by the Login function and that contains all the necessary data of the connection.
+		outputFormat - Indicates in what format you want to receive the data resulting from the operation: MV, XML or JSON.
+		customVars - It's a free text that will travel until the database to make the admin being able to manage additional behaviours in the standard routine SUB.LK.MAIN.CONTROL.CUSTOM. This routine will be called if the argument has content.
+		receiveTimeout - It's the maximum time in seconds that the client will keep waiting the answer by the server. Values less than or equal to 0, waits indefinitely.
+		
+	Returns:
+		The <LkFuture> of the operation, or NULL if it could not be submitted. Its result is taken with <LkFutureGetResult>, and it must be released with <LkFutureDestroy>.
+		
+	See Also:
+		<Base_LkGetVersion>
+		
+		<LkFutureGetResult>
+		
+		<LkSetAsyncThreadPool>
+*/
+DllEntry LkFuture* Base_LkGetVersionAsync(const char* const connectionInfo, DataFormatTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout)
+{
+	uint8_t operationCode = OP_CODE_GETVERSION;
+	char* operationArguments = LkGetGetVersionArgs();
+	DataFormatTYPE inputFormat = DataFormatTYPE_MV;
+	
+	return ExecutePersistentAsync(connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout, __func__);
+}
+
+/*
+	Function: Base_LkSchemasAsync
+		Returns a list of all the Schemas defined in Linkar Schemas, or the EntryPoint account data files.
+		The operation is executed in the thread pool returned by <LkGetAsyncThreadPool>, so the calling thread does not wait for the answer of the server.
+		
+	Arguments:
+		connectionInfo - String that is returned by the Login function and that contains all the necessary data of the connection.
+		lkSchemasOptions - This string defines the different options in base of the asked Schema Type: LKSCHEMAS, SQLMODE o DICTIONARIES.
+		outputFormat - Indicates in what format you want to receive the data resulting from the operation: MV, XML, JSON or TABLE
+		customVars - It's a free text that will travel until the database to make the admin being able to manage additional behaviours in the standard routine SUB.LK.MAIN.CONTROL.CUSTOM. This routine will be called if the argument has content.
+		receiveTimeout - It's the maximum time in seconds that the client will keep waiting the answer by the server. Values less than or equal to 0, waits indefinitely.
+		
+	Returns:
+		The <LkFuture> of the operation, or NULL if it could not be submitted. Its result is taken with <LkFutureGetResult>, and it must be released with <LkFutureDestroy>.
+		
+	See Also:
+		<Base_LkSchemas>
+		
+		<LkFutureGetResult>
+		
+		<LkSetAsyncThreadPool>
+*/
+DllEntry LkFuture* Base_LkSchemasAsync(const char* const connectionInfo, const char* const lkSchemasOptions, DataFormatTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout)
+{
+	uint8_t operationCode = OP_CODE_LKSCHEMAS;
+	char* operationArguments = LkGetLkSchemasArgs(lkSchemasOptions, customVars);
+	DataFormatTYPE inputFormat = DataFormatTYPE_MV;
+	
+	return ExecutePersistentAsync(connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout, __func__);
+}
+
+/*
+	Function: Base_LkPropertiesAsync
+		Returns the Schema properties list defined in Linkar Schemas or the file dictionaries with MV output format.
+		The operation is executed in the thread pool returned by <LkGetAsyncThreadPool>, so the calling thread does not wait for the answer of the server.
+		
+	Arguments:
+		connectionInfo - String that is returned by the Login function and that contains all the necessary data of the connection.
+		filename - File name to LkProperties.
+		lkPropertiesOptions - This string defines the different options in base of the asked Schema Type: LKSCHEMAS, SQLMODE o DICTIONARIES.
+		outputFormat - Indicates in what format you want to receive the data resulting from the operation: MV, XML, XML_DICT, XML_SCH, JSON, JSON_DICT, JSON_SCH or TABLE
+		customVars - It's a free text that will travel until the database to make the admin being able to manage additional behaviours in the standard routine SUB.LK.MAIN.CONTROL.CUSTOM. This routine will be called if the argument has content.
+		receiveTimeout - It's the maximum time in seconds that the client will keep waiting the answer by the server. Values less than or equal to 0, waits indefinitely.
+		
+	Returns:
+		The <LkFuture> of the operation, or NULL if it could not be submitted. Its result is taken with <LkFutureGetResult>, and it must be released with <LkFutureDestroy>.
+		
+	See Also:
+		<Base_LkProperties>
+		
+		<LkFutureGetResult>
+		
+		<LkSetAsyncThreadPool>
+*/
+DllEntry LkFuture* Base_LkPropertiesAsync(const char* const connectionInfo, const char* const filename, const char* const lkPropertiesOptions, DataFormatSchPropTYPE outputFormat, const char* const customVars, uint32_t receiveTimeout)
+{
+	uint8_t operationCode = OP_CODE_LKPROPERTIES;
+	char* operationArguments = LkGetLkPropertiesArgs(filename, lkPropertiesOptions, customVars);
+	DataFormatTYPE inputFormat = DataFormatTYPE_MV;
+	
+	return ExecutePersistentAsync(connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout, __func__);
+}
+
+/*
+	Function: Base_LkGetTableAsync
+		Returns a query result in a table format.
+		The operation is executed in the thread pool returned by <LkGetAsyncThreadPool>, so the calling thread does not wait for the answer of the server.
+		
+	Arguments:
+		connectionInfo - String that is returned by the Login function and that contains all the necessary data of the connection.
+        filename - File or table name defined in Linkar Schemas. Table notation is: MainTable[.MVTable[.SVTable]]
+        selectClause - Fragment of the phrase that indicate the selection condition. For example WITH CUSTOMER = '1'
+        dictClause - Is the list of dictionaries to read, separated by space. If dictionaries are not indicated the function will read the complete buffer. For example CUSTOMER DATE ITEM. In NONE mode you may use the format LKFLDx where x is the attribute number.
+        sortClause - Fragment of the phrase that indicates the selection order. If there is a selection rule Linkar will execute a SSELECT, otherwise Linkar will execute a SELECT. For example BY CUSTOMER
+        tableOptions - Different function options: rowHeaders, rowProperties, onlyVisibe, usePropertyNames, repeatValues, applyConversion, applyFormat, calculated, pagination, regPage, numPage
+		customVars - It's a free text that will travel until the database to make the admin being able to manage additional behaviours in the standard routine SUB.LK.MAIN.CONTROL.CUSTOM. This routine will be called if the argument has content.
+		receiveTimeout - It's the maximum time in seconds that the client will keep waiting the answer by the server. Values less than or equal to 0, waits indefinitely.
+		
+	Returns:
+		The <LkFuture> of the operation, or NULL if it could not be submitted. Its result is taken with <LkFutureGetResult>, and it must be released with <LkFutureDestroy>.
+		
+	See Also:
+		<Base_LkGetTable>
+		
+		<LkFutureGetResult>
+		
+		<LkSetAsyncThreadPool>
+*/
+DllEntry LkFuture* Base_LkGetTableAsync(const char* const connectionInfo, const char* const filename, const char* const selectClause, const char* const dictClause, const char* const sortClause, const char* const tableOptions, const char* const customVars, uint32_t receiveTimeout)
+{
+	uint8_t operationCode = OP_CODE_GETTABLE;
+	char* operationArguments = LkGetGetTableArgs(filename, selectClause, dictClause, sortClause, tableOptions, customVars);
+	DataFormatTYPE inputFormat = DataFormatTYPE_MV;
+	DataFormatTYPE outputFormat = DataFormatSchTYPE_TABLE;
+	
+	return ExecutePersistentAsync(connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout, __func__);
+}
+
+/*
+	Function: Base_LkResetCommonBlocksAsync
+		Resets the COMMON variables with the 100 most used files.
+		The operation is executed in the thread pool returned by <LkGetAsyncThreadPool>, so the calling thread does not wait for the answer of the server.
+		
+	Arguments:
+		connectionInfo - String that is returned by the Login function and that contains all the necessary data of the connection.
+		outputFormat - Indicates in what format you want to receive the data resulting from the operation: MV, XML or JSON.
+		customVars - It's a free text that will travel until the database to make the admin being able to manage additional behaviours in the standard routine SUB.LK.MAIN.CONTROL.CUSTOM. This routine will be called if the argument has content.
+		receiveTimeout - It's the maximum time in seconds that the client will keep waiting the answer by the server. Values less than or equal to 0, waits indefinitely.
+		
+	Returns:
+		The <LkFuture> of the operation, or NULL if it could not be submitted. Its result is taken with <LkFutureGetResult>, and it must be released with <LkFutureDestroy>.
+		
+	See Also:
+		<Base_LkResetCommonBlocks>
+		
+		<LkFutureGetResult>
+		
+		<LkSetAsyncThreadPool>
+*/
+DllEntry LkFuture* Base_LkResetCommonBlocksAsync(const char* const connectionInfo, DataFormatTYPE outputFormat, uint32_t receiveTimeout)
+{
+	uint8_t operationCode = OP_CODE_RESETCOMMONBLOCKS;
+	char* operationArguments = LkGetResetCommonBlocksArgs();
+	DataFormatTYPE inputFormat = DataFormatTYPE_MV;
+	
+	return ExecutePersistentAsync(connectionInfo, operationCode, operationArguments, inputFormat, outputFormat, receiveTimeout, __func__);
+}
@@ -0,0 +1,887 @@
+/*
+	File: MvDynArray.c
+	This module contains the <LkDynArray> index of a dynamic array, the <LkShape> of a dynamic array, the <LkMvCursor> to walk a dynamic array element by element, and the <LkDynArrayEditor> to apply many changes to a dynamic array.
+
+	<LkExtract> scans the dynamic array from the beginning every time it is called, so extracting all the fields of a record one by one costs
+	a time proportional to the square of its length. <LkParseDynArray> scans the dynamic array only once, and keeps the position of every
+	field, value and subvalue, so all of them can be obtained in constant time, without copying them.
+*/
+
+#include "MvDynArray.h"
+#include "LinkarScan.h"
+#include "LinkarMemory.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+	The dynamic array is indexed as a list of subvalues, the items between any two marks. A value is a range of consecutive subvalues,
+	and a field is a range of consecutive values, so every level only needs the index of its first item in the next level.
+*/
+struct LkDynArray
+{
+	const char* str;
+	uint32_t length;
+	uint32_t numFields;
+	uint32_t numValues;
+	uint32_t numSubvalues;
+	uint32_t* firstValue;
+	uint32_t* firstSubvalue;
+	uint32_t* subvalueStart;
+};
+
+/*
+	Function: LkParseDynArray
+		Scans a dynamic array once, and keeps the position of every field, value and subvalue.
+		After that, they can be obtained with <LkDynArrayGet> without scanning or copying the dynamic array again.
+
+	Arguments:
+		str - The dynamic array, for example a record. It is not copied, so it must not be released while the <LkDynArray> is in use.
+		length - Length of "str". It doesn't need to be NUL terminated, so it can be a <LkStrView> returned by <LkRecordIteratorNext>.
+
+	Returns:
+		The index of the dynamic array, or NULL if there is no memory. It must be released with <LkFreeDynArray>.
+
+	Example:
+		--- Code
+		LkDynArray* dynArray = LkParseDynArray(record.str, record.length);
+		uint32_t numFields = LkDynArrayCount(dynArray, 0, 0);
+		for(int field=1; field<=numFields; field++)
+		{
+			LkStrView item;
+			LkDynArrayGet(dynArray, field, 0, 0, &item);
+			printf("%d: %.*s\r\n", field, item.length, item.str);
+		}
+		LkFreeDynArray(dynArray);
+		---
+
+	Also See:
+		<LkDynArrayGet>
+
+		<LkFreeDynArray>
+*/
+DllEntry LkDynArray* LkParseDynArray(const char* const str, uint32_t length)
+{
+	const char marks[3] = { DBMV_Mark_AM, DBMV_Mark_VM, DBMV_Mark_SM };
+	const char* source = str ? str : "";
+	if(str == NULL)
+		length = 0;
+
+	uint32_t numAM = LkScanCountByte(source, length, DBMV_Mark_AM);
+	uint32_t numVM = LkScanCountByte(source, length, DBMV_Mark_VM);
+	uint32_t numSM = LkScanCountByte(source, length, DBMV_Mark_SM);
+
+	uint32_t numFields = numAM + 1;
+	uint32_t numValues = numFields + numVM;
+	uint32_t numSubvalues = numValues + numSM;
+	LkDynArray* dynArray = LkMallocFrom(sizeof(LkDynArray) + ((uint64_t)numFields + numValues + numSubvalues + 3) * sizeof(uint32_t), __func__);
+	if(dynArray == NULL)
+		return NULL;
+
+	dynArray->str = source;
+	dynArray->length = length;
+	dynArray->numFields = numFields;
+	dynArray->numValues = numValues;
+	dynArray->numSubvalues = numSubvalues;
+	dynArray->firstValue = (uint32_t*)(dynArray + 1);
+	dynArray->firstSubvalue = dynArray->firstValue + numFields + 1;
+	dynArray->subvalueStart = dynArray->firstSubvalue + numValues + 1;
+
+	uint32_t field = 0;
+	uint32_t value = 0;
+	uint32_t subvalue = 0;
+	dynArray->firstValue[0] = 0;
+	dynArray->firstSubvalue[0] = 0;
+	dynArray->subvalueStart[0] = 0;
+
+	// Every mark starts a new subvalue, and the VM and AM marks start a new value too
+	const char* end = source + length;
+	const char* mark = source;
+	while((mark = LkScanFindAny(mark, end - mark, marks, 3)) != NULL)
+	{
+		dynArray->subvalueStart[++subvalue] = mark - source + 1;
+		if(*mark != DBMV_Mark_SM)
+		{
+			dynArray->firstSubvalue[++value] = subvalue;
+			if(*mark == DBMV_Mark_AM)
+				dynArray->firstValue[++field] = value;
+		}
+		mark++;
+	}
+
+	// The end of the last item, as if there was a mark after the dynamic array
+	dynArray->firstValue[numFields] = numValues;
+	dynArray->firstSubvalue[numValues] = numSubvalues;
+	dynArray->subvalueStart[numSubvalues] = length + 1;
+
+	return dynArray;
+}
+
+/*
+	Function: LkDynArrayCount
+		Counts the fields of a dynamic array, the values of a field or the subvalues of a value, like <LkDCount> does with the extracted items.
+
+	Arguments:
+		dynArray - The index returned by <LkParseDynArray>.
+		field - The field position, or 0 to count the fields.
+		value - The value position, or 0 to count the values of the field.
+
+	Returns:
+		The number of items. An empty item counts as one item. 0 if the field or value doesn't exist.
+*/
+DllEntry uint32_t LkDynArrayCount(const LkDynArray* const dynArray, int32_t field, int32_t value)
+{
+	if(dynArray == NULL || field < 0)
+		return 0;
+	if(field == 0)
+		return dynArray->numFields;
+	if((uint32_t)field > dynArray->numFields)
+		return 0;
+
+	uint32_t firstValue = dynArray->firstValue[field - 1];
+	uint32_t numValues = dynArray->firstValue[field] - firstValue;
+	if(value <= 0)
+		return value == 0 ? numValues : 0;
+	if((uint32_t)value > numValues)
+		return 0;
+
+	return dynArray->firstSubvalue[firstValue + value] - dynArray->firstSubvalue[firstValue + value - 1];
+}
+
+/*
+	Function: LkDynArrayGet
+		Gets a field, value or subvalue of a dynamic array previously indexed with <LkParseDynArray>, as a view into the dynamic array.
+		Like <LkExtract>, a value 0 gets the whole field, and a subvalue 0 gets the whole value.
+
+	Arguments:
+		dynArray - The index returned by <LkParseDynArray>.
+		field - The field position. It must be greater than 0.
+		value - The value position, or 0 for the whole field.
+		subvalue - The subvalue position, or 0 for the whole value.
+		item - Output argument with the position and length of the item inside the dynamic array. It is not NUL terminated.
+
+	Returns:
+		TRUE if the item exists, FALSE otherwise. When FALSE is returned, "item" is set to an empty view.
+
+	Also See:
+		<LkParseDynArray>
+*/
+DllEntry BOOL LkDynArrayGet(const LkDynArray* const dynArray, int32_t field, int32_t value, int32_t subvalue, LkStrView* item)
+{
+	item->str = "";
+	item->length = 0;
+	if(dynArray == NULL || field <= 0 || (uint32_t)field > dynArray->numFields)
+		return FALSE;
+
+	// The item is a range of subvalues, that is narrowed at every level
+	uint32_t first = dynArray->firstSubvalue[dynArray->firstValue[field - 1]];
+	uint32_t last = dynArray->firstSubvalue[dynArray->firstValue[field]];
+	if(value > 0)
+	{
+		uint32_t firstValue = dynArray->firstValue[field - 1];
+		if((uint32_t)value > dynArray->firstValue[field] - firstValue)
+			return FALSE;
+		first = dynArray->firstSubvalue[firstValue + value - 1];
+		last = dynArray->firstSubvalue[firstValue + value];
+
+		if(subvalue > 0)
+		{
+			if((uint32_t)subvalue > last - first)
+				return FALSE;
+			first += subvalue - 1;
+			last = first + 1;
+		}
+	}
+
+	uint32_t start = dynArray->subvalueStart[first];
+	item->str = dynArray->str + start;
+	item->length = dynArray->subvalueStart[last] - 1 - start;
+	return TRUE;
+}
+
+/*
+	Function: LkFreeDynArray
+		Releases the index created by <LkParseDynArray>. The indexed dynamic array is not released.
+
+	Arguments:
+		dynArray - The index returned by <LkParseDynArray>.
+
+	Also See:
+		<Release Memory>
+*/
+DllEntry void LkFreeDynArray(LkDynArray* dynArray)
+{
+	LkFree(dynArray);
+}
+
+/*
+	Function: LkShape
+		Counts the fields of a dynamic array, the values of every field and the subvalues of every value.
+		The AM and VM marks are counted first to allocate the result in only one block, and then all the marks are found in one pass with <LkScanFindAny>.
+		Nothing is copied, so it is a cheap way of knowing the size of a grid before extracting its cells.
+
+	Arguments:
+		str - The dynamic array, for example a record.
+		length - Length of "str". It doesn't need to be NUL terminated.
+
+	Returns:
+		The shape of the dynamic array, or NULL if there is no memory. It must be released with <LkFreeShape>.
+
+	Example:
+		--- Code
+		LkDynArrayShape* shape = LkShape(record, strlen(record));
+		for(int field=0; field<shape->numFields; field++)
+		{
+			printf("Field %d: %u values\r\n", field + 1, shape->valuesPerField[field]);
+			for(int value=0; value<shape->valuesPerField[field]; value++)
+				printf("  Value %d: %u subvalues\r\n", value + 1, shape->subvaluesPerValue[shape->firstValue[field] + value]);
+		}
+		LkFreeShape(shape);
+		---
+
+	Also See:
+		<LkFreeShape>
+*/
+DllEntry LkDynArrayShape* LkShape(const char* const str, uint32_t length)
+{
+	const char marks[3] = { DBMV_Mark_AM, DBMV_Mark_VM, DBMV_Mark_SM };
+	const char* source = str ? str : "";
+	if(str == NULL)
+		length = 0;
+
+	uint32_t numFields = LkScanCountByte(source, length, DBMV_Mark_AM) + 1;
+	uint32_t numValues = numFields + LkScanCountByte(source, length, DBMV_Mark_VM);
+	LkDynArrayShape* shape = LkMallocFrom(sizeof(LkDynArrayShape) + ((uint64_t)numFields * 2 + numValues) * sizeof(uint32_t), __func__);
+	if(shape == NULL)
+		return NULL;
+
+	shape->numFields = numFields;
+	shape->numValues = numValues;
+	shape->valuesPerField = (uint32_t*)(shape + 1);
+	shape->firstValue = shape->valuesPerField + numFields;
+	shape->subvaluesPerValue = shape->firstValue + numFields;
+
+	uint32_t field = 0;
+	uint32_t value = 0;
+	shape->valuesPerField[0] = 1;
+	shape->firstValue[0] = 0;
+	shape->subvaluesPerValue[0] = 1;
+
+	// Every mark adds an item to its level, and starts a new item with one item in every lower level
+	const char* end = source + length;
+	const char* mark = source;
+	while((mark = LkScanFindAny(mark, end - mark, marks, 3)) != NULL)
+	{
+		if(*mark == DBMV_Mark_SM)
+			shape->subvaluesPerValue[value]++;
+		else
+		{
+			shape->subvaluesPerValue[++value] = 1;
+			if(*mark == DBMV_Mark_VM)
+				shape->valuesPerField[field]++;
+			else
+			{
+				shape->valuesPerField[++field] = 1;
+				shape->firstValue[field] = value;
+			}
+		}
+		mark++;
+	}
+
+	uint32_t i;
+	shape->maxValues = 0;
+	for(i = 0; i < numFields; i++)
+		if(shape->valuesPerField[i] > shape->maxValues)
+			shape->maxValues = shape->valuesPerField[i];
+	shape->maxSubvalues = 0;
+	for(i = 0; i < numValues; i++)
+		if(shape->subvaluesPerValue[i] > shape->maxSubvalues)
+			shape->maxSubvalues = shape->subvaluesPerValue[i];
+
+	return shape;
+}
+
+/*
+	Function: LkFreeShape
+		Releases the shape of a dynamic array returned by <LkShape>.
+
+	Arguments:
+		shape - The shape to release.
+
+	Also See:
+		<Release Memory>
+*/
+DllEntry void LkFreeShape(LkDynArrayShape* shape)
+{
+	LkFree(shape);
+}
+
+/*
+	Function: LkMvCursorInit
+		Prepares a <LkMvCursor> to walk a dynamic array element by element with <LkMvCursorNext>, like the REMOVE statement of MV BASIC.
+		Nothing is allocated, so the cursor can be a local variable, and it can be initialized again to walk another dynamic array.
+
+	Arguments:
+		cursor - The cursor to initialize.
+		str - The dynamic array, for example a record. It is not copied, so it must not be released while the cursor is in use.
+		length - Length of "str". It doesn't need to be NUL terminated.
+
+	Example:
+		--- Code
+		LkMvCursor cursor;
+		LkStrView item;
+		uint8_t delimiter;
+		LkMvCursorInit(&cursor, record, strlen(record));
+		while(LkMvCursorNext(&cursor, &item, &delimiter))
+			printf("%u.%u.%u: %.*s\r\n", cursor.field, cursor.value, cursor.subvalue, item.length, item.str);
+		---
+
+	Also See:
+		<LkMvCursorNext>
+*/
+DllEntry void LkMvCursorInit(LkMvCursor* cursor, const char* const str, uint32_t length)
+{
+	cursor->str = str ? str : "";
+	cursor->length = str ? length : 0;
+	cursor->position = 0;
+	cursor->field = 0;
+	cursor->value = 0;
+	cursor->subvalue = 0;
+	cursor->delimiter = LkMvCursor_FIRST;
+}
+
+/*
+	Function: LkMvCursorNext
+		Gets the next element of the dynamic array of a <LkMvCursor>, and the mark found after it.
+		Every call continues from the end of the previous element, so walking the whole dynamic array costs a time proportional to its length,
+		instead of the square of its length of calling <LkExtract> for every field, value and subvalue.
+
+	Arguments:
+		cursor - The cursor initialized with <LkMvCursorInit>.
+		item - Output argument with the element, as a view into the dynamic array. It is not NUL terminated.
+		delimiter - Output argument with the mark found after the element: <LkMvCursor_IM>, <LkMvCursor_AM>, <LkMvCursor_VM>, <LkMvCursor_SM>, <LkMvCursor_TM>,
+		or <LkMvCursor_END> for the last element. It can be NULL.
+
+	Returns:
+		TRUE if an element was obtained, FALSE if the last element was already obtained. A dynamic array with n marks has n + 1 elements,
+		so an empty dynamic array has one empty element.
+
+		The "field", "value" and "subvalue" of the cursor are the position of the element obtained, starting with 1.
+		The <DBMV_Mark_IM> starts a new field like the <DBMV_Mark_AM>, and the <DBMV_Mark_TM> doesn't change the position.
+
+	Also See:
+		<LkMvCursorInit>
+*/
+DllEntry BOOL LkMvCursorNext(LkMvCursor* cursor, LkStrView* item, uint8_t* delimiter)
+{
+	const char marks[5] = { DBMV_Mark_IM, DBMV_Mark_AM, DBMV_Mark_VM, DBMV_Mark_SM, DBMV_Mark_TM };
+
+	// The position of the element depends on the mark that ends the previous element
+	switch(cursor->delimiter)
+	{
+		case LkMvCursor_END:
+			return FALSE;
+		case LkMvCursor_FIRST:
+		case LkMvCursor_IM:
+		case LkMvCursor_AM:
+			cursor->field++;
+			cursor->value = 1;
+			cursor->subvalue = 1;
+			break;
+		case LkMvCursor_VM:
+			cursor->value++;
+			cursor->subvalue = 1;
+			break;
+		case LkMvCursor_SM:
+			cursor->subvalue++;
+			break;
+	}
+
+	const char* start = cursor->str + cursor->position;
+	const char* mark = LkScanFindAny(start, cursor->length - cursor->position, marks, 5);
+	item->str = start;
+	if(mark == NULL)
+	{
+		item->length = cursor->length - cursor->position;
+		cursor->position = cursor->length;
+		cursor->delimiter = LkMvCursor_END;
+	}
+	else
+	{
+		item->length = mark - start;
+		cursor->position += item->length + 1;
+		// The marks go from IM (0xFF) down to TM (0xFB), and their codes from 1 up to 5
+		cursor->delimiter = (uint8_t)(DBMV_Mark_IM - *mark) + LkMvCursor_IM;
+	}
+
+	if(delimiter)
+		*delimiter = cursor->delimiter;
+	return TRUE;
+}
+
+/*
+	The editor keeps the fields of the dynamic array as an array of views. The fields not modified point into the original dynamic array,
+	and the modified ones point to new strings allocated in the arena of the editor. An edit only rebuilds the field it changes,
+	inserting or deleting a field only moves the views of the next fields, and the whole dynamic array is copied only once by <LkDynArrayEditorToString>.
+*/
+struct LkDynArrayEditor
+{
+	LkArena* arena;
+	LkStrView* fields;
+	uint32_t numFields;
+	uint32_t capacity;
+};
+
+#define EDIT_REPLACE 0
+#define EDIT_INSERT 1
+#define EDIT_DELETE 2
+
+/*
+	Function: FindListItem
+		Helper function for the <LkDynArrayEditor> that finds an item of a string whose items are separated by "delim".
+
+	Arguments:
+		list - The string.
+		delim - The separator of the items.
+		position - The 1-based position of the item.
+		item - Output argument with the item. If it doesn't exist, an empty item at the end of "list".
+
+	Returns:
+		The number of items of "list", if the item doesn't exist. 0 if it exists.
+*/
+static uint32_t FindListItem(LkStrView list, char delim, uint32_t position, LkStrView* item)
+{
+	const char* end = list.str + list.length;
+	const char* start = list.str;
+	uint32_t i;
+	for(i = 1; i < position; i++)
+	{
+		const char* itemEnd = LkScanFindByte(start, end - start, delim);
+		if(itemEnd == NULL)
+		{
+			item->str = end;
+			item->length = 0;
+			return i;
+		}
+		start = itemEnd + 1;
+	}
+
+	const char* itemEnd = LkScanFindByte(start, end - start, delim);
+	item->str = start;
+	item->length = (itemEnd ? itemEnd : end) - start;
+	return 0;
+}
+
+/*
+	Function: EditList
+		Helper function for the <LkDynArrayEditor> that replaces, inserts or deletes an item of a string whose items are separated by "delim".
+		The result is a new string allocated in the arena, or "list" itself if nothing changes.
+
+	Arguments:
+		arena - The arena of the editor.
+		list - The string.
+		delim - The separator of the items.
+		position - The 1-based position of the item, or a negative number to append a new item at the end.
+		operation - EDIT_REPLACE, EDIT_INSERT or EDIT_DELETE.
+		newVal - The new item.
+		result - Output argument with the new string.
+
+	Returns:
+		TRUE on success, FALSE if there is no memory.
+*/
+static BOOL EditList(LkArena* arena, LkStrView list, char delim, int32_t position, int operation, LkStrView newVal, LkStrView* result)
+{
+	*result = list;
+
+	// The new item is placed between "start" and "end", after "numDelims" delimiters and before "delimAfter"
+	LkStrView item;
+	uint32_t start, end, numDelims = 0;
+	BOOL delimAfter = FALSE;
+	if(position < 0)
+	{
+		if(operation == EDIT_DELETE)
+			return TRUE;
+		start = end = list.length;
+		numDelims = list.length > 0 ? 1 : 0;
+	}
+	else
+	{
+		uint32_t numItems = FindListItem(list, delim, position, &item);
+		if(numItems > 0 && operation == EDIT_DELETE)
+			return TRUE;
+
+		start = item.str - list.str;
+		end = numItems > 0 || operation == EDIT_INSERT ? start : start + item.length;
+		numDelims = numItems > 0 ? position - numItems : 0;
+		if(list.length == 0)
+		{
+			// An empty string has no items, so the new item is not followed by the empty one
+			end = 0;
+			numDelims = position - 1;
+		}
+		else if(operation == EDIT_INSERT && numItems == 0)
+			delimAfter = TRUE;
+		else if(operation == EDIT_DELETE)
+		{
+			// The delimiter after the item is deleted too, or the one before it if it is the last item
+			if(end < list.length)
+				end++;
+			else if(start > 0)
+				start--;
+			newVal.length = 0;
+		}
+	}
+
+	uint32_t length = start + numDelims + newVal.length + (delimAfter ? 1 : 0) + (list.length - end);
+	char* str = LkArenaAlloc(arena, length + 1);
+	if(str == NULL)
+		return FALSE;
+
+	char* p = str;
+	memcpy(p, list.str, start);
+	p += start;
+	memset(p, delim, numDelims);
+	p += numDelims;
+	if(newVal.length > 0)
+		memcpy(p, newVal.str, newVal.length);
+	p += newVal.length;
+	if(delimAfter)
+		*p++ = delim;
+	memcpy(p, list.str + end, list.length - end);
+	str[length] = 0;
+
+	result->str = str;
+	result->length = length;
+	return TRUE;
+}
+
+/*
+	Function: EditField
+		Helper function for the <LkDynArrayEditor> that replaces, inserts or deletes a value or subvalue of a field.
+
+	Arguments:
+		arena - The arena of the editor.
+		field - The field.
+		value - The value position, or a negative number to append a new value.
+		subvalue - The subvalue position, 0 to work with the whole value, or a negative number to append a new subvalue.
+		operation - EDIT_REPLACE, EDIT_INSERT or EDIT_DELETE.
+		newVal - The new value or subvalue.
+		result - Output argument with the new field.
+
+	Returns:
+		TRUE on success, FALSE if there is no memory.
+*/
+static BOOL EditField(LkArena* arena, LkStrView field, int32_t value, int32_t subvalue, int operation, LkStrView newVal, LkStrView* result)
+{
+	if(value < 0 || subvalue == 0)
+		return EditList(arena, field, DBMV_Mark_VM, value, operation, newVal, result);
+
+	LkStrView item;
+	if(FindListItem(field, DBMV_Mark_VM, value, &item) > 0 && operation == EDIT_DELETE)
+	{
+		*result = field;
+		return TRUE;
+	}
+
+	LkStrView newItem;
+	return EditList(arena, item, DBMV_Mark_SM, subvalue, operation, newVal, &newItem) &&
+		EditList(arena, field, DBMV_Mark_VM, value, EDIT_REPLACE, newItem, result);
+}
+
+/*
+	Function: ReserveFields
+		Helper function for the <LkDynArrayEditor> that makes sure there is room for some more fields. The capacity is doubled every time it grows.
+
+	Arguments:
+		editor - The editor.
+		numFields - The number of fields that will be needed.
+
+	Returns:
+		TRUE if there is room, FALSE if there is no memory.
+*/
+static BOOL ReserveFields(LkDynArrayEditor* editor, uint32_t numFields)
+{
+	if(numFields <= editor->capacity)
+		return TRUE;
+
+	uint32_t capacity = editor->capacity * 2;
+	if(capacity < numFields)
+		capacity = numFields;
+	LkStrView* fields = LkReallocFrom(editor->fields, (uint64_t)capacity * sizeof(LkStrView), "LkDynArrayEditorCreate");
+	if(fields == NULL)
+		return FALSE;
+
+	editor->fields = fields;
+	editor->capacity = capacity;
+	return TRUE;
+}
+
+/*
+	Function: EditDynArray
+		Helper function for the <LkDynArrayEditor> that applies one operation at the field level, or to the field that contains the value or subvalue.
+
+	Arguments:
+		editor - The editor.
+		field - The field position.
+		value - The value position.
+		subvalue - The subvalue position.
+		operation - EDIT_REPLACE, EDIT_INSERT or EDIT_DELETE.
+		newVal - The new field, value or subvalue.
+
+	Returns:
+		TRUE on success, FALSE if there is no memory.
+*/
+static BOOL EditDynArray(LkDynArrayEditor* editor, int32_t field, int32_t value, int32_t subvalue, int operation, const char* const newVal)
+{
+	LkStrView newItem = { "", 0 };
+	if(newVal != NULL && operation != EDIT_DELETE)
+	{
+		newItem.length = strlen(newVal);
+		newItem.str = LkArenaCopy(editor->arena, newVal, newItem.length);
+		if(newItem.str == NULL)
+			return FALSE;
+	}
+
+	BOOL empty = editor->numFields == 1 && editor->fields[0].length == 0;
+	if(field == 0)
+		field = 1;
+
+	if(operation == EDIT_DELETE)
+	{
+		if(field < 0 || (uint32_t)field > editor->numFields)
+			return TRUE;
+		if(value != 0)
+			return EditField(editor->arena, editor->fields[field - 1], value, subvalue, operation, newItem, &editor->fields[field - 1]);
+
+		memmove(editor->fields + field - 1, editor->fields + field, (editor->numFields - field) * sizeof(LkStrView));
+		editor->numFields--;
+		if(editor->numFields == 0)
+		{
+			editor->fields[0].str = "";
+			editor->fields[0].length = 0;
+			editor->numFields = 1;
+		}
+		return TRUE;
+	}
+
+	// A new field at the end. Like LkReplace, the values are not taken into account
+	if(field < 0)
+	{
+		if(operation == EDIT_INSERT && empty)
+		{
+			editor->fields[0] = newItem;
+			return TRUE;
+		}
+		if(!ReserveFields(editor, editor->numFields + 1))
+			return FALSE;
+		editor->fields[editor->numFields++] = newItem;
+		return TRUE;
+	}
+
+	// The missing fields are created empty
+	uint32_t numFields = editor->numFields;
+	if((uint32_t)field > numFields)
+	{
+		if(!ReserveFields(editor, field))
+			return FALSE;
+		for(; editor->numFields < (uint32_t)field; editor->numFields++)
+		{
+			editor->fields[editor->numFields].str = "";
+			editor->fields[editor->numFields].length = 0;
+		}
+	}
+
+	LkStrView* target = &editor->fields[field - 1];
+	if(value != 0)
+		return EditField(editor->arena, *target, value, subvalue, operation, newItem, target);
+
+	if(operation == EDIT_INSERT && !empty && (uint32_t)field <= numFields)
+	{
+		if(!ReserveFields(editor, editor->numFields + 1))
+			return FALSE;
+		target = &editor->fields[field - 1];
+		memmove(target + 1, target, (editor->numFields - field + 1) * sizeof(LkStrView));
+		editor->numFields++;
+	}
+	*target = newItem;
+	return TRUE;
+}
+
+/*
+	Function: LkDynArrayEditorCreate
+		Creates an editor to apply many changes to a dynamic array, and build the final dynamic array only once.
+		Every <LkReplace> call splits and copies the whole dynamic array. With the editor, every change only rebuilds the field where it is applied,
+		and the whole dynamic array is copied once at the end by <LkDynArrayEditorToString>.
+
+	Arguments:
+		str - The dynamic array, for example a record. It is not copied, so it must not be released while the editor is in use.
+		length - Length of "str". It doesn't need to be NUL terminated.
+
+	Returns:
+		The new editor, or NULL if there is no memory. It must be released with <LkDynArrayEditorDestroy>.
+
+	Example:
+		--- Code
+		LkDynArrayEditor* editor = LkDynArrayEditorCreate(record, strlen(record));
+		LkDynArrayEditorReplace(editor, "CUSTOMER UPDATE", 1, 0, 0);
+		LkDynArrayEditorInsert(editor, "2024-01-01", 10, 1, 0); // A new first value in the history of the field 10
+		LkDynArrayEditorDelete(editor, 5, 0, 0);
+		char* newRecord = LkDynArrayEditorToString(editor);
+		LkDynArrayEditorDestroy(editor);
+		...
+		LkFree(newRecord);
+		---
+
+	Also See:
+		<LkDynArrayEditorToString>
+
+		<LkDynArrayEditorDestroy>
+*/
+DllEntry LkDynArrayEditor* LkDynArrayEditorCreate(const char* const str, uint32_t length)
+{
+	const char* source = str ? str : "";
+	if(str == NULL)
+		length = 0;
+
+	LkDynArrayEditor* editor = LkCallocFrom(1, sizeof(LkDynArrayEditor), __func__);
+	if(editor == NULL)
+		return NULL;
+
+	editor->arena = LkArenaCreate(0);
+	if(editor->arena == NULL || !ReserveFields(editor, LkScanCountByte(source, length, DBMV_Mark_AM) + 1))
+	{
+		LkDynArrayEditorDestroy(editor);
+		return NULL;
+	}
+
+	const char* end = source + length;
+	const char* field = source;
+	while(1)
+	{
+		const char* fieldEnd = LkScanFindByte(field, end - field, DBMV_Mark_AM);
+		editor->fields[editor->numFields].str = field;
+		editor->fields[editor->numFields].length = (fieldEnd ? fieldEnd : end) - field;
+		editor->numFields++;
+		if(fieldEnd == NULL)
+			break;
+		field = fieldEnd + 1;
+	}
+
+	return editor;
+}
+
+/*
+	Function: LkDynArrayEditorReplace
+		Replaces a field, value or subvalue of the dynamic array of a <LkDynArrayEditor>, like <LkReplace> does.
+
+	Arguments:
+		editor - The editor created by <LkDynArrayEditorCreate>.
+		newVal - The new value.
+		field - The field position. A negative number appends a new field.
+		value - The value position, 0 to replace the whole field, or a negative number to append a new value.
+		subvalue - The subvalue position, 0 to replace the whole value, or a negative number to append a new subvalue.
+
+	Returns:
+		TRUE on success, FALSE if there is no memory.
+*/
+DllEntry BOOL LkDynArrayEditorReplace(LkDynArrayEditor* editor, const char* const newVal, int32_t field, int32_t value, int32_t subvalue)
+{
+	return EditDynArray(editor, field, value, subvalue, EDIT_REPLACE, newVal);
+}
+
+/*
+	Function: LkDynArrayEditorInsert
+		Inserts a new field, value or subvalue in the dynamic array of a <LkDynArrayEditor>, before the one in the given position.
+		The missing items before the position are created empty.
+
+	Arguments:
+		editor - The editor created by <LkDynArrayEditorCreate>.
+		newVal - The new item.
+		field - The field position. A negative number inserts the new field at the end.
+		value - The value position, 0 to insert a field, or a negative number to insert the new value at the end of the field.
+		subvalue - The subvalue position, 0 to insert a value, or a negative number to insert the new subvalue at the end of the value.
+
+	Returns:
+		TRUE on success, FALSE if there is no memory.
+*/
+DllEntry BOOL LkDynArrayEditorInsert(LkDynArrayEditor* editor, const char* const newVal, int32_t field, int32_t value, int32_t subvalue)
+{
+	return EditDynArray(editor, field, value, subvalue, EDIT_INSERT, newVal);
+}
+
+/*
+	Function: LkDynArrayEditorDelete
+		Deletes a field, value or subvalue of the dynamic array of a <LkDynArrayEditor>, with its delimiter. Nothing is done if it doesn't exist.
+
+	Arguments:
+		editor - The editor created by <LkDynArrayEditorCreate>.
+		field - The field position.
+		value - The value position, or 0 to delete the whole field.
+		subvalue - The subvalue position, or 0 to delete the whole value.
+
+	Returns:
+		TRUE on success, FALSE if there is no memory.
+*/
+DllEntry BOOL LkDynArrayEditorDelete(LkDynArrayEditor* editor, int32_t field, int32_t value, int32_t subvalue)
+{
+	return EditDynArray(editor, field, value, subvalue, EDIT_DELETE, NULL);
+}
+
+/*
+	Function: LkDynArrayEditorToString
+		Builds the dynamic array of a <LkDynArrayEditor> with all the changes applied. The editor can still be used after that.
+
+	Arguments:
+		editor - The editor created by <LkDynArrayEditorCreate>.
+
+	Returns:
+		The new dynamic array, or NULL if there is no memory. It must be released with <LkFree>.
+
+	Also See:
+		<Release Memory>
+*/
+DllEntry char* LkDynArrayEditorToString(const LkDynArrayEditor* const editor)
+{
+	uint64_t length = editor->numFields - 1;
+	uint32_t i;
+	for(i = 0; i < editor->numFields; i++)
+		length += editor->fields[i].length;
+	if(length >= UINT32_MAX)
+		return NULL;
+
+	char* result = LkMallocFrom((size_t)length + 1, __func__);
+	if(result == NULL)
+		return NULL;
+
+	char* p = result;
+	for(i = 0; i < editor->numFields; i++)
+	{
+		if(i > 0)
+			*p++ = DBMV_Mark_AM;
+		memcpy(p, editor->fields[i].str, editor->fields[i].length);
+		p += editor->fields[i].length;
+	}
+	*p = 0;
+
+	return result;
+}
+
+/*
+	Function: LkDynArrayEditorDestroy
+		Releases a <LkDynArrayEditor> and all the memory used by its changes. The original dynamic array is not released.
+
+	Arguments:
+		editor - The editor created by <LkDynArrayEditorCreate>.
+
+	Also See:
+		<Release Memory>
+*/
+DllEntry void LkDynArrayEditorDestroy(LkDynArrayEditor* editor)
+{
+	if(editor == NULL)
+		return;
+
+	LkArenaDestroy(editor->arena);
+	LkFree(editor->fields);
+	LkFree(editor);
+}
@@ -9,6 +9,7 @@
 
 #include "MvOperations.h"
 #include "LinkarStringsHelper.h"
+#include "LinkarScan.h"
 
 #include <malloc.h>
 #include <string.h>
@@ -33,16 +34,7 @@
 DllEntry uint32_t LkCount(const char* const str, char delimiter)
 {
 	if(str)
-	{
-		uint32_t len = strlen(str);
-		uint32_t count = 0;
-		int i;
-		for(i=0; i<len; i++)
-			if(str[i] == delimiter)
-				count++;
-
-		return count;
-	}
+		return LkScanCountByte(str, strlen(str), delimiter);
 	else
 		return 0;
 }
@@ -69,6 +61,301 @@ DllEntry uint32_t LkDCount(const char* const str, char delimiter)
 	return LkCount(str, delimiter) + 1;
 }
 
+/*
+	Function: MvAlloc
+		Helper function that allocates the result of a function in an arena, or with the allocator of the library if there is no arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>, or NULL.
+		size - Number of bytes to allocate.
+		entryPoint - Name of the function that requests the memory, for <LkSetMemoryAccounting>.
+
+	Returns:
+		Pointer to the allocated memory.
+*/
+static void* MvAlloc(LkArena* arena, uint32_t size, const char* const entryPoint)
+{
+	if(arena)
+		return LkArenaAlloc(arena, size);
+	else
+		return LkMallocFrom(size, entryPoint);
+}
+
+/*
+	Function: MvFindItem
+		Helper function that finds an item of a string whose items are separated by "delim", without copying it.
+
+	Arguments:
+		str - The string where the item is searched. It can be a field or a value inside a dynamic array.
+		length - Length of "str".
+		delim - The separator of the items.
+		position - The 1-based position of the item.
+		span - Output argument with the position and length of the item inside "str". If the item doesn't exist, it is an empty item at the end of "str".
+
+	Returns:
+		0 if the item exists. Otherwise, the number of delimiters that must be added at the end of "str" to create it.
+*/
+static uint32_t MvFindItem(const char* const str, uint32_t length, char delim, int32_t position, LkSpan* span)
+{
+	const char* end = str + length;
+	const char* item = str;
+	int32_t i;
+	for(i = 1; i < position; i++)
+	{
+		const char* itemEnd = LkScanFindByte(item, end - item, delim);
+		if(itemEnd == NULL)
+		{
+			span->offset = length;
+			span->length = 0;
+			return position - i;
+		}
+		item = itemEnd + 1;
+	}
+
+	const char* itemEnd = LkScanFindByte(item, end - item, delim);
+	span->offset = item - str;
+	span->length = (itemEnd ? itemEnd : end) - item;
+	return 0;
+}
+
+/*
+	Function: MvLocateForExtract
+		Helper function for <LkExtract> that finds a field, value or subvalue of a dynamic array, without copying it.
+		Like <LkExtract>, the positions lower than 1 at the beginning are skipped, so field 0 and value 2 is the second value of the whole string.
+
+	Arguments:
+		str - The dynamic array.
+		length - Length of "str".
+		field - The field position.
+		value - The value position.
+		subvalue - The subvalue position.
+		span - Output argument with the position and length of the item inside "str". It is empty if the item doesn't exist.
+
+	Returns:
+		FALSE if none of the positions is greater than 0, TRUE otherwise.
+*/
+static BOOL MvLocateForExtract(const char* const str, uint32_t length, int32_t field, int32_t value, int32_t subvalue, LkSpan* span)
+{
+	const char marks[3] = { DBMV_Mark_AM, DBMV_Mark_VM, DBMV_Mark_SM };
+	int32_t positions[3] = { field, value, subvalue };
+
+	int level = 0;
+	while(level < 3 && positions[level] <= 0)
+		level++;
+	if(level == 3)
+		return FALSE;
+
+	span->offset = 0;
+	span->length = length;
+	for(; level < 3 && positions[level] > 0; level++)
+	{
+		LkSpan item;
+		if(MvFindItem(str + span->offset, span->length, marks[level], positions[level], &item) > 0)
+		{
+			span->offset = length;
+			span->length = 0;
+			return TRUE;
+		}
+		span->offset += item.offset;
+		span->length = item.length;
+	}
+
+	return TRUE;
+}
+
+/*
+	Struct: MvLocation
+		Result of <MvLocateForUpdate>: the part of the dynamic array that is replaced, the marks that must be added before the new value,
+		and the list of items (the whole string, a field or a value) where the new value is placed.
+		The insertMark is only used by <LkInsert>, to separate the new value from the item that was in its position.
+*/
+typedef struct
+{
+	uint32_t start;
+	uint32_t end;
+	uint32_t numMarks[3];
+	char appendMark;
+	char insertMark;
+	LkSpan list;
+} MvLocation;
+
+/*
+	Function: MvLocateForUpdate
+		Helper function for <LkReplace> that finds where a new value must be placed inside a dynamic array.
+		A position 0 replaces the whole field or value, and a negative position appends the new value at the end of the field or value.
+		When the position doesn't exist, the number of AM, VM and SM marks that must be added to create it is returned.
+
+	Arguments:
+		str - The dynamic array.
+		length - Length of "str".
+		field - The field position.
+		value - The value position.
+		subvalue - The subvalue position.
+		location - Output argument with the location of the new value.
+*/
+static void MvLocateForUpdate(const char* const str, uint32_t length, int32_t field, int32_t value, int32_t subvalue, MvLocation* location)
+{
+	const char marks[3] = { DBMV_Mark_AM, DBMV_Mark_VM, DBMV_Mark_SM };
+	int32_t positions[3] = { field, value, subvalue };
+
+	memset(location, 0, sizeof(MvLocation));
+	if(field < 0)
+	{
+		// A new field is always added at the end of the string
+		location->start = length;
+		location->end = length;
+		location->appendMark = DBMV_Mark_AM;
+		return;
+	}
+	if(positions[0] == 0)
+		positions[0] = 1;
+
+	LkSpan container = { 0, length };
+	int level;
+	for(level = 0; level < 3 && positions[level] != 0; level++)
+	{
+		if(positions[level] < 0)
+		{
+			// Appended as a new value or subvalue, unless the field or value is empty
+			location->start = container.offset + container.length;
+			location->end = location->start;
+			if(container.length > 0)
+				location->appendMark = marks[level];
+			return;
+		}
+
+		LkSpan item;
+		location->list = container;
+		location->numMarks[level] = MvFindItem(str + container.offset, container.length, marks[level], positions[level], &item);
+		container.offset += item.offset;
+		container.length = item.length;
+	}
+
+	location->start = container.offset;
+	location->end = container.offset + container.length;
+}
+
+/*
+	Function: MvReplacedLength
+		Helper function for <MvReplace> that calculates the length of the new dynamic array.
+
+	Arguments:
+		length - Length of the dynamic array.
+		lenNewVal - Length of the new value.
+		location - The location of the new value, given by <MvLocateForUpdate>.
+
+	Returns:
+		The length of the new dynamic array, without the NUL terminator.
+*/
+static uint32_t MvReplacedLength(uint32_t length, uint32_t lenNewVal, const MvLocation* const location)
+{
+	uint32_t numMarks = location->numMarks[0] + location->numMarks[1] + location->numMarks[2] + (location->appendMark ? 1 : 0) + (location->insertMark ? 1 : 0);
+	return location->start + numMarks + lenNewVal + (length - location->end);
+}
+
+/*
+	Function: MvWriteReplaced
+		Helper function for <MvReplace> that writes the new dynamic array, with the NUL terminator.
+
+	Arguments:
+		out - Where the new dynamic array is written. It must have room for <MvReplacedLength> + 1 chars.
+		str - The dynamic array.
+		length - Length of "str".
+		newVal - The new value.
+		lenNewVal - Length of "newVal".
+		location - The location of the new value, given by <MvLocateForUpdate>.
+*/
+static void MvWriteReplaced(char* out, const char* const str, uint32_t length, const char* const newVal, uint32_t lenNewVal, const MvLocation* const location)
+{
+	char* p = out;
+	memcpy(p, str, location->start);
+	p += location->start;
+	memset(p, DBMV_Mark_AM, location->numMarks[0]);
+	p += location->numMarks[0];
+	memset(p, DBMV_Mark_VM, location->numMarks[1]);
+	p += location->numMarks[1];
+	memset(p, DBMV_Mark_SM, location->numMarks[2]);
+	p += location->numMarks[2];
+	if(location->appendMark)
+		*p++ = location->appendMark;
+	if(lenNewVal > 0)
+		memcpy(p, newVal, lenNewVal);
+	p += lenNewVal;
+	if(location->insertMark)
+		*p++ = location->insertMark;
+	memcpy(p, str + location->end, length - location->end);
+	p += length - location->end;
+	*p = 0;
+}
+
+/*
+	Function: MvReplace
+		Helper function for <LkReplace> and <LkReplaceArena>, that builds the new dynamic array with only one allocation.
+
+	Arguments:
+		arena - The arena where the result is allocated, or NULL to allocate it with the allocator of the library.
+		str - The dynamic array.
+		newVal - The new value.
+		field - The field position.
+		value - The value position.
+		subvalue - The subvalue position.
+		entryPoint - Name of the function that requests the memory, for <LkSetMemoryAccounting>.
+
+	Returns:
+		The new dynamic array.
+*/
+static char* MvReplace(LkArena* arena, const char* const str, const char* const newVal, int32_t field, int32_t value, int32_t subvalue, const char* const entryPoint)
+{
+	const char* source = str ? str : "";
+	uint32_t length = strlen(source);
+	uint32_t lenNewVal = newVal ? strlen(newVal) : 0;
+
+	MvLocation location;
+	MvLocateForUpdate(source, length, field, value, subvalue, &location);
+
+	char* result = MvAlloc(arena, MvReplacedLength(length, lenNewVal, &location) + 1, entryPoint);
+	if(result)
+		MvWriteReplaced(result, source, length, newVal, lenNewVal, &location);
+
+	return result;
+}
+
+/*
+	Function: MvExtract
+		Helper function for <LkExtract> and <LkExtractArena>.
+
+	Arguments:
+		arena - The arena where the result is allocated, or NULL to allocate it with the allocator of the library.
+		str - The dynamic array.
+		field - The field position.
+		value - The value position.
+		subvalue - The subvalue position.
+		entryPoint - Name of the function that requests the memory, for <LkSetMemoryAccounting>.
+
+	Returns:
+		A new string with the extracted value. If the position doesn't exist, an empty string.
+		NULL if "str" is NULL or none of the positions is greater than 0.
+*/
+static char* MvExtract(LkArena* arena, const char* const str, int32_t field, int32_t value, int32_t subvalue, const char* const entryPoint)
+{
+	if(str == NULL)
+		return NULL;
+
+	uint32_t length = strlen(str);
+	LkSpan span;
+	if(!MvLocateForExtract(str, length, field, value, subvalue, &span))
+		return NULL;
+
+	char* result = MvAlloc(arena, span.length + 1, entryPoint);
+	if(result)
+	{
+		memcpy(result, str + span.offset, span.length);
+		result[span.length] = 0;
+	}
+
+	return result;
+}
+
 /*
 	Function: LkExtract
 		Extracts a field, value or subvalue from a dynamic array.
@@ -93,84 +380,87 @@ DllEntry uint32_t LkDCount(const char* const str, char delimiter)
 		<Release Memory>
 */
 DllEntry char* LkExtract(const char* const str, int32_t field, int32_t value, int32_t subvalue)
-{	
-	if(field > 0 && str != NULL)
-	{
-		char* atributo = LkExtractFromSplit(str, DBMV_Mark_AM, field - 1);
-		
-		if(value > 0 && atributo != NULL)
-		{
-			char* multivalor = LkExtract(atributo, 0, value, subvalue);
-			free(atributo);
+{
+	return MvExtract(NULL, str, field, value, subvalue, __func__);
+}
 
-			return multivalor;
-		}
-		else
-		{
-			return atributo;
-		}
-	}	
-	else if(value > 0 && str != NULL)
-	{
-		char* multivalor = LkExtractFromSplit(str, DBMV_Mark_VM, value - 1);
-		
-		if(subvalue > 0 && multivalor != NULL)
-		{
-			char* subvalor = LkExtract(multivalor, 0, 0, subvalue);
-			free(multivalor);
-			
-			return subvalor;
-		}
-		else
-		{
-			return multivalor;
-		}
-	}	
-	else if(subvalue > 0 && str != NULL)
-	{
-		char *subvalor = LkExtractFromSplit(str, DBMV_Mark_SM, subvalue - 1);
+/*
+	Function: LkExtractView
+		Finds a field, value or subvalue of a dynamic array, like <LkExtract>, but without copying it.
 
-		return subvalor;
-	}
-	else
-		return NULL;
+	Arguments:
+		str - The dynamic array. It doesn't need to be NUL terminated.
+		length - Length of "str".
+		field - The position of the attribute where you want to extract.
+		value - The multivalue position where you want to extract.
+		subvalue - The subvalue position where you want to extract.
+		item - Output argument with the fragment of "str" where the item is. It is empty if the position doesn't exist.
+
+	Returns:
+		TRUE if the item was located, FALSE if "str" is NULL or none of the positions is greater than 0.
+
+	Example:
+		--- Code
+		LkStrView name;
+		if(LkExtractView(record, strlen(record), 2, 1, 0, &name) && name.length == 5 && memcmp(name.str, "SMITH", 5) == 0)
+			printf("Found\n");
+		---
+*/
+DllEntry BOOL LkExtractView(const char* const str, uint32_t length, int32_t field, int32_t value, int32_t subvalue, LkStrView* item)
+{
+	item->str = str;
+	item->length = 0;
+	if(str == NULL)
+		return FALSE;
+
+	LkSpan span;
+	if(!MvLocateForExtract(str, length, field, value, subvalue, &span))
+		return FALSE;
+
+	item->str = str + span.offset;
+	item->length = span.length;
+	return TRUE;
 }
-	
+
 /*
-	Function: AddMarks
-		Helper function for <LkReplace> that adds as many chars with ASCII code "chr" as indicated by the argument "count" at the end of the string "str".
+	Function: LkExtractInto
+		Extracts a field, value or subvalue of a dynamic array, like <LkExtract>, into a buffer provided by the caller.
+		If the buffer is too short, only the first "capacity" - 1 chars are copied, and the function returns the total length of the item,
+		so it can be called again with a buffer of the right size.
 
 	Arguments:
-		str - The string at the end of which the characters will be added.
-		count - The number of characters to be added.
-		chr - The character to be added.
+		str - The dynamic array. It doesn't need to be NUL terminated.
+		length - Length of "str".
+		field - The position of the attribute where you want to extract.
+		value - The multivalue position where you want to extract.
+		subvalue - The subvalue position where you want to extract.
+		buffer - Where the item is copied. It is always NUL terminated, unless "capacity" is 0. It can be NULL if "capacity" is 0.
+		capacity - Size of "buffer", including the NUL terminator.
 
 	Returns:
-		The new string with the added chars.
-		
-	Example:
-	---Code
-	---
+		The length of the item, without the NUL terminator. 0 if the position doesn't exist, "str" is NULL or none of the positions is greater than 0.
 
-	See Also:	
-		<LkReplace>
-				
-		<Release Memory>	
+	Example:
+		--- Code
+		char name[32];
+		if(LkExtractInto(record, strlen(record), 2, 1, 0, name, sizeof(name)) >= sizeof(name))
+			printf("Truncated\n");
+		---
 */
-static char* AddMarks(const char* const str, int32_t count, char chr)
+DllEntry uint32_t LkExtractInto(const char* const str, uint32_t length, int32_t field, int32_t value, int32_t subvalue, char* buffer, uint32_t capacity)
 {
-	int32_t lenStr = strlen(str);
-	char* result = malloc(lenStr + count + 1);
-	if(result)
+	LkStrView item;
+	LkExtractView(str, length, field, value, subvalue, &item);
+
+	if(capacity > 0)
 	{
-		strcpy(result, str);
-		memset(result + lenStr, chr, count);
-		result[lenStr + count] = 0;
-		
-		return result;			
+		uint32_t size = item.length < capacity ? item.length : capacity - 1;
+		if(size > 0)
+			memcpy(buffer, item.str, size);
+		buffer[size] = 0;
 	}
-	else
-		return NULL;
+
+	return item.length;
 }
 
 /*
@@ -197,339 +487,347 @@ static char* AddMarks(const char* const str, int32_t count, char chr)
 		<Release Memory>
 */
 DllEntry char* LkReplace(const char* const str, const char* const newVal, int32_t field, int32_t value, int32_t subvalue)
-{	
-	if(field < 0)
-		return LkCatString(str, newVal, DBMV_Mark_AM_str);
-	
-	if(field == 0)
-		field = 1;
-
-	char* fresult = NULL;
-	int32_t fcount = LkDCount(str, DBMV_Mark_AM);
-	if(field > fcount)
-	{
-		int32_t numMarcas = field - fcount;
-		fresult = AddMarks(str, numMarcas, DBMV_Mark_AM);
-	}
-	
-	char** fparts;
-	if(fresult)
-	{
-		fparts = LkStrSplit(fresult, DBMV_Mark_AM, &fcount);
-		free(fresult);
-		fresult = NULL;
-	}
-	else
-		fparts = LkStrSplit(str, DBMV_Mark_AM, &fcount);
-	
-	int i;
-	field--;
-	for(i=0; i<fcount; i++)
-	{
-		if(i == field)
-		{
-			if(value == 0)
-			{
-				if(fresult)
-				{
-					char* aux = LkCatString(fresult, newVal, DBMV_Mark_AM_str);
-					free(fresult);
-					fresult = aux;
-				}
-				else
-					fresult = LkCatString(fresult, newVal, NULL);
-			}
-			else if(value == -1)
-			{
-				if(fparts[i][0] == 0) // Si el FIELD esta vacio, se pone directamente NEWVAL
-				{
-					char* aux;
-					if(fresult)
-						aux = LkCatString(fresult, newVal, DBMV_Mark_AM_str);
-					else
-						aux = LkCatString(fresult, newVal, NULL);
-					free(fresult);
-					fresult = aux;
-				}
-				else
-				{
-					char* aux;
-					if(fresult)
-						aux = LkCatString(fresult, fparts[i], DBMV_Mark_AM_str);
-					else
-						aux = LkCatString(fresult, fparts[i], NULL);
-					free(fresult);
-					fresult = aux;
-					aux = LkCatString(fresult, newVal, DBMV_Mark_VM_str);
-					free(fresult);
-					fresult = aux;						
-				}
-			}
-			else
-			{							
-				char* vresult = NULL;
-				int32_t vcount = LkDCount(fparts[i], DBMV_Mark_VM);
-				if((value-1) > vcount)
-				{
-					int32_t numMarcas = value - vcount;
-					vresult = AddMarks(fparts[i], numMarcas, DBMV_Mark_VM);
-				}				
-				
-				char** vparts;
-				if(vresult)
-				{
-					vparts = LkStrSplit(vresult, DBMV_Mark_VM, &vcount);
-					free(vresult);
-					vresult = NULL;
-				}
-				else
-					vparts = LkStrSplit(fparts[i], DBMV_Mark_VM, &vcount);
-				
-				int j;
-				value--;
-				for(j=0; j<vcount; j++)
-				{
-					if(j == value)
-					{
-						if(subvalue == 0)
-						{
-							char* aux;
-							if(vresult)
-							{
-								aux = LkCatString(vresult, newVal, DBMV_Mark_VM_str);
-								free(vresult);
-							}
-							else
-								aux = LkCatString(vresult, newVal, NULL);
-							vresult = aux;
-						}
-						else if(subvalue == -1)
-						{
-							if(vparts[j][0] == 0)
-							{
-								char* aux;
-								if(vresult)
-									aux = LkCatString(vresult, newVal, DBMV_Mark_VM_str);
-								else
-									aux = LkCatString(vresult, newVal, NULL);
-								free(vresult);
-								vresult = aux;
-							}
-							else
-							{
-								char* aux;
-								if(vresult)
-									aux = LkCatString(vresult, vparts[j], DBMV_Mark_VM_str);
-								else
-									aux = LkCatString(vresult, vparts[j], NULL);
-								free(vresult);
-								vresult = aux;
-								aux = LkCatString(vresult, newVal, DBMV_Mark_SM_str);
-								free(vresult);
-								vresult = aux;						
-							}				
-						}
-						else
-						{
-							char* sresult = NULL;
-							int32_t scount = LkDCount(vparts[j], DBMV_Mark_SM);
-							if((subvalue-1) > scount)
-							{
-								int32_t numMarcas = subvalue - scount;
-								sresult = AddMarks(vparts[j], numMarcas, DBMV_Mark_SM);
-							}				
-				
-							char** sparts;
-							if(sresult)
-							{
-								sparts = LkStrSplit(sresult, DBMV_Mark_SM, &scount);
-								free(sresult);
-								sresult = NULL;
-							}
-							else
-								sparts = LkStrSplit(vparts[j], DBMV_Mark_SM, &scount);
-							
-							subvalue--;
-							int k;
-							for(k=0; k<scount; k++)
-							{
-								if(k==subvalue)
-								{
-									char* aux;
-									if(sresult)
-									{
-										aux = LkCatString(sresult, newVal, DBMV_Mark_SM_str);
-										free(sresult);
-									}
-									else
-										aux = LkCatString(sresult, newVal, NULL);
-									sresult = aux;
-								}
-								else
-								{
-									char* aux;
-									if(sresult)
-									{
-										aux = LkCatString(sresult, sparts[k], DBMV_Mark_SM_str);
-										free(sresult);
-									}
-									else
-										aux = LkCatString(sresult, sparts[k], NULL);
-									sresult = aux;
-								}
-								free(sparts[k]);
-							}
-							free(sparts);
-							
-							if(vresult)
-							{
-								char* aux = LkCatString(vresult, sresult, DBMV_Mark_VM_str);
-								free(vresult);
-								vresult = aux;
-							}
-							else
-								vresult = LkCatString(vresult, sresult, NULL);
-						}
-					}
-					else
-					{
-						char* aux;
-						if(vresult)
-						{
-							aux = LkCatString(vresult, vparts[j], DBMV_Mark_VM_str);
-							free(vresult);
-						}
-						else
-							aux = LkCatString(vresult, vparts[j], NULL);
-						vresult = aux;
-					}
-
-					free(vparts[j]);
-				}
-			
-				free(vparts);
-				
-				if(fresult)
-				{
-					char* aux = LkCatString(fresult, vresult, DBMV_Mark_AM_str);
-					free(fresult);
-					fresult = aux;
-				}
-				else
-				{
-					fresult = LkCatString(fresult, vresult, NULL);
-				}
-			}
-		}
-		else
-		{
-			char* aux;
-			if(fresult)
-			{
-				aux = LkCatString(fresult, fparts[i], DBMV_Mark_AM_str);
-				free(fresult);
-			}
-			else
-				aux = LkCatString(fresult, fparts[i], NULL);
-			fresult = aux;
-		}
-		free(fparts[i]);
-	}
-	free(fparts);
-	
-	return fresult;	
+{
+	return MvReplace(NULL, str, newVal, field, value, subvalue, __func__);
 }
 
 /*
-	Function: strFind
-		Helper function for <LkChange> that look for the string "str2" inside the string "str".
-		
+	Function: LkInsert
+		Inserts a new field, value or subvalue in a dynamic array, before the one in the given position, like the INS statement of Pick BASIC.
+		The new dynamic array is built with only one copy of the original one, whatever the position is.
+
 	Arguments:
-		str - The string where the search will be performed.
-		str2 - The string to search
-		
+		str - The dynamic array.
+		newVal - The new item.
+		field - The field position. A negative number inserts the new field at the end.
+		value - The value position, 0 to insert a field, or a negative number to insert the new value at the end of the field.
+		subvalue - The subvalue position, 0 to insert a value, or a negative number to insert the new subvalue at the end of the value.
+
 	Returns:
-		If string str2 is found, its starting position within string str will be returned. Otherwise -1 will be returned.
-		
-	See Also:
-		<LkChange>
+		A new string with the inserted item. The missing items before the position are created empty.
+
+	Example:
+		--- Code
+		char* result = LkInsert("CUSTOMER 1þ2024-02-01ý2024-01-01", "2024-03-01", 2, 1, 0);
+		printf("%s\n", result); // CUSTOMER 1þ2024-03-01ý2024-02-01ý2024-01-01
+		free(result);
+		---
 
+	See Also:
 		<Release Memory>
 */
-static uint32_t strFind(const char* const str, const char* const str2)
-{	
-	int lenSearchStr = strlen(str2);
-	int len = strlen(str) - lenSearchStr;
-	int i;
-	char* subStr = malloc(lenSearchStr + 1);
-	if(subStr)
+DllEntry char* LkInsert(const char* const str, const char* const newVal, int32_t field, int32_t value, int32_t subvalue)
+{
+	const char marks[3] = { DBMV_Mark_AM, DBMV_Mark_VM, DBMV_Mark_SM };
+	const char* source = str ? str : "";
+	uint32_t length = strlen(source);
+	uint32_t lenNewVal = newVal ? strlen(newVal) : 0;
+
+	// The level where the new item is placed, that is the last position not 0, or the first negative one
+	int32_t positions[3] = { field == 0 ? 1 : field, value, subvalue };
+	int level = 0;
+	while(level < 2 && positions[level] > 0 && positions[level + 1] != 0)
+		level++;
+
+	MvLocation location;
+	MvLocateForUpdate(source, length, field, value, subvalue, &location);
+	if(field < 0 && length == 0)
+		location.appendMark = 0;
+	else if(positions[level] > 0 && location.numMarks[0] + location.numMarks[1] + location.numMarks[2] == 0)
 	{
-		for(i=0; i<=len; i++)
-		{
-			strncpy(subStr, str+i, lenSearchStr);
-			subStr[lenSearchStr] = 0;
-			if(strcmp(subStr, str2) == 0)
-				return i;
-		}
-		return -1;
+		// The item exists, so the new one is inserted before it, unless the list is empty
+		location.end = location.start;
+		if(location.list.length > 0)
+			location.insertMark = marks[level];
 	}
-	else
-		return -1;
+
+	char* result = LkMallocFrom(MvReplacedLength(length, lenNewVal, &location) + 1, __func__);
+	if(result)
+		MvWriteReplaced(result, source, length, newVal, lenNewVal, &location);
+
+	return result;
 }
 
 /*
-	Function: strReplace
-		Helper function for <LkChange> that replaces inside the string "str" ​​the substring that begins in the position "pos" and has as many chars as length as indicated by the argument "length", by the string indicated in the argument "newStr"
-	
+	Function: LkDelete
+		Deletes a field, value or subvalue of a dynamic array with its delimiter, like the DEL statement of Pick BASIC.
+		The new dynamic array is built with only one copy of the original one, whatever the position is.
+
 	Arguments:
-		str - The string where the replacement will be made.
-		pos - The position within the string "str" ​​where the substring to be replaced begins.
-		length - Chars to replace from position "pos".
-		newStr - The new string to replace the substring inside the string "str"
-		
+		str - The dynamic array.
+		field - The field position.
+		value - The value position, or 0 to delete the whole field.
+		subvalue - The subvalue position, or 0 to delete the whole value.
+
 	Returns:
-		The new string with the replacement made.
-		
+		A new string without the item. If the item doesn't exist, a copy of "str".
+
+	Example:
+		--- Code
+		char* result = LkDelete("CUSTOMER 1þ2024-02-01ý2024-01-01", 2, 2, 0);
+		printf("%s\n", result); // CUSTOMER 1þ2024-02-01
+		free(result);
+		---
+
 	See Also:
-		<LkChange>
-				
 		<Release Memory>
 */
-static char* strReplace(const char* const str, uint32_t pos, uint32_t length, const char* newStr)
-{	
-	int lenNewStr = 0;
-	if(newStr)
-		lenNewStr = strlen(newStr);
-	int len = strlen(str) - length + lenNewStr;
-	char* result = malloc(len + 1);
-	
-	if(result)
+DllEntry char* LkDelete(const char* const str, int32_t field, int32_t value, int32_t subvalue)
+{
+	const char* source = str ? str : "";
+	uint32_t length = strlen(source);
+
+	MvLocation location;
+	location.start = 0;
+	location.end = 0;
+	// Like LkReplace, the positions after a 0 are not used
+	if(field >= 0 && value >= 0 && (value == 0 || subvalue >= 0))
 	{
-		strncpy(result, str, pos);
-		result[pos] = 0;
-		if(newStr)
-			strcat(result, newStr);
-		strcat(result, str + pos + length);
+		MvLocateForUpdate(source, length, field, value, subvalue, &location);
+		if(location.numMarks[0] + location.numMarks[1] + location.numMarks[2] > 0)
+			location.end = location.start;
+		else
+		{
+			// The delimiter after the item is deleted too, or the one before it if it is the last item of the list
+			if(location.end < location.list.offset + location.list.length)
+				location.end++;
+			else if(location.start > location.list.offset)
+				location.start--;
+		}
+	}
 
-		return result;
+	char* result = LkMallocFrom(length - (location.end - location.start) + 1, __func__);
+	if(result)
+	{
+		memcpy(result, source, location.start);
+		memcpy(result + location.start, source + location.end, length - location.end);
+		result[length - (location.end - location.start)] = 0;
 	}
-	else
-		return NULL;
+
+	return result;
 }
 
 /*
-	Function: LkChange
-		Replaces the occurrence of a substring inside a string, by other substring.
-		
-	Arguments:
-		str - The string on which the value is going to change.
-		oldStr - The value to change.
-		newStr - The new value.
-		occurrence - The number of times it will change.
+	Struct: MvSearch
+		Substring prepared by <MvSearchInit> to be found many times by <MvFind>.
+		The short substrings are found looking for their first char with <LkScanFindByte>, that checks many chars at a time, and comparing the rest.
+		The longer ones use the Horspool algorithm: the last char of every window of the string gives how many chars the window can be moved
+		without skipping any occurrence, so most of the chars of the string are never read.
+*/
+typedef struct
+{
+	const char* str;
+	uint32_t length;
+	uint32_t skip[256];
+} MvSearch;
+
+// Length from which the Horspool algorithm is used. The shorter substrings can't skip enough chars to be faster than LkScanFindByte
+#define MvSearch_MIN_SKIP_LENGTH 4
+
+/*
+	Function: MvSearchInit
+		Helper function for <MvChange> that prepares a substring to be found by <MvFind>.
+
+	Arguments:
+		search - The <MvSearch> to initialize.
+		searchStr - The string to find. It is not copied.
+		lenSearchStr - Length of "searchStr". It must be greater than 0.
+*/
+static void MvSearchInit(MvSearch* search, const char* const searchStr, uint32_t lenSearchStr)
+{
+	search->str = searchStr;
+	search->length = lenSearchStr;
+	if(lenSearchStr < MvSearch_MIN_SKIP_LENGTH)
+		return;
+
+	// The window is moved until its last char is aligned with the last occurrence of that char in the substring, ignoring its last char
+	uint32_t i;
+	for(i = 0; i < 256; i++)
+		search->skip[i] = lenSearchStr;
+	for(i = 0; i < lenSearchStr - 1; i++)
+		search->skip[(uint8_t)searchStr[i]] = lenSearchStr - 1 - i;
+}
+
+/*
+	Function: MvFind
+		Helper function for <MvChange> that finds a substring inside a string.
+
+	Arguments:
+		search - The substring to find, prepared by <MvSearchInit>.
+		str - The string where the search is performed.
+		length - Length of "str".
+
+	Returns:
+		Pointer to the first occurrence of the substring inside "str", or NULL if it is not found.
+*/
+static const char* MvFind(const MvSearch* const search, const char* const str, uint32_t length)
+{
+	uint32_t lenSearchStr = search->length;
+	if(length < lenSearchStr)
+		return NULL;
+
+	const char* p = str;
+	const char* last = str + length - lenSearchStr;
+	if(lenSearchStr < MvSearch_MIN_SKIP_LENGTH)
+	{
+		while(p <= last)
+		{
+			p = LkScanFindByte(p, last - p + 1, search->str[0]);
+			if(p == NULL)
+				return NULL;
+			if(memcmp(p + 1, search->str + 1, lenSearchStr - 1) == 0)
+				return p;
+			p++;
+		}
+		return NULL;
+	}
+
+	uint8_t lastChar = search->str[lenSearchStr - 1];
+	while(p <= last)
+	{
+		uint8_t c = p[lenSearchStr - 1];
+		if(c == lastChar && memcmp(p, search->str, lenSearchStr - 1) == 0)
+			return p;
+		p += search->skip[c];
+	}
+
+	return NULL;
+}
+
+/*
+	Function: MvCountChanges
+		Helper function for <MvChange> that finds the occurrences of a substring that must be replaced.
+		The occurrences are found from left to right without overlapping. The first "start" - 1 occurrences are kept, and the next "occurrence" occurrences are replaced (all of them if "occurrence" is lower than 1).
+
+	Arguments:
+		search - The substring to replace, prepared by <MvSearchInit>.
+		str - The string on which the value is going to change.
+		length - Length of "str".
+		occurrence - The number of times it will change.
+		start - The occurrence from which you are going to start changing values. It must be greater than 0.
+		first - Output argument with the first occurrence to replace, or NULL if there is none.
+
+	Returns:
+		The number of occurrences to replace.
+*/
+static uint32_t MvCountChanges(const MvSearch* const search, const char* const str, uint32_t length, int32_t occurrence, int32_t start, const char** first)
+{
+	const char* end = str + length;
+	const char* p = str;
+	uint32_t numChanges = 0;
+	int32_t found = 0;
+	*first = NULL;
+	while(occurrence < 1 || numChanges < (uint32_t)occurrence)
+	{
+		p = MvFind(search, p, end - p);
+		if(p == NULL)
+			break;
+		found++;
+		if(found >= start)
+		{
+			if(*first == NULL)
+				*first = p;
+			numChanges++;
+		}
+		p += search->length;
+	}
+
+	return numChanges;
+}
+
+/*
+	Function: MvWriteChanged
+		Helper function for <MvChange> that writes the text between the occurrences, and the new value instead of every occurrence, with the NUL terminator.
+
+	Arguments:
+		out - Where the new string is written.
+		search - The substring to replace, prepared by <MvSearchInit>.
+		str - The string on which the value is going to change.
+		length - Length of "str".
+		newStr - The new value.
+		lenNewStr - Length of "newStr".
+		first - The first occurrence to replace, given by <MvCountChanges>.
+		numChanges - The number of occurrences to replace, given by <MvCountChanges>.
+*/
+static void MvWriteChanged(char* out, const MvSearch* const search, const char* const str, uint32_t length, const char* const newStr, uint32_t lenNewStr, const char* first, uint32_t numChanges)
+{
+	const char* end = str + length;
+	const char* p = str;
+	const char* match = first;
+	uint32_t i;
+	for(i = 0; i < numChanges; i++)
+	{
+		if(i > 0)
+			match = MvFind(search, p, end - p);
+		memcpy(out, p, match - p);
+		out += match - p;
+		if(lenNewStr > 0)
+			memcpy(out, newStr, lenNewStr);
+		out += lenNewStr;
+		p = match + search->length;
+	}
+	memcpy(out, p, end - p);
+	out += end - p;
+	*out = 0;
+}
+
+/*
+	Function: MvChange
+		Helper function for <LkChange> and <LkChangeArena>, that replaces the occurrences of a substring and builds the result with only one allocation.
+		The occurrences are found from left to right without overlapping. The first "start" - 1 occurrences are kept, and the next "occurrence" occurrences are replaced (all of them if "occurrence" is lower than 1).
+
+	Arguments:
+		arena - The arena where the result is allocated, or NULL to allocate it with the allocator of the library.
+		str - The string on which the value is going to change.
+		oldStr - The value to change.
+		newStr - The new value.
+		occurrence - The number of times it will change.
+		start - The occurrence from which you are going to start changing values.
+		entryPoint - Name of the function that requests the memory, for <LkSetMemoryAccounting>.
+
+	Returns:
+		A new string with replaced text. If there is nothing to replace, a copy of "str".
+*/
+static char* MvChange(LkArena* arena, const char* const str, const char* const oldStr, const char* const newStr, int32_t occurrence, int32_t start, const char* const entryPoint)
+{
+	if(str == NULL)
+		return NULL;
+
+	uint32_t length = strlen(str);
+	uint32_t lenOldStr = oldStr ? strlen(oldStr) : 0;
+	uint32_t lenNewStr = newStr ? strlen(newStr) : 0;
+	if(start < 1)
+		start = 1;
+
+	MvSearch search;
+	const char* first = NULL;
+	uint32_t numChanges = 0;
+	if(lenOldStr > 0)
+	{
+		MvSearchInit(&search, oldStr, lenOldStr);
+		numChanges = MvCountChanges(&search, str, length, occurrence, start, &first);
+	}
+
+	char* result = MvAlloc(arena, length - numChanges * lenOldStr + numChanges * lenNewStr + 1, entryPoint);
+	if(result)
+		MvWriteChanged(result, &search, str, length, newStr, lenNewStr, first, numChanges);
+
+	return result;
+}
+
+/*
+	Function: LkChange
+		Replaces the occurrence of a substring inside a string, by other substring.
+		
+	Arguments:
+		str - The string on which the value is going to change.
+		oldStr - The value to change.
+		newStr - The new value.
+		occurrence - The number of times it will change.
 		start - The position from which you are going to start changing values.
 	
 	Returns:
-		A new string with replaced text.
+		A new string with replaced text. If there is nothing to replace, a copy of "str", so the result can always be released.
 		
 	Example:
 	---Code
@@ -542,72 +840,692 @@ static char* strReplace(const char* const str, uint32_t pos, uint32_t length, co
 		<Release Memory>
 */
 DllEntry char* LkChange(const char* const str, const char* const oldStr, const char* const newStr, int32_t occurrence, int32_t start)
-{	
-	int lenOldStr = strlen(oldStr);
-	int lenNewStr = strlen(newStr);
-	if(start < 1)
-		start = 1;
-	
-	int i;
-	uint32_t posBuscar = 0;
-	int posCambiar = -1;
-	int c = 0;
-	for(i=0; i<start; i++)
+{
+	return MvChange(NULL, str, oldStr, newStr, occurrence, start, __func__);
+}
+
+/*
+	Function: MvCompareItems
+		Helper function for <LkLocate> that compares two items in the order of a sorted list.
+
+	Arguments:
+		item - The first item.
+		lenItem - Length of "item".
+		searchValue - The second item.
+		lenSearchValue - Length of "searchValue".
+		order - The order of the list. See <LocateOrderTYPE>.
+
+	Returns:
+		A negative number if "item" goes before "searchValue" in the list, 0 if they are equal, and a positive number if it goes after.
+*/
+static int MvCompareItems(const char* const item, uint32_t lenItem, const char* const searchValue, uint32_t lenSearchValue, LocateOrderTYPE order)
+{
+	int result = 0;
+	if((order == LocateOrderTYPE_AR || order == LocateOrderTYPE_DR) && lenItem != lenSearchValue)
 	{
-		c = strFind(str + posBuscar, oldStr);
-		if(c >= 0)
-		{
-			if(posCambiar == -1)
-				posCambiar = c;
-			else
-				posCambiar += c + lenOldStr;
-			
-			posBuscar = posCambiar + lenOldStr;
-		}
+		// The shorter item is padded with spaces on the left, so the first chars of the longer one are compared with spaces
+		const char* longer = lenItem > lenSearchValue ? item : searchValue;
+		uint32_t numPadding = lenItem > lenSearchValue ? lenItem - lenSearchValue : lenSearchValue - lenItem;
+		uint32_t i;
+		for(i = 0; i < numPadding && result == 0; i++)
+			result = (uint8_t)longer[i] - ' ';
+		if(longer == searchValue)
+			result = -result;
+		if(result == 0)
+			result = lenItem > lenSearchValue ? memcmp(item + numPadding, searchValue, lenSearchValue) : memcmp(item, searchValue + numPadding, lenItem);
+	}
+	else
+	{
+		result = memcmp(item, searchValue, lenItem < lenSearchValue ? lenItem : lenSearchValue);
+		if(result == 0)
+			result = lenItem < lenSearchValue ? -1 : (lenItem > lenSearchValue ? 1 : 0);
+	}
 
-		c++;
+	return order == LocateOrderTYPE_DL || order == LocateOrderTYPE_DR ? -result : result;
+}
+
+// Number of items that LkLocate indexes without allocating memory
+#define MvLocate_STACK_ITEMS 256
+
+/*
+	Function: LkLocate
+		Finds a value inside a dynamic array, like the LOCATE statement of Pick BASIC.
+		If "field" is 0, the fields of the dynamic array are searched. If "value" is 0, the values of the field are searched.
+		Otherwise, the subvalues of the value are searched. An empty field or value has no items, so the value is never found there, and its position is 1.
+
+		In a sorted list, the items are found with a binary search, and when the value is not found, the position where it must be inserted
+		to keep the order is returned. In a list not sorted, the position after the last item is returned.
+
+	Arguments:
+		str - The dynamic array.
+		searchValue - The value to find.
+		field - The field position, or 0 to search the fields.
+		value - The value position, or 0 to search the values of the field.
+		order - How the items are sorted. See <LocateOrderTYPE>.
+		position - Output argument with the 1-based position where the value is, or where it must be inserted if it is not found.
+			0 if there is no memory to index the items.
+
+	Returns:
+		TRUE if the value is found, FALSE otherwise.
+
+	Example:
+		--- Code
+		uint32_t position;
+		if(LkLocate(record, "150", 7, 0, LocateOrderTYPE_AR, &position))
+			printf("Found in value %u\n", position);
+		else
+			printf("Must be inserted as value %u\n", position);
+		---
+*/
+DllEntry BOOL LkLocate(const char* const str, const char* const searchValue, int32_t field, int32_t value, LocateOrderTYPE order, uint32_t* position)
+{
+	const char* source = str ? str : "";
+	const char* search = searchValue ? searchValue : "";
+	uint32_t lenSearch = strlen(search);
+
+	// The list of items: the whole string, a field or a value
+	LkSpan list = { 0, strlen(source) };
+	char delim = DBMV_Mark_AM;
+	if(field > 0)
+	{
+		MvLocateForExtract(source, list.length, field, value > 0 ? value : 0, 0, &list);
+		delim = value > 0 ? DBMV_Mark_SM : DBMV_Mark_VM;
 	}
-		
-	char* result = NULL;
-	if(c == -1)
-		return (char*)str;
+	const char* items = source + list.offset;
 
-	BOOL end = FALSE;
-	do
+	if(order != LocateOrderTYPE_AL && order != LocateOrderTYPE_AR && order != LocateOrderTYPE_DL && order != LocateOrderTYPE_DR)
 	{
-		if(occurrence > 0)
+		const char* end = items + list.length;
+		const char* item = items;
+		uint32_t count = 0;
+		while(list.length > 0)
 		{
-			occurrence--;
-			if(occurrence == 0)
-				end = TRUE;
+			const char* itemEnd = LkScanFindByte(item, end - item, delim);
+			uint32_t lenItem = (itemEnd ? itemEnd : end) - item;
+			count++;
+			if(lenItem == lenSearch && memcmp(item, search, lenSearch) == 0)
+			{
+				*position = count;
+				return TRUE;
+			}
+			if(itemEnd == NULL)
+				break;
+			item = itemEnd + 1;
 		}
-			
-		if(result)
+		*position = count + 1;
+		return FALSE;
+	}
+
+	LkSpan stackSpans[MvLocate_STACK_ITEMS];
+	LkSpan* spans = stackSpans;
+	uint32_t count = LkStrSplitSpansInto(items, list.length, delim, stackSpans, MvLocate_STACK_ITEMS);
+	if(count > MvLocate_STACK_ITEMS)
+	{
+		spans = LkStrSplitSpans(items, list.length, delim, &count);
+		if(spans == NULL)
 		{
-			char* aux = strReplace(result, posCambiar, lenOldStr, newStr);
-			free(result);
-			result = aux;
+			*position = 0;
+			return FALSE;
 		}
+	}
+
+	// The first item that doesn't go before the value
+	uint32_t low = 0;
+	uint32_t high = count;
+	while(low < high)
+	{
+		uint32_t middle = low + (high - low) / 2;
+		if(MvCompareItems(items + spans[middle].offset, spans[middle].length, search, lenSearch, order) < 0)
+			low = middle + 1;
 		else
-			result = strReplace(str, posCambiar, lenOldStr, newStr);
+			high = middle;
+	}
+	BOOL found = low < count && MvCompareItems(items + spans[low].offset, spans[low].length, search, lenSearch, order) == 0;
 
-		posBuscar = posCambiar + lenNewStr;
-		uint32_t len = strlen(result);
-		
-		if(posBuscar <= (len - lenOldStr))
+	if(spans != stackSpans)
+		LkFreeSpans(spans);
+	*position = low + 1;
+	return found;
+}
+
+/*
+	Function: LkExtractArena
+		Like <LkExtract>, but the result is allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		str - The string on which you are going to extract a value.
+		field - The position of the attribute where you want to extract.
+		value - The multivalue position where you want to extract.
+		subvalue - The subvalue position where you want to extract.
+
+	Returns:
+		A new string with the extracted value. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char* LkExtractArena(LkArena* arena, const char* const str, int32_t field, int32_t value, int32_t subvalue)
+{
+	return MvExtract(arena, str, field, value, subvalue, __func__);
+}
+
+/*
+	Function: LkReplaceArena
+		Like <LkReplace>, but the result is allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		str - The string on which you are going to replace a value.
+		newVal - The new value that will be replaced in the indicated string.
+		field - The position of the attribute where you want to replace.
+		value - The multivalue position where you want to replace.
+		subvalue - The subvalue position where you want to replace.
+
+	Returns:
+		A new string with the replaced value. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char* LkReplaceArena(LkArena* arena, const char* const str, const char* const newVal, int32_t field, int32_t value, int32_t subvalue)
+{
+	return MvReplace(arena, str, newVal, field, value, subvalue, __func__);
+}
+
+/*
+	Function: LkChangeArena
+		Like <LkChange>, but the result is allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		str - The string on which the value is going to change.
+		oldStr - The value to change.
+		newStr - The new value.
+		occurrence - The number of times it will change.
+		start - The position from which you are going to start changing values.
+
+	Returns:
+		A new string with replaced text. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char* LkChangeArena(LkArena* arena, const char* const str, const char* const oldStr, const char* const newStr, int32_t occurrence, int32_t start)
+{
+	return MvChange(arena, str, oldStr, newStr, occurrence, start, __func__);
+}
+
+#define MvBatch_EXTRACT 0
+#define MvBatch_REPLACE 1
+#define MvBatch_CHANGE 2
+
+// Minimum number of records of every piece of work of the batch functions
+#define MvBatch_MIN_CHUNK_RECORDS 1024
+
+/*
+	Struct: MvBatchItem
+		State of one record of a batch function, kept from the first phase, that measures the result, to the second one, that writes it.
+*/
+typedef struct
+{
+	const char* str;
+	uint32_t length;
+	union
+	{
+		LkSpan span;
+		MvLocation location;
+		struct
 		{
-			c = strFind(result + posBuscar, oldStr);
-			if(c == -1)
-				end = TRUE;
-			else
-				posCambiar = posBuscar + c;
+			const char* first;
+			uint32_t numChanges;
+		} change;
+	} state;
+} MvBatchItem;
+
+/*
+	Struct: MvBatchContext
+		State shared by the tasks of <MvBatch>. The records are divided in chunks of consecutive records, and every task works on one chunk.
+*/
+typedef struct
+{
+	int operation;
+	const char* const* records;
+	const char* section;
+	const LkSpan* spans;
+	uint32_t numRecords;
+	uint32_t numChunks;
+	int32_t field;
+	int32_t value;
+	int32_t subvalue;
+	const char* newStr;
+	uint32_t lenNewStr;
+	const MvSearch* search;
+	uint32_t lenOldStr;
+	int32_t occurrence;
+	int32_t start;
+	MvBatchItem* items;
+	uint64_t* chunkSizes;
+	LkBatchResult* result;
+} MvBatchContext;
+
+#define MvBatchChunkStart(context, chunk) ((uint32_t)((uint64_t)(context)->numRecords * (chunk) / (context)->numChunks))
+
+// First phase: the location of the changes in every record, and the size of the results of the chunk
+static void MeasureBatchTask(void* argument, uint32_t chunk)
+{
+	MvBatchContext* context = argument;
+	uint64_t size = 0;
+	uint32_t last = MvBatchChunkStart(context, chunk + 1);
+	uint32_t i;
+	for(i = MvBatchChunkStart(context, chunk); i < last; i++)
+	{
+		MvBatchItem* item = &context->items[i];
+		if(context->records)
+		{
+			item->str = context->records[i] ? context->records[i] : "";
+			item->length = strlen(item->str);
 		}
 		else
-			end = TRUE;
-	} while(!end);
-		
+		{
+			item->str = context->section + context->spans[i].offset;
+			item->length = context->spans[i].length;
+		}
+
+		switch(context->operation)
+		{
+			case MvBatch_EXTRACT:
+				MvLocateForExtract(item->str, item->length, context->field, context->value, context->subvalue, &item->state.span);
+				size += item->state.span.length;
+				break;
+			case MvBatch_REPLACE:
+				MvLocateForUpdate(item->str, item->length, context->field, context->value, context->subvalue, &item->state.location);
+				size += MvReplacedLength(item->length, context->lenNewStr, &item->state.location);
+				break;
+			case MvBatch_CHANGE:
+				item->state.change.numChanges = 0;
+				if(context->search)
+					item->state.change.numChanges = MvCountChanges(context->search, item->str, item->length, context->occurrence, context->start, &item->state.change.first);
+				size += item->length + (uint64_t)item->state.change.numChanges * context->lenNewStr - (uint64_t)item->state.change.numChanges * context->lenOldStr;
+				break;
+		}
+		size++;
+	}
+
+	context->chunkSizes[chunk] = size;
+}
+
+// Second phase: the results of the chunk are written one after another, from the offset of the chunk
+static void WriteBatchTask(void* argument, uint32_t chunk)
+{
+	MvBatchContext* context = argument;
+	LkBatchResult* result = context->result;
+	uint32_t offset = (uint32_t)context->chunkSizes[chunk];
+	uint32_t last = MvBatchChunkStart(context, chunk + 1);
+	uint32_t i;
+	for(i = MvBatchChunkStart(context, chunk); i < last; i++)
+	{
+		const MvBatchItem* item = &context->items[i];
+		char* out = result->data + offset;
+		result->offsets[i] = offset;
+		switch(context->operation)
+		{
+			case MvBatch_EXTRACT:
+				memcpy(out, item->str + item->state.span.offset, item->state.span.length);
+				out[item->state.span.length] = 0;
+				offset += item->state.span.length + 1;
+				break;
+			case MvBatch_REPLACE:
+				MvWriteReplaced(out, item->str, item->length, context->newStr, context->lenNewStr, &item->state.location);
+				offset += MvReplacedLength(item->length, context->lenNewStr, &item->state.location) + 1;
+				break;
+			case MvBatch_CHANGE:
+				if(item->state.change.numChanges > 0)
+					MvWriteChanged(out, context->search, item->str, item->length, context->newStr, context->lenNewStr, item->state.change.first, item->state.change.numChanges);
+				else
+				{
+					memcpy(out, item->str, item->length);
+					out[item->length] = 0;
+				}
+				offset += item->length + item->state.change.numChanges * context->lenNewStr - item->state.change.numChanges * context->lenOldStr + 1;
+				break;
+		}
+	}
+}
+
+/*
+	Function: MvBatch
+		Helper function for the batch functions, that applies the same operation to all the records and writes all the results in only one memory block.
+		First the records are measured, chunk by chunk, then the memory block is allocated, and then every chunk writes its results in its own part of the block.
+
+	Arguments:
+		context - The operation and the records. The items, chunks and result are filled by this function.
+		config - The options of the parallel execution. It can be NULL.
+		entryPoint - Name of the function that requests the memory, for <LkSetMemoryAccounting>.
+
+	Returns:
+		The results, or NULL if there is no memory or they are bigger than 4 GB.
+*/
+static LkBatchResult* MvBatch(MvBatchContext* context, const LkParallelConfig* const config, const char* const entryPoint)
+{
+	context->numChunks = 1;
+	if(config != NULL && config->pool != NULL)
+	{
+		uint32_t numChunks = context->numRecords / MvBatch_MIN_CHUNK_RECORDS;
+		uint32_t maxChunks = (LkThreadPoolGetNumThreads(config->pool) + 1) * 4;
+		if(numChunks > maxChunks)
+			numChunks = maxChunks;
+		if(numChunks > 1)
+			context->numChunks = numChunks;
+	}
+	LkThreadPool* pool = context->numChunks > 1 ? config->pool : NULL;
+
+	context->items = LkMallocFrom((uint64_t)context->numRecords * sizeof(MvBatchItem) + 1, entryPoint);
+	context->chunkSizes = LkMallocFrom(context->numChunks * sizeof(uint64_t), entryPoint);
+	context->result = NULL;
+	if(context->items && context->chunkSizes)
+	{
+		LkThreadPoolRun(pool, context->numChunks, MeasureBatchTask, context);
+
+		// The size of every chunk becomes its offset inside the data
+		uint64_t size = 0;
+		uint32_t i;
+		for(i = 0; i < context->numChunks; i++)
+		{
+			uint64_t chunkSize = context->chunkSizes[i];
+			context->chunkSizes[i] = size;
+			size += chunkSize;
+		}
+
+		uint64_t offsetsSize = ((uint64_t)context->numRecords + 1) * sizeof(uint32_t);
+		if(size < UINT32_MAX)
+			context->result = LkMallocFrom(sizeof(LkBatchResult) + offsetsSize + size, entryPoint);
+		if(context->result)
+		{
+			context->result->count = context->numRecords;
+			context->result->offsets = (uint32_t*)(context->result + 1);
+			context->result->data = (char*)context->result->offsets + offsetsSize;
+			context->result->offsets[context->numRecords] = (uint32_t)size;
+			LkThreadPoolRun(pool, context->numChunks, WriteBatchTask, context);
+		}
+	}
+
+	LkFree(context->items);
+	LkFree(context->chunkSizes);
+	return context->result;
+}
+
+/*
+	Function: MvBatchInit
+		Helper function for the batch functions that initializes the <MvBatchContext> with the records to process.
+		The records are given by an array of strings, or by the RECORD section of a parsed <LkString>.
+
+	Arguments:
+		context - The context to initialize.
+		records - The array of records, or NULL to use "parsedResult".
+		count - Number of elements of "records".
+		parsedResult - The parsed <LkString>, if "records" is NULL.
+		spans - Output argument with the position of the records inside the RECORD section, if "parsedResult" is used. It must be released with <LkFreeSpans>.
+
+	Returns:
+		TRUE on success, FALSE if there is no memory.
+*/
+static BOOL MvBatchInit(MvBatchContext* context, const char** const records, uint32_t count, const LkParsedResult* const parsedResult, LkSpan** spans)
+{
+	memset(context, 0, sizeof(MvBatchContext));
+	*spans = NULL;
+	if(records || parsedResult == NULL)
+	{
+		context->records = records;
+		context->numRecords = records ? count : 0;
+		return TRUE;
+	}
+
+	LkStrView section;
+	if(!LkParsedGetSection(parsedResult, RECORDS_KEY, &section) || section.length == 0)
+		return TRUE;
+
+	*spans = LkStrSplitSpans(section.str, section.length, ASCII_RS, &context->numRecords);
+	context->section = section.str;
+	context->spans = *spans;
+	return *spans != NULL;
+}
+
+/*
+	Function: MvExtractBatch
+		Helper function for <LkExtractBatch> and <LkParsedExtractBatch>.
+*/
+static LkBatchResult* MvExtractBatch(const char** const records, uint32_t count, const LkParsedResult* const parsedResult, int32_t field, int32_t value, int32_t subvalue, const LkParallelConfig* const config, const char* const entryPoint)
+{
+	// Like LkExtract, there is nothing to extract if none of the positions is greater than 0
+	if(field <= 0 && value <= 0 && subvalue <= 0)
+		return NULL;
+
+	MvBatchContext context;
+	LkSpan* spans;
+	LkBatchResult* result = NULL;
+	if(MvBatchInit(&context, records, count, parsedResult, &spans))
+	{
+		context.operation = MvBatch_EXTRACT;
+		context.field = field;
+		context.value = value;
+		context.subvalue = subvalue;
+		result = MvBatch(&context, config, entryPoint);
+	}
+
+	LkFreeSpans(spans);
 	return result;
 }
 
+/*
+	Function: MvReplaceBatch
+		Helper function for <LkReplaceBatch> and <LkParsedReplaceBatch>.
+*/
+static LkBatchResult* MvReplaceBatch(const char** const records, uint32_t count, const LkParsedResult* const parsedResult, const char* const newVal, int32_t field, int32_t value, int32_t subvalue, const LkParallelConfig* const config, const char* const entryPoint)
+{
+	MvBatchContext context;
+	LkSpan* spans;
+	LkBatchResult* result = NULL;
+	if(MvBatchInit(&context, records, count, parsedResult, &spans))
+	{
+		context.operation = MvBatch_REPLACE;
+		context.field = field;
+		context.value = value;
+		context.subvalue = subvalue;
+		context.newStr = newVal;
+		context.lenNewStr = newVal ? strlen(newVal) : 0;
+		result = MvBatch(&context, config, entryPoint);
+	}
 
+	LkFreeSpans(spans);
+	return result;
+}
 
+/*
+	Function: MvChangeBatch
+		Helper function for <LkChangeBatch> and <LkParsedChangeBatch>.
+*/
+static LkBatchResult* MvChangeBatch(const char** const records, uint32_t count, const LkParsedResult* const parsedResult, const char* const oldStr, const char* const newStr, int32_t occurrence, int32_t start, const LkParallelConfig* const config, const char* const entryPoint)
+{
+	MvBatchContext context;
+	LkSpan* spans;
+	LkBatchResult* result = NULL;
+	MvSearch search;
+	uint32_t lenOldStr = oldStr ? strlen(oldStr) : 0;
+	if(MvBatchInit(&context, records, count, parsedResult, &spans))
+	{
+		context.operation = MvBatch_CHANGE;
+		context.newStr = newStr;
+		context.lenNewStr = newStr ? strlen(newStr) : 0;
+		context.occurrence = occurrence;
+		context.start = start < 1 ? 1 : start;
+		if(lenOldStr > 0)
+		{
+			MvSearchInit(&search, oldStr, lenOldStr);
+			context.search = &search;
+			context.lenOldStr = lenOldStr;
+		}
+		result = MvBatch(&context, config, entryPoint);
+	}
+
+	LkFreeSpans(spans);
+	return result;
+}
+
+/*
+	Function: LkExtractBatch
+		Extracts the same field, value or subvalue from many dynamic arrays, like <LkExtract> does with every one of them.
+		All the results are written in only one memory block, instead of allocating every one of them.
+
+	Arguments:
+		records - The array of dynamic arrays. The NULL elements are taken as empty strings.
+		count - Number of elements of "records".
+		field - The position of the attribute where you want to extract.
+		value - The multivalue position where you want to extract.
+		subvalue - The subvalue position where you want to extract.
+		config - The thread pool used to process the records in parallel, or NULL to use only the calling thread.
+			The records are processed in pieces of at least 1024 records, so the minChunkSize of <LkParallelConfig> is not used.
+
+	Returns:
+		The extracted values, or NULL if there is no memory or none of the positions is greater than 0. It must be released with <LkFreeBatchResult>.
+
+	Example:
+		--- Code
+		uint32_t count;
+		char** records = LkExtractRecords(lkStringResult, &count);
+		LkBatchResult* names = LkExtractBatch((const char**)records, count, 1, 0, 0, NULL);
+		for(int i=0; i<names->count; i++)
+			printf("%s\n", names->data + names->offsets[i]);
+		LkFreeBatchResult(names);
+		---
+
+	Also See:
+		<LkParsedExtractBatch>
+
+		<LkFreeBatchResult>
+*/
+DllEntry LkBatchResult* LkExtractBatch(const char** const records, uint32_t count, int32_t field, int32_t value, int32_t subvalue, const LkParallelConfig* const config)
+{
+	return MvExtractBatch(records, count, NULL, field, value, subvalue, config, __func__);
+}
+
+/*
+	Function: LkReplaceBatch
+		Replaces the same field, value or subvalue in many dynamic arrays, like <LkReplace> does with every one of them.
+		All the results are written in only one memory block, instead of allocating every one of them.
+
+	Arguments:
+		records - The array of dynamic arrays. The NULL elements are taken as empty strings.
+		count - Number of elements of "records".
+		newVal - The new value that will be replaced in every dynamic array.
+		field - The position of the attribute where you want to replace.
+		value - The multivalue position where you want to replace.
+		subvalue - The subvalue position where you want to replace.
+		config - The thread pool used to process the records in parallel, or NULL to use only the calling thread.
+			The records are processed in pieces of at least 1024 records, so the minChunkSize of <LkParallelConfig> is not used.
+
+	Returns:
+		The new dynamic arrays, or NULL if there is no memory. It must be released with <LkFreeBatchResult>.
+
+	Also See:
+		<LkParsedReplaceBatch>
+
+		<LkFreeBatchResult>
+*/
+DllEntry LkBatchResult* LkReplaceBatch(const char** const records, uint32_t count, const char* const newVal, int32_t field, int32_t value, int32_t subvalue, const LkParallelConfig* const config)
+{
+	return MvReplaceBatch(records, count, NULL, newVal, field, value, subvalue, config, __func__);
+}
+
+/*
+	Function: LkChangeBatch
+		Replaces the occurrences of a substring in many strings, like <LkChange> does with every one of them.
+		The substring is prepared only once for all the strings, and all the results are written in only one memory block.
+
+	Arguments:
+		records - The array of strings. The NULL elements are taken as empty strings.
+		count - Number of elements of "records".
+		oldStr - The value to change.
+		newStr - The new value.
+		occurrence - The number of times it will change in every string.
+		start - The occurrence from which you are going to start changing values in every string.
+		config - The thread pool used to process the records in parallel, or NULL to use only the calling thread.
+			The records are processed in pieces of at least 1024 records, so the minChunkSize of <LkParallelConfig> is not used.
+
+	Returns:
+		The new strings, or NULL if there is no memory. It must be released with <LkFreeBatchResult>.
+
+	Also See:
+		<LkParsedChangeBatch>
+
+		<LkFreeBatchResult>
+*/
+DllEntry LkBatchResult* LkChangeBatch(const char** const records, uint32_t count, const char* const oldStr, const char* const newStr, int32_t occurrence, int32_t start, const LkParallelConfig* const config)
+{
+	return MvChangeBatch(records, count, NULL, oldStr, newStr, occurrence, start, config, __func__);
+}
+
+/*
+	Function: LkParsedExtractBatch
+		Like <LkExtractBatch>, but with the records of the RECORD section of a parsed <LkString>. The records are not copied before the extraction.
+
+	Arguments:
+		parsedResult - The <LkString> parsed by <LkParseResult>.
+		field - The position of the attribute where you want to extract.
+		value - The multivalue position where you want to extract.
+		subvalue - The subvalue position where you want to extract.
+		config - The thread pool used to process the records in parallel, or NULL to use only the calling thread.
+
+	Returns:
+		The extracted values, one for every record, or NULL if there is no memory or none of the positions is greater than 0. It must be released with <LkFreeBatchResult>.
+*/
+DllEntry LkBatchResult* LkParsedExtractBatch(const LkParsedResult* const parsedResult, int32_t field, int32_t value, int32_t subvalue, const LkParallelConfig* const config)
+{
+	return MvExtractBatch(NULL, 0, parsedResult, field, value, subvalue, config, __func__);
+}
+
+/*
+	Function: LkParsedReplaceBatch
+		Like <LkReplaceBatch>, but with the records of the RECORD section of a parsed <LkString>.
+
+	Arguments:
+		parsedResult - The <LkString> parsed by <LkParseResult>.
+		newVal - The new value that will be replaced in every record.
+		field - The position of the attribute where you want to replace.
+		value - The multivalue position where you want to replace.
+		subvalue - The subvalue position where you want to replace.
+		config - The thread pool used to process the records in parallel, or NULL to use only the calling thread.
+
+	Returns:
+		The new records, or NULL if there is no memory. It must be released with <LkFreeBatchResult>.
+*/
+DllEntry LkBatchResult* LkParsedReplaceBatch(const LkParsedResult* const parsedResult, const char* const newVal, int32_t field, int32_t value, int32_t subvalue, const LkParallelConfig* const config)
+{
+	return MvReplaceBatch(NULL, 0, parsedResult, newVal, field, value, subvalue, config, __func__);
+}
+
+/*
+	Function: LkParsedChangeBatch
+		Like <LkChangeBatch>, but with the records of the RECORD section of a parsed <LkString>.
+
+	Arguments:
+		parsedResult - The <LkString> parsed by <LkParseResult>.
+		oldStr - The value to change.
+		newStr - The new value.
+		occurrence - The number of times it will change in every record.
+		start - The occurrence from which you are going to start changing values in every record.
+		config - The thread pool used to process the records in parallel, or NULL to use only the calling thread.
+
+	Returns:
+		The new records, or NULL if there is no memory. It must be released with <LkFreeBatchResult>.
+*/
+DllEntry LkBatchResult* LkParsedChangeBatch(const LkParsedResult* const parsedResult, const char* const oldStr, const char* const newStr, int32_t occurrence, int32_t start, const LkParallelConfig* const config)
+{
+	return MvChangeBatch(NULL, 0, parsedResult, oldStr, newStr, occurrence, start, config, __func__);
+}
+
+/*
+	Function: LkFreeBatchResult
+		Releases the results of a batch function, like <LkExtractBatch>.
+
+	Arguments:
+		batchResult - The results to release.
+
+	Also See:
+		<Release Memory>
+*/
+DllEntry void LkFreeBatchResult(LkBatchResult* batchResult)
+{
+	LkFree(batchResult);
+}
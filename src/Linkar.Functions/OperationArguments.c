@@ -24,10 +24,101 @@
 #include "OperationArguments.h"
 #include "LinkarStringsHelper.h"
 #include "OperationOptions.h"
+#include "MvOperations.h"
+#include "LinkarMemory.h"
+#include <stdlib.h>
+#include <string.h>
 #ifndef _MSC_VER
 	#include <malloc.h>
 #endif
 
+/*
+	Function: LkEncodeOperationArgs
+		Composes the 3 items (CUSTOMVARS, OPTIONS and INPUTDATA) of any operation in one pass, into a buffer provided by the caller.
+		The items of INPUTDATA are joined with the separators given, and the 3 items with the Unit Separator character (31).
+		The length is known before anything is copied, so the records of a big Update are copied only once.
+		If the buffer is too short, only the first "capacity" - 1 chars are copied, and the function returns the total length,
+		so it can be called again with a buffer of the right size.
+
+	Arguments:
+		customVars - It's a free text that will travel until the database to make the admin being able to manage additional behaviours in the standard routine SUB.LK.MAIN.CONTROL.CUSTOM. NULL is the same as an empty string.
+		options - The options of the operation, for example created with <LkCreateReadOptions>. NULL is the same as an empty string.
+		inputItems - Array with the items of INPUTDATA, for example the filename and the buffer created with <LkComposeUpdateBuffer>. The NULL items are empty.
+		separators - String with the separator after every item of "inputItems" but the last one, for example <DBMV_Mark_AM_str> or <ASCII_FS_str>. Its length must be "numItems" - 1.
+		numItems - Number of items of "inputItems". If 0, INPUTDATA is empty and "inputItems" can be NULL.
+		buffer - Where the result is written. It is always NUL terminated, unless "capacity" is 0. It can be NULL if "capacity" is 0.
+		capacity - Size of "buffer", including the NUL terminator.
+
+	Returns:
+		The length of the 3 items, without the NUL terminator.
+
+	Example:
+		--- Code
+		const char* inputItems[2] = { "LK.CUSTOMERS", records };
+		uint32_t length = LkEncodeOperationArgs(NULL, updateOptions, inputItems, DBMV_Mark_AM_str, 2, NULL, 0);
+		char* operationArguments = malloc(length + 1);
+		LkEncodeOperationArgs(NULL, updateOptions, inputItems, DBMV_Mark_AM_str, 2, operationArguments, length + 1);
+		---
+
+	See Also:
+		<LkExecuteDirectOperation>
+
+		<LkExecutePersistentOperation>
+*/
+DllEntry uint32_t LkEncodeOperationArgs(const char* const customVars, const char* const options, const char* const* const inputItems,
+										const char* const separators, uint32_t numItems, char* buffer, uint32_t capacity)
+{
+	// The items are written in order, with a separator before every item but the first one
+	const char* items[2] = { customVars, options };
+	uint32_t length = 0;
+	uint32_t i;
+	for(i = 0; i < (numItems > 0 ? numItems : 1) + 2; i++)
+	{
+		const char* item = i < 2 ? items[i] : (numItems > 0 ? inputItems[i - 2] : NULL);
+		uint32_t itemLength = item ? strlen(item) : 0;
+		uint32_t room = capacity > length + 1 ? capacity - length - 1 : 0;
+
+		if(i > 0)
+		{
+			if(room > 0)
+			{
+				buffer[length] = i < 3 ? ASCII_US : separators[i - 3];
+				room--;
+			}
+			length++;
+		}
+
+		if(room > 0 && itemLength > 0)
+			memcpy(buffer + length, item, itemLength < room ? itemLength : room);
+		length += itemLength;
+	}
+
+	if(capacity > 0)
+		buffer[length < capacity ? length : capacity - 1] = 0;
+
+	return length;
+}
+
+/*
+	Function: EncodeArgs
+		Helper function of the LkGet*Args functions, that allocates the exact memory of the 3 items and composes them with <LkEncodeOperationArgs>.
+
+	Arguments:
+		entryPoint - Name of the function that requests the memory, for <LkSetMemoryAccounting>.
+
+	Returns:
+		The 3 items, or NULL if there is no memory.
+*/
+static char* EncodeArgs(const char* const customVars, const char* const options, const char* const* const inputItems, const char* const separators, uint32_t numItems, const char* const entryPoint)
+{
+	uint32_t length = LkEncodeOperationArgs(customVars, options, inputItems, separators, numItems, NULL, 0);
+	char* operationArguments = length < UINT32_MAX ? LkMallocFrom(length + 1, entryPoint) : NULL;
+	if(operationArguments != NULL)
+		LkEncodeOperationArgs(customVars, options, inputItems, separators, numItems, operationArguments, length + 1);
+
+	return operationArguments;
+}
+
 /* 
 	Function: LkGetReadArgs
 		Compose the 3 items (CUSTOMVARS, OPTIONS and INPUTDATA) of the Read operation.
@@ -56,26 +147,15 @@
 */
 DllEntry char* LkGetReadArgs(const char* const filename, const char* const recordIds, const char* const dictionaries, const char* const readOptions, const char* const customVars)
 {
-	char* readOpt;
+	const char* readOpt;
 	if(readOptions == NULL || *readOptions == 0)
-		readOpt = LkCreateReadOptions(FALSE, FALSE, FALSE, FALSE);
+		readOpt = LkGetDefaultOptions(OP_CODE_READ);
 	else
-		readOpt = (char*)readOptions;
+		readOpt = readOptions;
 	
 	//inputData = filename + DBMV_Mark.AM + recordIds + DBMV_Mark.AM + dictionaries;
-	char* aux = LkCatString(filename, recordIds, DBMV_Mark_AM_str);
-	char* inputData = LkCatString(aux, dictionaries, DBMV_Mark_AM_str);
-	free (aux);
-		
-	//operationArguments = customVars + ASCII_Chars.US_str + options + ASCII_Chars.US_str + inputData;
-	aux = LkCatString(customVars, readOpt, ASCII_US_str);
-	char* operationArguments = LkCatString(aux, inputData, ASCII_US_str);
-		
-	free(aux);
-	free(inputData);
-	
-	if(readOptions != readOpt)
-		free(readOpt);
+	const char* inputItems[3] = { filename, recordIds, dictionaries };
+	char* operationArguments = EncodeArgs(customVars, readOpt, inputItems, DBMV_Mark_AM_str DBMV_Mark_AM_str, 3, __func__);
 	
 	return operationArguments;
 }
@@ -105,23 +185,15 @@ DllEntry char* LkGetReadArgs(const char* const filename, const char* const recor
 */
 DllEntry char* LkGetUpdateArgs(const char* const filename, const char* const records, const char* const updateOptions, const char* const customVars)
 {
-	char* updateOpt;
+	const char* updateOpt;
 	if(updateOptions == NULL || *updateOptions == 0)
-		updateOpt = LkCreateUpdateOptions(FALSE, FALSE, FALSE, FALSE, FALSE, FALSE);
+		updateOpt = LkGetDefaultOptions(OP_CODE_UPDATE);
 	else
-		updateOpt = (char*)updateOptions;
+		updateOpt = updateOptions;
 	
 	//inputData = filename + DBMV_Mark.AM + records;
-	char* inputData = LkCatString(filename, records, DBMV_Mark_AM_str);
-
-	//operationArguments = customVars + ASCII_Chars.US_str + options + ASCII_Chars.US_str + inputData;
-	char*aux = LkCatString(customVars, updateOpt, ASCII_US_str);
-	char* operationArguments= LkCatString(aux, inputData, ASCII_US_str);
-	free(aux);
-	free(inputData);
-	
-	if(updateOptions != updateOpt)
-		free(updateOpt);
+	const char* inputItems[2] = { filename, records };
+	char* operationArguments = EncodeArgs(customVars, updateOpt, inputItems, DBMV_Mark_AM_str, 2, __func__);
 	
 	return operationArguments;
 }
@@ -151,25 +223,15 @@ DllEntry char* LkGetUpdateArgs(const char* const filename, const char* const rec
 */
 DllEntry char* LkGetUpdatePartialArgs(const char* const filename, const char* const records, const char* const dictionaries, const char* const updateOptions, const char* const customVars)
 {
-	char* updateOpt;
+	const char* updateOpt;
 	if(updateOptions == NULL || *updateOptions == 0)
-		updateOpt = LkCreateUpdateOptions(FALSE, FALSE, FALSE, FALSE, FALSE, FALSE);
+		updateOpt = LkGetDefaultOptions(OP_CODE_UPDATE);
 	else
-		updateOpt = (char*)updateOptions;
+		updateOpt = updateOptions;
 	
 	//inputData = filename + DBMV_Mark.AM + records + ASCII_Chars.FS_str + dictionaries;
-	char* partialInputData = LkCatString(filename, records, DBMV_Mark_AM_str);
-	char* inputData = LkCatString(partialInputData, dictionaries, ASCII_FS_str);
-	free(partialInputData);
-
-	//operationArguments = customVars + ASCII_Chars.US_str + options + ASCII_Chars.US_str + inputData;
-	char*aux = LkCatString(customVars, updateOpt, ASCII_US_str);
-	char* operationArguments= LkCatString(aux, inputData, ASCII_US_str);
-	free(aux);
-	free(inputData);
-	
-	if(updateOptions != updateOpt)
-		free(updateOpt);
+	const char* inputItems[3] = { filename, records, dictionaries };
+	char* operationArguments = EncodeArgs(customVars, updateOpt, inputItems, DBMV_Mark_AM_str ASCII_FS_str, 3, __func__);
 	
 	return operationArguments;
 }
@@ -199,23 +261,15 @@ DllEntry char* LkGetUpdatePartialArgs(const char* const filename, const char* co
 */
 DllEntry char* LkGetNewArgs(const char* const filename, const char* const records, const char* const newOptions, const char* const customVars)
 {
-	char* newOpt;
+	const char* newOpt;
 	if(newOptions == NULL || *newOptions == 0)
-		newOpt = LkCreateNewOptions(NULL, FALSE, FALSE, FALSE, FALSE, FALSE);
+		newOpt = LkGetDefaultOptions(OP_CODE_NEW);
 	else
-		newOpt = (char*)newOptions;
+		newOpt = newOptions;
 	
 	//inputData = filename + DBMV_Mark.AM + records;
-	char* inputData = LkCatString(filename, records, DBMV_Mark_AM_str);
-
-	//operationArguments = customVars + ASCII_Chars.US_str + options + ASCII_Chars.US_str + inputData;
-	char*aux = LkCatString(customVars, newOpt, ASCII_US_str);
-	char* operationArguments= LkCatString(aux, inputData, ASCII_US_str);
-	free(aux);
-	free(inputData);
-	
-	if(newOptions != newOpt)
-		free(newOpt);
+	const char* inputItems[2] = { filename, records };
+	char* operationArguments = EncodeArgs(customVars, newOpt, inputItems, DBMV_Mark_AM_str, 2, __func__);
 	
 	return operationArguments;
 }
@@ -245,23 +299,15 @@ DllEntry char* LkGetNewArgs(const char* const filename, const char* const record
 */
 DllEntry char* LkGetDeleteArgs(const char* const filename, const char* const records, const char* deleteOptions, const char* const customVars)
 {
-	char* deleteOpt;
+	const char* deleteOpt;
 	if(deleteOptions == NULL || *deleteOptions == 0)
-		deleteOpt = LkCreateDeleteOptions(FALSE, NULL);
+		deleteOpt = LkGetDefaultOptions(OP_CODE_DELETE);
 	else
-		deleteOpt = (char*)deleteOptions;
+		deleteOpt = deleteOptions;
 	
 	//inputData = filename + DBMV_Mark.AM + records;
-	char* inputData = LkCatString(filename, records, DBMV_Mark_AM_str);
-	
-	//operationArguments = customVars + ASCII_Chars.US_str + options + ASCII_Chars.US_str + inputData;
-	char*aux = LkCatString(customVars, deleteOpt, ASCII_US_str);
-	char* operationArguments= LkCatString(aux, inputData, ASCII_US_str);
-	free(aux);
-	free(inputData);
-	
-	if(deleteOptions != deleteOpt)
-		free(deleteOpt);
+	const char* inputItems[2] = { filename, records };
+	char* operationArguments = EncodeArgs(customVars, deleteOpt, inputItems, DBMV_Mark_AM_str, 2, __func__);
 	
 	return operationArguments;
 }
@@ -296,31 +342,15 @@ DllEntry char* LkGetSelectArgs(const char* const filename, const char* const sel
 							 const char* const sortClause, const char* const dictClause, const char* const preSelectClause,
 							 const char* const selectOptions, const char* const customVars)
 {
-	char* selectOpt;
+	const char* selectOpt;
 	if(selectOptions == NULL || *selectOptions == 0)
-		selectOpt = LkCreateSelectOptions(FALSE, FALSE, 0, 0, FALSE, FALSE, FALSE, FALSE);
+		selectOpt = LkGetDefaultOptions(OP_CODE_SELECT);
 	else
-		selectOpt = (char*)selectOptions;
+		selectOpt = selectOptions;
 	
 	//inputData = filename + DBMV_Mark.AM + selectClause + DBMV_Mark.AM + sortClause + DBMV_Mark.AM + dictClause + DBMV_Mark.AM + preSelectClause;
-	char* aux = LkCatString(filename, selectClause, DBMV_Mark_AM_str);
-	char* inputData = LkCatString(aux, sortClause, DBMV_Mark_AM_str);
-	free(aux);
-	aux = inputData;
-	inputData = LkCatString(inputData, dictClause, DBMV_Mark_AM_str);
-	free(aux);
-	aux = inputData;
-	inputData = LkCatString(inputData, preSelectClause, DBMV_Mark_AM_str);
-	free(aux);
-	
-    //operationArguments  = customVars + ASCII_Chars.US_str + options + ASCII_Chars.US_str + inputData;
-	aux = LkCatString(customVars, selectOpt, ASCII_US_str);	
-	char* operationArguments = LkCatString(aux, inputData, ASCII_US_str);
-	free(aux);
-	free(inputData);
-	
-	if(selectOptions != selectOpt)
-		free(selectOpt);
+	const char* inputItems[5] = { filename, selectClause, sortClause, dictClause, preSelectClause };
+	char* operationArguments = EncodeArgs(customVars, selectOpt, inputItems, DBMV_Mark_AM_str DBMV_Mark_AM_str DBMV_Mark_AM_str DBMV_Mark_AM_str, 5, __func__);
 	
 	return operationArguments;
 }
@@ -349,20 +379,9 @@ DllEntry char* LkGetSubroutineArgs(const char* const subroutineName, uint32_t ar
 	char argsNumberStr[100];
 	sprintf(argsNumberStr,"%d",argsNumber);
 	
-	//inputData = inputData1 + ASCII_Chars.FS_str + inputData2;
-	char* inputData1 = LkCatString(subroutineName, argsNumberStr, DBMV_Mark_AM_str);
-	char* inputData2 = (char*)arguments;
-	char* inputData = LkCatString(inputData1, inputData2, ASCII_FS_str);
-	free(inputData1);
-	
-    //operationArguments  = customVars + ASCII_Chars.US_str + options + ASCII_Chars.US_str + inputData;
-	char* options = NULL;
-	char* aux = LkCatString(customVars, options, ASCII_US_str);	
-	char* operationArguments = LkCatString(aux, inputData, ASCII_US_str);
-	free(aux);
-	free(inputData);
-
-	return operationArguments;	
+	//inputData = subroutineName + DBMV_Mark.AM + argsNumber + ASCII_Chars.FS_str + arguments;
+	const char* inputItems[3] = { subroutineName, argsNumberStr, arguments };
+	return EncodeArgs(customVars, NULL, inputItems, DBMV_Mark_AM_str ASCII_FS_str, 3, __func__);
 }
 
 
@@ -393,16 +412,10 @@ DllEntry char* LkGetConversionArgs(const char* const expression, const char* con
 		strConversionType = "I";
 	else
 		strConversionType = "O";
-		//inputData = code + ASCII_Chars.FS_str + expression;
-	char* inputData = LkCatString(code, expression, ASCII_FS_str);
-	
-	//operationArguments = customVars + ASCII_Chars.US_str + strConversionType + ASCII_Chars.US_str + inputData;
-	char* aux = LkCatString(customVars, strConversionType, ASCII_US_str);
-	char* operationArguments = LkCatString(aux, inputData, ASCII_US_str);
-	free(aux);
-	free(inputData);
 	
-	return operationArguments;
+	//inputData = code + ASCII_Chars.FS_str + expression;
+	const char* inputItems[2] = { code, expression };
+	return EncodeArgs(customVars, strConversionType, inputItems, ASCII_FS_str, 2, __func__);
 }
 
 
@@ -427,14 +440,9 @@ DllEntry char* LkGetConversionArgs(const char* const expression, const char* con
 */
 DllEntry char* LkGetFormatArgs(const char* const expression, const char* const formatSpec, const char* const customVars)
 {
-	char* options = NULL;
-	char* inputData = LkCatString(formatSpec, expression, ASCII_FS_str);
-	
-	char* aux = LkCatString(customVars, options, ASCII_US_str);
-	char* operationArguments = LkCatString(aux, inputData, ASCII_US_str);
-	free(aux);
-	
-	return operationArguments;
+	//inputData = formatSpec + ASCII_Chars.FS_str + expression;
+	const char* inputItems[2] = { formatSpec, expression };
+	return EncodeArgs(customVars, NULL, inputItems, ASCII_FS_str, 2, __func__);
 }
 
 
@@ -458,12 +466,8 @@ DllEntry char* LkGetFormatArgs(const char* const expression, const char* const f
 */
 DllEntry char* LkGetDictionariesArgs(const char* const filename, const char* const customVars)
 {
-	char* options = NULL;
-	char* aux = LkCatString(customVars, options, ASCII_US_str);
-	char* operationArguments = LkCatString(aux, filename, ASCII_US_str);
-	free(aux);
-	
-	return operationArguments;
+	const char* inputItems[1] = { filename };
+	return EncodeArgs(customVars, NULL, inputItems, "", 1, __func__);
 }
 
 
@@ -487,12 +491,8 @@ DllEntry char* LkGetDictionariesArgs(const char* const filename, const char* con
 */
 DllEntry char* LkGetExecuteArgs(const char* const statement, const char* const customVars)
 {
-	char* options = NULL;
-	char* aux = LkCatString(customVars, options, ASCII_US_str);
-	char* operationArguments = LkCatString(aux, statement, ASCII_US_str);
-	free(aux);
-	
-	return operationArguments;
+	const char* inputItems[1] = { statement };
+	return EncodeArgs(customVars, NULL, inputItems, "", 1, __func__);
 }
 
 
@@ -512,14 +512,7 @@ DllEntry char* LkGetExecuteArgs(const char* const statement, const char* const c
 */
 DllEntry char* LkGetGetVersionArgs()
 {
-	char* customVars = NULL;
-	char* options = NULL;
-	char* inputData = NULL;
-	char* aux = LkCatString(customVars, options, ASCII_US_str);
-	char* operationArguments = LkCatString(aux, inputData, ASCII_US_str);
-	free(aux);
-	
-	return operationArguments;
+	return EncodeArgs(NULL, NULL, NULL, "", 0, __func__);
 }
 
 
@@ -544,20 +537,13 @@ DllEntry char* LkGetGetVersionArgs()
 */
 DllEntry char* LkGetLkSchemasArgs(const char* const lkSchemasOptions, const char* const customVars)
 {
-	char* inputData = NULL;
-	
-	char* lkSchemasOpt;
+	const char* lkSchemasOpt;
 	if(lkSchemasOptions == NULL || *lkSchemasOptions == 0)
-		lkSchemasOpt = LkCreateSchOptionsTypeLKSCHEMAS(RowHeadersTYPE_MAINLABEL, FALSE, FALSE, FALSE, 0, 0);
+		lkSchemasOpt = LkGetDefaultOptions(OP_CODE_LKSCHEMAS);
 	else
-		lkSchemasOpt = (char*)lkSchemasOptions;
+		lkSchemasOpt = lkSchemasOptions;
 
-	char* aux = LkCatString(customVars, lkSchemasOptions, ASCII_US_str);
-	char* operationArguments = LkCatString(aux, inputData, ASCII_US_str);
-	free(aux);
-	
-	if(lkSchemasOptions != lkSchemasOpt)
-		free(lkSchemasOpt);
+	char* operationArguments = EncodeArgs(customVars, lkSchemasOpt, NULL, "", 0, __func__);
 
 	return operationArguments;
 }
@@ -590,18 +576,14 @@ DllEntry char* LkGetLkSchemasArgs(const char* const lkSchemasOptions, const char
 */
 DllEntry char* LkGetLkPropertiesArgs(const char* const filename, const char* const lkPropertiesOptions, const char* const customVars)
 {
-	char* lkPropertiesOpt;
+	const char* lkPropertiesOpt;
 	if(lkPropertiesOptions == NULL || *lkPropertiesOptions == 0)
-		lkPropertiesOpt = LkCreatePropOptionsTypeLKSCHEMAS(RowHeadersTYPE_MAINLABEL, FALSE, FALSE, FALSE, FALSE, 0, 0);
+		lkPropertiesOpt = LkGetDefaultOptions(OP_CODE_LKPROPERTIES);
 	else
-		lkPropertiesOpt = (char*)lkPropertiesOptions;
+		lkPropertiesOpt = lkPropertiesOptions;
 
-	char* aux = LkCatString(customVars, lkPropertiesOptions, ASCII_US_str);
-	char* operationArguments = LkCatString(aux, filename, ASCII_US_str);
-	free(aux);
-	
-	if(lkPropertiesOptions != lkPropertiesOpt)
-		free(lkPropertiesOpt);
+	const char* inputItems[1] = { filename };
+	char* operationArguments = EncodeArgs(customVars, lkPropertiesOpt, inputItems, "", 1, __func__);
 
 	return operationArguments;	
 }
@@ -640,30 +622,17 @@ DllEntry char* LkGetLkPropertiesArgs(const char* const filename, const char* con
 DllEntry char* LkGetGetTableArgs(const char* const filename, const char* const selectClause, const char* const dictClause, const char* const sortClause,
                                const char* const tableOptions, const char* const customVars)
 {
-   char* aux = LkCatString(filename, selectClause, DBMV_Mark_AM_str);   
-   char* inputData = LkCatString(aux, dictClause, DBMV_Mark_AM_str);
-   free(aux);
-   aux = inputData;
-   inputData = LkCatString(inputData, sortClause, DBMV_Mark_AM_str);
-   free(aux);
-
-	char* tableOpt;
+	const char* tableOpt;
 	if(tableOptions == NULL || *tableOptions == 0)
-		tableOpt = LkCreateTableOptionsTypeLKSCHEMAS(RowHeadersTYPE_MAINLABEL, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, 0, 0);
-		
-		
+		tableOpt = LkGetDefaultOptions(OP_CODE_GETTABLE);
 	else
-		tableOpt = (char*)tableOptions;
-   
-   aux = LkCatString(customVars, tableOptions, ASCII_US_str);
-   char* operationArguments = LkCatString(aux, inputData, ASCII_US_str);
-   free(aux);
-   free(inputData);
+		tableOpt = tableOptions;
 
-	if(tableOptions != tableOpt)
-		free(tableOpt);
+	//inputData = filename + DBMV_Mark.AM + selectClause + DBMV_Mark.AM + dictClause + DBMV_Mark.AM + sortClause;
+	const char* inputItems[4] = { filename, selectClause, dictClause, sortClause };
+	char* operationArguments = EncodeArgs(customVars, tableOpt, inputItems, DBMV_Mark_AM_str DBMV_Mark_AM_str DBMV_Mark_AM_str, 4, __func__);
    
-   return operationArguments;
+	return operationArguments;
 }
 
 
@@ -683,12 +652,293 @@ DllEntry char* LkGetGetTableArgs(const char* const filename, const char* const s
 */
 DllEntry char* LkGetResetCommonBlocksArgs()
 {
-	char* customVars = NULL;
-	char* options = NULL;
-	char* inputData = NULL;
-	char* aux = LkCatString(customVars, options, ASCII_US_str);
-	char* operationArguments = LkCatString(aux, inputData, ASCII_US_str);
-	free(aux);
-	
+	return EncodeArgs(NULL, NULL, NULL, "", 0, __func__);
+}
+
+/*
+	The prepared operations keep the 3 items already composed, and the position of the only part that changes between calls:
+	the numPage of the pagination options for Select and GetTable, or the recordIds for Read.
+*/
+struct LkPreparedOperation
+{
+	uint8_t operationCode;
+	char* operationArguments;
+	uint32_t length;
+	uint32_t slot;
+	uint32_t slotLength;
+};
+
+/*
+	Function: PrepareOperation
+		Helper function of the LkPrepare* functions, that composes the 3 items once and keeps the position of the variable part.
+
+	Arguments:
+		operationCode - The code of the operation, <OP_CODE_READ>, <OP_CODE_SELECT> or <OP_CODE_GETTABLE>.
+		customVars - The customVars of the operation.
+		options - The options of the operation.
+		inputItems - The items of INPUTDATA.
+		separators - The separators between the items of INPUTDATA.
+		numItems - Number of items of "inputItems".
+		slotItem - The item where the variable part is: 1 for the options, or 2 + the index of an item of INPUTDATA.
+		slot - Offset of the variable part inside the item.
+		slotLength - Length of the variable part inside the item.
+		entryPoint - Name of the function that requests the memory, for <LkSetMemoryAccounting>.
+
+	Returns:
+		The prepared operation, or NULL if there is no memory.
+*/
+static LkPreparedOperation* PrepareOperation(uint8_t operationCode, const char* const customVars, const char* const options, const char* const* const inputItems,
+											 const char* const separators, uint32_t numItems, uint32_t slotItem, uint32_t slot, uint32_t slotLength, const char* const entryPoint)
+{
+	LkPreparedOperation* prepared = LkMallocFrom(sizeof(LkPreparedOperation), entryPoint);
+	if(prepared == NULL)
+		return NULL;
+
+	prepared->operationArguments = EncodeArgs(customVars, options, inputItems, separators, numItems, entryPoint);
+	if(prepared->operationArguments == NULL)
+	{
+		LkFree(prepared);
+		return NULL;
+	}
+
+	// Every item before the slot adds its length and its separator
+	const char* items[2] = { customVars, options };
+	uint32_t i;
+	for(i = 0; i < slotItem; i++)
+	{
+		const char* item = i < 2 ? items[i] : inputItems[i - 2];
+		slot += (item ? strlen(item) : 0) + 1;
+	}
+
+	prepared->operationCode = operationCode;
+	prepared->length = strlen(prepared->operationArguments);
+	prepared->slot = slot;
+	prepared->slotLength = slotLength;
+
+	return prepared;
+}
+
+/*
+	Function: PreparePaginatedOperation
+		Helper function of <LkPrepareSelect> and <LkPrepareGetTable>, that finds the numPage inside the options when the pagination is used.
+		Without pagination, the prepared operation has no variable part.
+
+	Arguments:
+		paginationField - The field of the options with the pagination, numPage: "1" VM regPage VM numPage.
+*/
+static LkPreparedOperation* PreparePaginatedOperation(uint8_t operationCode, const char* const customVars, const char* const options, uint32_t paginationField,
+													  const char* const* const inputItems, const char* const separators, uint32_t numItems, const char* const entryPoint)
+{
+	uint32_t length = strlen(options);
+	LkStrView pagination;
+	LkStrView numPage;
+	if(LkExtractView(options, length, paginationField, 1, 0, &pagination) && pagination.length == 1 && *pagination.str == '1'
+	   && LkExtractView(options, length, paginationField, 3, 0, &numPage))
+		return PrepareOperation(operationCode, customVars, options, inputItems, separators, numItems, 1, numPage.str - options, numPage.length, entryPoint);
+
+	return PrepareOperation(operationCode, customVars, options, inputItems, separators, numItems, 1, 0, 0, entryPoint);
+}
+
+/*
+	Function: LkPrepareRead
+		Composes once the 3 items (CUSTOMVARS, OPTIONS and INPUTDATA) of a Read operation that is executed many times with different records.
+		Only the recordIds are given in every call, with <LkGetPreparedReadArgs> or <Base_LkReadPrepared>.
+
+	Arguments:
+		filename - File name to read.
+		dictionaries - List of dictionaries to read, separated by space. If dictionaries are not indicated the function will read the complete buffer.
+		readOptions - String that defines the different reading options of the Function: Calculated, dictClause, conversion, formatSpec, originalRecords.
+		customVars - It's a free text that will travel until the database to make the admin being able to manage additional behaviours in the standard routine SUB.LK.MAIN.CONTROL.CUSTOM. This routine will be called if the argument has content.
+
+	Returns:
+		The prepared operation, or NULL if there is no memory. It must be released with <LkFreePreparedOperation>.
+
+	See Also:
+		<LkGetPreparedReadArgs>
+
+		<LkFreePreparedOperation>
+*/
+DllEntry LkPreparedOperation* LkPrepareRead(const char* const filename, const char* const dictionaries, const char* const readOptions, const char* const customVars)
+{
+	const char* readOpt;
+	if(readOptions == NULL || *readOptions == 0)
+		readOpt = LkGetDefaultOptions(OP_CODE_READ);
+	else
+		readOpt = readOptions;
+
+	//inputData = filename + DBMV_Mark.AM + recordIds + DBMV_Mark.AM + dictionaries;
+	const char* inputItems[3] = { filename, NULL, dictionaries };
+	return PrepareOperation(OP_CODE_READ, customVars, readOpt, inputItems, DBMV_Mark_AM_str DBMV_Mark_AM_str, 3, 3, 0, 0, __func__);
+}
+
+/*
+	Function: LkPrepareSelect
+		Composes once the 3 items (CUSTOMVARS, OPTIONS and INPUTDATA) of a Select operation that is executed many times, for example to get the pages of a grid.
+		Only the numPage is given in every call, with <LkGetPreparedPageArgs> or <Base_LkSelectPrepared>.
+
+	Arguments:
+		filename - File name where the select operation will be perform. For example LK.ORDERS
+		selectClause - Fragment of the phrase that indicate the selection condition. For example WITH CUSTOMER = '1'
+		sortClause - Fragment of the phrase that indicates the selection order. For example BY CUSTOMER
+		dictClause - Is the list of dictionaries to read, separated by space. For example CUSTOMER DATE ITEM
+		preSelectClause - It's an optional statement that will execute before the main Select.
+		selectOptions - String created with <LkCreateSelectOptions>. If the pagination is used, its numPage is replaced in every call.
+		customVars - It's a free text that will travel until the database to make the admin being able to manage additional behaviours in the standard routine SUB.LK.MAIN.CONTROL.CUSTOM. This routine will be called if the argument has content.
+
+	Returns:
+		The prepared operation, or NULL if there is no memory. It must be released with <LkFreePreparedOperation>.
+
+	Example:
+		--- Code
+		char* selectOptions = LkCreateSelectOptions(FALSE, TRUE, 50, 1, FALSE, FALSE, FALSE, FALSE);
+		LkPreparedOperation* prepared = LkPrepareSelect("LK.ORDERS", "WITH CUSTOMER = '1'", "BY DATE", "", "", selectOptions, "");
+		free(selectOptions);
+		for(uint32_t numPage=1; numPage<=numPages; numPage++)
+		{
+			char* result = Base_LkSelectPrepared(&error, connectionInfo, prepared, numPage, DataFormatCruTYPE_MV, 0);
+			...
+		}
+		LkFreePreparedOperation(prepared);
+		---
+
+	See Also:
+		<LkGetPreparedPageArgs>
+
+		<LkFreePreparedOperation>
+*/
+DllEntry LkPreparedOperation* LkPrepareSelect(const char* const filename, const char* const selectClause, const char* const sortClause, const char* const dictClause,
+											  const char* const preSelectClause, const char* const selectOptions, const char* const customVars)
+{
+	const char* selectOpt;
+	if(selectOptions == NULL || *selectOptions == 0)
+		selectOpt = LkGetDefaultOptions(OP_CODE_SELECT);
+	else
+		selectOpt = selectOptions;
+
+	const char* inputItems[5] = { filename, selectClause, sortClause, dictClause, preSelectClause };
+	return PreparePaginatedOperation(OP_CODE_SELECT, customVars, selectOpt, 1, inputItems, DBMV_Mark_AM_str DBMV_Mark_AM_str DBMV_Mark_AM_str DBMV_Mark_AM_str, 5, __func__);
+}
+
+/*
+	Function: LkPrepareGetTable
+		Composes once the 3 items (CUSTOMVARS, OPTIONS and INPUTDATA) of a GetTable operation that is executed many times, for example to get the pages of a grid.
+		Only the numPage is given in every call, with <LkGetPreparedPageArgs> or <Base_LkGetTablePrepared>.
+
+	Arguments:
+		filename - File or table name defined in Linkar Schemas. Table notation is: MainTable[.MVTable[.SVTable]]
+		selectClause - Fragment of the phrase that indicate the selection condition. For example WITH CUSTOMER = '1'
+		dictClause - Is the list of dictionaries to read, separated by space. For example CUSTOMER DATE ITEM
+		sortClause - Fragment of the phrase that indicates the selection order. For example BY CUSTOMER
+		tableOptions - String created with <LkCreateTableOptionsTypeLKSCHEMAS> or the other LkCreateTableOptions* functions. If the pagination is used, its numPage is replaced in every call.
+		customVars - It's a free text that will travel until the database to make the admin being able to manage additional behaviours in the standard routine SUB.LK.MAIN.CONTROL.CUSTOM. This routine will be called if the argument has content.
+
+	Returns:
+		The prepared operation, or NULL if there is no memory. It must be released with <LkFreePreparedOperation>.
+
+	See Also:
+		<LkGetPreparedPageArgs>
+
+		<LkFreePreparedOperation>
+*/
+DllEntry LkPreparedOperation* LkPrepareGetTable(const char* const filename, const char* const selectClause, const char* const dictClause, const char* const sortClause,
+												const char* const tableOptions, const char* const customVars)
+{
+	const char* tableOpt;
+	if(tableOptions == NULL || *tableOptions == 0)
+		tableOpt = LkGetDefaultOptions(OP_CODE_GETTABLE);
+	else
+		tableOpt = tableOptions;
+
+	// The pagination is the last field of the table options
+	const char* inputItems[4] = { filename, selectClause, dictClause, sortClause };
+	return PreparePaginatedOperation(OP_CODE_GETTABLE, customVars, tableOpt, 11, inputItems, DBMV_Mark_AM_str DBMV_Mark_AM_str DBMV_Mark_AM_str, 4, __func__);
+}
+
+/*
+	Function: GetPreparedArgs
+		Helper function of <LkGetPreparedReadArgs> and <LkGetPreparedPageArgs>, that copies the prepared items with a new variable part, allocating the exact memory once.
+*/
+static char* GetPreparedArgs(const LkPreparedOperation* const prepared, const char* const slotValue, uint32_t slotValueLength, const char* const entryPoint)
+{
+	uint32_t suffix = prepared->slot + prepared->slotLength;
+	uint32_t length = prepared->length - prepared->slotLength + slotValueLength;
+	char* operationArguments = LkMallocFrom(length + 1, entryPoint);
+	if(operationArguments != NULL)
+	{
+		memcpy(operationArguments, prepared->operationArguments, prepared->slot);
+		if(slotValueLength > 0)
+			memcpy(operationArguments + prepared->slot, slotValue, slotValueLength);
+		memcpy(operationArguments + prepared->slot + slotValueLength, prepared->operationArguments + suffix, prepared->length - suffix + 1);
+	}
+
 	return operationArguments;
 }
+
+/*
+	Function: LkGetPreparedReadArgs
+		Composes the 3 items of a Read operation prepared with <LkPrepareRead>, for some records.
+
+	Arguments:
+		prepared - The operation prepared with <LkPrepareRead>.
+		recordIds - It's the records codes list to read, separated by the Record Separator character (30). Use <LkComposeRecordIds> to compose this string.
+
+	Returns:
+		A string ready to be used in <LkExecuteDirectOperation> and <LkExecutePersistentOperation>, or NULL if "prepared" is not a Read operation or there is no memory.
+
+	See Also:
+		<Release Memory>
+*/
+DllEntry char* LkGetPreparedReadArgs(const LkPreparedOperation* const prepared, const char* const recordIds)
+{
+	if(prepared == NULL || prepared->operationCode != OP_CODE_READ)
+		return NULL;
+
+	return GetPreparedArgs(prepared, recordIds, recordIds ? strlen(recordIds) : 0, __func__);
+}
+
+/*
+	Function: LkGetPreparedPageArgs
+		Composes the 3 items of a Select or GetTable operation prepared with <LkPrepareSelect> or <LkPrepareGetTable>, for a page.
+
+	Arguments:
+		prepared - The operation prepared with <LkPrepareSelect> or <LkPrepareGetTable>.
+		operationCode - The operation that "prepared" must be: OP_CODE_SELECT or OP_CODE_GETTABLE. It is the code given to <LkExecuteDirectOperation> or <LkExecutePersistentOperation> with the returned string.
+		numPage - The page to obtain. It is ignored if the options of the prepared operation don't use pagination.
+
+	Returns:
+		A string ready to be used in <LkExecuteDirectOperation> and <LkExecutePersistentOperation>, or NULL if "prepared" is not an "operationCode" operation or there is no memory.
+
+	See Also:
+		<Release Memory>
+*/
+DllEntry char* LkGetPreparedPageArgs(const LkPreparedOperation* const prepared, uint8_t operationCode, uint32_t numPage)
+{
+	if(prepared == NULL || (operationCode != OP_CODE_SELECT && operationCode != OP_CODE_GETTABLE) || prepared->operationCode != operationCode)
+		return NULL;
+
+	if(prepared->slotLength == 0)
+		return GetPreparedArgs(prepared, NULL, 0, __func__);
+
+	char numPageStr[20];
+	sprintf(numPageStr, "%u", numPage);
+	return GetPreparedArgs(prepared, numPageStr, strlen(numPageStr), __func__);
+}
+
+/*
+	Function: LkFreePreparedOperation
+		Releases an operation prepared with <LkPrepareRead>, <LkPrepareSelect> or <LkPrepareGetTable>.
+
+	Arguments:
+		prepared - The prepared operation.
+
+	See Also:
+		<Release Memory>
+*/
+DllEntry void LkFreePreparedOperation(LkPreparedOperation* prepared)
+{
+	if(prepared == NULL)
+		return;
+
+	LkFree(prepared->operationArguments);
+	LkFree(prepared);
+}
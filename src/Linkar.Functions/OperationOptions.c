@@ -2,59 +2,134 @@
 	File: OperationsOptions.c
 	This module contains auxiliary functions to create the options of every operation.
 
+	The options made only of BOOL arguments are taken from static tables built at compile time, and the options with numbers are formatted in a stack buffer,
+	so every LkCreate*Options function allocates only the string it returns. <LkGetReadOptions>, <LkGetUpdateOptions>, <LkGetDefaultOptions> and
+	<LkFormatSelectOptions> don't allocate memory at all.
+
 	Note:
-	All functions comments here, return a char* value. That memory was allocated dynamically, so once those string is not needed anymore, the memory assigned to them *must be released*.
+	All the LkCreate* functions return a char* value. That memory was allocated dynamically, so once those string is not needed anymore, the memory assigned to them *must be released*.
 	See <Release Memory> for known how to do.
 */
 
 #include "OperationOptions.h"
+#include "LinkarMemory.h"
 
 #include <stdio.h>
-#include <malloc.h>
+#include <stdlib.h>
 #include <string.h>
 
-/* 
-	Function: LkCreateCommonOptions
-		Helper function to build the string with the common options to others operation options.
-	
+/*
+	Constants: Options tables
+		The options made only of BOOL arguments are built at compile time by these macros, so they don't need to be composed on every call.
+
+		COMMON_OPTIONS - The common options of the Read, Update, New and Select operations: calculated @AM (dictionaries) @AM conversion @AM formatSpec @AM originalRecords.
+		commonOptions - The 16 combinations of the common options. Use <OPTIONS_INDEX4> to get the index.
+		updateOptions - The 64 combinations of the Update options: optimisticLockControl @AM readAfter @AM common options.
+			Without its first 2 chars, every one of them is the readAfter and common options of the New operation.
+*/
+#define COMMON_OPTIONS(prefix, calculated, conversion, formatSpec, originalRecords) \
+	prefix #calculated DBMV_Mark_AM_str DBMV_Mark_AM_str #conversion DBMV_Mark_AM_str #formatSpec DBMV_Mark_AM_str #originalRecords
+#define COMMON_OPTIONS_2(prefix, calculated, conversion, formatSpec) \
+	COMMON_OPTIONS(prefix, calculated, conversion, formatSpec, 0), COMMON_OPTIONS(prefix, calculated, conversion, formatSpec, 1)
+#define COMMON_OPTIONS_4(prefix, calculated, conversion) \
+	COMMON_OPTIONS_2(prefix, calculated, conversion, 0), COMMON_OPTIONS_2(prefix, calculated, conversion, 1)
+#define COMMON_OPTIONS_8(prefix, calculated) \
+	COMMON_OPTIONS_4(prefix, calculated, 0), COMMON_OPTIONS_4(prefix, calculated, 1)
+#define COMMON_OPTIONS_16(prefix) \
+	COMMON_OPTIONS_8(prefix, 0), COMMON_OPTIONS_8(prefix, 1)
+
+static const char* const commonOptions[16] = { COMMON_OPTIONS_16("") };
+
+static const char* const updateOptions[64] =
+{
+	COMMON_OPTIONS_16("0" DBMV_Mark_AM_str "0" DBMV_Mark_AM_str),
+	COMMON_OPTIONS_16("0" DBMV_Mark_AM_str "1" DBMV_Mark_AM_str),
+	COMMON_OPTIONS_16("1" DBMV_Mark_AM_str "0" DBMV_Mark_AM_str),
+	COMMON_OPTIONS_16("1" DBMV_Mark_AM_str "1" DBMV_Mark_AM_str)
+};
+
+/*
+	Constants: OPTIONS_INDEX
+		Index of the <Options tables> for some BOOL arguments. The first argument is the most significant bit.
+		OPTIONS_INDEX4(calculated, conversion, formatSpec, originalRecords) is the index of commonOptions,
+		and OPTIONS_INDEX6(optimisticLockControl, readAfter, calculated, conversion, formatSpec, originalRecords) the index of updateOptions.
+*/
+#define OPTIONS_BIT(value, bit) ((value) ? 1 << (bit) : 0)
+#define OPTIONS_INDEX4(a, b, c, d) (OPTIONS_BIT(a, 3) | OPTIONS_BIT(b, 2) | OPTIONS_BIT(c, 1) | OPTIONS_BIT(d, 0))
+#define OPTIONS_INDEX6(a, b, c, d, e, f) (OPTIONS_BIT(a, 5) | OPTIONS_BIT(b, 4) | OPTIONS_INDEX4(c, d, e, f))
+
+// 1 @VM regPage @VM numPage, with 10 digits for every number
+#define PAGINATION_MAX_LENGTH 24
+
+// 0 @AM 0 @AM 0
+#define NEW_RECORD_ID_TYPE_NONE "0" DBMV_Mark_AM_str "0" DBMV_Mark_AM_str "0"
+// 0 @AM 0
+#define RECOVER_RECORD_ID_TYPE_NONE "0" DBMV_Mark_AM_str "0"
+
+/*
+	Function: CopyOptions
+		Helper function that returns a copy of some options, allocated in only one block of memory.
+
 	Arguments:
-		calculated - Return the resulting values from the calculated dictionaries.
-		conversion - Execute the defined conversions in the dictionaries before returning.
-		formatSpec - Execute the defined formats in the dictionaries before returning.
-		originalRecords - Return a copy of the records in MV format.
-   
-	Returns:      
-		A string with the Read Options codified inside.
-	
-	See Also:	
-		<LkCreateReadOptions>
-		
-		<LkCreateReadAfterCommonOptions>
-		
-		<LkCreateSelectOptions>
-		
+		options - The options to copy.
+		entryPoint - Name of the function that requests the memory, for <LkSetMemoryAccounting>.
+
+	Returns:
+		The copy of the options.
+
+	See Also:
 		<Release Memory>
 */
-static char* LkCreateCommonOptions(BOOL calculated, BOOL conversion, BOOL formatSpec, BOOL originalRecords)
+static char* CopyOptions(const char* const options, const char* const entryPoint)
 {
-	int len = 5 + 4 * sizeof(DBMV_Mark_AM_str);
-	char* str = malloc(len + 1);
+	size_t len = strlen(options);
+	char* str = LkMallocFrom(len + 1, entryPoint);
 	if(str)
-	{	
-		strcpy(str, (calculated? "1" : "0"));
-		strcat(str, DBMV_Mark_AM_str);
-		//strcat(str, (dictionaries? "1" : "0"));
-		strcat(str, DBMV_Mark_AM_str);
-		strcat(str, (conversion? "1" : "0"));
-		strcat(str, DBMV_Mark_AM_str);
-		strcat(str, (formatSpec? "1" : "0"));
-		strcat(str, DBMV_Mark_AM_str);
-		strcat(str, (originalRecords? "1" : "0"));
-	}				
+		memcpy(str, options, len + 1);
 
 	return str;
 }
 
+/*
+	Function: FormatPagination
+		Helper function that writes the pagination options in a buffer: 0, or 1 @VM regPage @VM numPage.
+
+	Arguments:
+		buffer - Where the options are written. It must have room for <PAGINATION_MAX_LENGTH> chars.
+		pagination - Indicates if pagination is being used or not.
+		regPage - In case of pagination indicates the number of records by page.
+		numPage - In case of pagination indicates the page to obtain.
+
+	Returns:
+		The length of the options.
+*/
+static int FormatPagination(char* buffer, BOOL pagination, uint32_t regPage, uint32_t numPage)
+{
+	if(pagination)
+		return sprintf(buffer, "1" DBMV_Mark_VM_str "%u" DBMV_Mark_VM_str "%u", regPage, numPage);
+
+	strcpy(buffer, "0");
+	return 1;
+}
+
+/*
+	Function: FormatSelectOptions
+		Helper function that writes the Select options in a buffer: pagination @AM onlyRecordId @AM common options.
+
+	Arguments:
+		buffer - Where the options are written. It must have room for <LkOptions_MAX_LENGTH> chars.
+
+	Returns:
+		The length of the options.
+*/
+static int FormatSelectOptions(char* buffer, BOOL onlyRecordId, BOOL pagination, uint32_t regPage, uint32_t numPage,
+							   BOOL calculated, BOOL conversion, BOOL formatSpec, BOOL originalRecords)
+{
+	int len = FormatPagination(buffer, pagination, regPage, numPage);
+	return len + sprintf(buffer + len, DBMV_Mark_AM_str "%d" DBMV_Mark_AM_str "%s", onlyRecordId ? 1 : 0,
+						 commonOptions[OPTIONS_INDEX4(calculated, conversion, formatSpec, originalRecords)]);
+}
+
 /* 
 	Function: LkCreateReadOptions
 		Creates a string that contains the options for LkRead functions.
@@ -83,52 +158,9 @@ static char* LkCreateCommonOptions(BOOL calculated, BOOL conversion, BOOL format
 */
 DllEntry char* LkCreateReadOptions(BOOL calculated, BOOL conversion, BOOL formatSpec, BOOL originalRecords)
 {	
-	return LkCreateCommonOptions(calculated, conversion, formatSpec, originalRecords);
+	return CopyOptions(commonOptions[OPTIONS_INDEX4(calculated, conversion, formatSpec, originalRecords)], __func__);
 }
 
-/*
-	Function: LkCreateReadAfterCommonOptions
-		Helper function to build the string with the common options to others operation options.
-
-	Arguments:
-		readAfter - Reads the record again and returns it after the update. The calculated, dictionaries, conversion, formatSpec and originalBuffer arguments will only make effect if this option is true.
-		calculated - Return the resulting values from the calculated dictionaries.
-		conversion - Execute the defined conversions in the dictionaries before returning.
-		formatSpec - Execute the defined formats in the dictionaries before returning.
-		originalRecords - Return a copy of the records in MV format.
-	
-	Returns:
-		A string with the ReadAfter and CommonOptions codified inside.
-		
-	See Also:		
-		<LkCreateCommonOptions>
-		
-		<LkCreateUpdateOptions>
-		
-		<LkCreateNewOptions>
-		
-		<Release Memory>
-*/
-static char* LkCreateReadAfterCommonOptions(BOOL readAfter, BOOL calculated, BOOL conversion, BOOL formatSpec, BOOL originalRecords)
-{
-	char* readAfterCommOpt = NULL;
-	char* commonOpt = LkCreateCommonOptions(calculated, conversion, formatSpec, originalRecords);
-	if(commonOpt)
-	{
-		int len = 1 + sizeof(DBMV_Mark_AM_str) + strlen(commonOpt);
-		readAfterCommOpt = malloc(len + 1);
-		if(readAfterCommOpt)
-		{
-			strcpy(readAfterCommOpt, (readAfter? "1" : "0"));
-			strcat(readAfterCommOpt, DBMV_Mark_AM_str);
-			strcat(readAfterCommOpt, commonOpt);
-		}
-		
-		free(commonOpt);
-	}
-
-	return readAfterCommOpt;
-}
 
 /*
 	Function: LkCreateUpdateOptions
@@ -169,23 +201,7 @@ static char* LkCreateReadAfterCommonOptions(BOOL readAfter, BOOL calculated, BOO
 */
 DllEntry char* LkCreateUpdateOptions(BOOL optimisticLockControl, BOOL readAfter, BOOL calculated, BOOL conversion, BOOL formatSpec, BOOL originalRecords)
 {
-	char* updateOpt = NULL;
-	char* readAfterCommOpt = LkCreateReadAfterCommonOptions(readAfter, calculated, conversion, formatSpec, originalRecords);
-	if(readAfterCommOpt)
-	{
-		int len = 1 + sizeof(DBMV_Mark_AM_str) + strlen(readAfterCommOpt);
-		updateOpt = malloc(len + 1);
-		if(updateOpt)
-		{
-			strcpy(updateOpt, (optimisticLockControl? "1" : "0"));
-			strcat(updateOpt, DBMV_Mark_AM_str);
-			strcat(updateOpt, readAfterCommOpt);			
-		}
-		
-		free(readAfterCommOpt);
-	}
-	
-	return updateOpt;
+	return CopyOptions(updateOptions[OPTIONS_INDEX6(optimisticLockControl, readAfter, calculated, conversion, formatSpec, originalRecords)], __func__);
 }
 
 /*
@@ -238,27 +254,18 @@ DllEntry char* LkCreateUpdateOptions(BOOL optimisticLockControl, BOOL readAfter,
 */
 DllEntry char* LkCreateNewOptions(const char* const newItemIdType, BOOL readAfter, BOOL calculated, BOOL conversion, BOOL formatSpec, BOOL originalRecords)
 {
-	char* newOpt = NULL;
-	char* readAfterCommOpt = LkCreateReadAfterCommonOptions(readAfter, calculated, conversion, formatSpec, originalRecords);
-	if(readAfterCommOpt)
+	// The update options without the optimisticLockControl are the readAfter and the common options
+	const char* readAfterCommOpt = updateOptions[OPTIONS_INDEX6(FALSE, readAfter, calculated, conversion, formatSpec, originalRecords)] + 2;
+	const char* newItemIdType2 = newItemIdType ? newItemIdType : NEW_RECORD_ID_TYPE_NONE;
+	
+	// newItemIdType @AM readAfterCommOpt
+	int len = strlen(newItemIdType2) + strlen(DBMV_Mark_AM_str) + strlen(readAfterCommOpt);
+	char* newOpt = LkMallocFrom(len + 1, __func__);
+	if(newOpt)
 	{
-		char* newItemIdType2;
-		if(newItemIdType == NULL)
-			newItemIdType2 = LkCreateNewRecordIdTypeNone();
-		else
-			newItemIdType2 = (char*)newItemIdType;
-		
-		// newItemIdType @AM readAfterCommOpt
-		int len = strlen(newItemIdType2) + strlen(DBMV_Mark_AM_str) + strlen(readAfterCommOpt);
-		newOpt = malloc(len + 1);
-		if(newOpt)
-		{
-			strcpy(newOpt, newItemIdType2);
-			strcat(newOpt, DBMV_Mark_AM_str);
-			strcat(newOpt, readAfterCommOpt);
-		}
-		if(newItemIdType != newItemIdType2)
-			free(newItemIdType2);
+		strcpy(newOpt, newItemIdType2);
+		strcat(newOpt, DBMV_Mark_AM_str);
+		strcat(newOpt, readAfterCommOpt);
 	}
 	
 	return newOpt;
@@ -284,19 +291,7 @@ DllEntry char* LkCreateNewOptions(const char* const newItemIdType, BOOL readAfte
 */
 DllEntry char* LkCreateNewRecordIdTypeNone()
 {	
-	// 0 @AM 0 @AM 0
-	int lenItemIdType = 3 + 2*strlen(DBMV_Mark_AM_str);
-	char* itemIdType = malloc(lenItemIdType + 1);
-	if(itemIdType)
-	{
-		strcpy(itemIdType, "0");
-		strcat(itemIdType, DBMV_Mark_AM_str);
-		strcat(itemIdType, "0");
-		strcat(itemIdType, DBMV_Mark_AM_str);
-		strcat(itemIdType, "0");
-	}
-	
-	return itemIdType;
+	return CopyOptions(NEW_RECORD_ID_TYPE_NONE, __func__);
 }
 
 /*
@@ -327,7 +322,7 @@ DllEntry char* LkCreateNewRecordIdTypeLinkar(const char* const prefix, const cha
 {	
 	// 1 @VM prefix @VM separator @VM formatSpec @AM 0 @AM 0
 	int lenItemIdType = 3 + 2*strlen(DBMV_Mark_AM_str) + 3*strlen(DBMV_Mark_VM_str) + strlen(prefix) + strlen(separator) + strlen(formatSpec);
-	char* itemIdType = malloc(lenItemIdType + 1);
+	char* itemIdType = LkMallocFrom(lenItemIdType + 1, __func__);
 	if(itemIdType)
 	{
 		strcpy(itemIdType, "1");
@@ -361,18 +356,7 @@ DllEntry char* LkCreateNewRecordIdTypeLinkar(const char* const prefix, const cha
 DllEntry char* LkCreateNewRecordIdTypeCustom()
 {	
 	// 0 @AM 1 @AM 0
-	int lenItemIdType = 3 + 2*strlen(DBMV_Mark_AM_str);
-	char* itemIdType = malloc(lenItemIdType + 1);
-	if(itemIdType)
-	{
-		strcpy(itemIdType, "0");
-		strcat(itemIdType, DBMV_Mark_AM_str);
-		strcat(itemIdType, "1");
-		strcat(itemIdType, DBMV_Mark_AM_str);
-		strcat(itemIdType, "0");
-	}
-	
-	return itemIdType;
+	return CopyOptions("0" DBMV_Mark_AM_str "1" DBMV_Mark_AM_str "0", __func__);
 }
 
 /*
@@ -405,7 +389,7 @@ DllEntry char* LkCreateNewRecordIdTypeRandom(BOOL numeric, uint32_t length)
 	char lengthStr[50];
 	sprintf(lengthStr, "%d", length);
 	int lenItemIdType = 3 + 2*strlen(DBMV_Mark_AM_str) + 2*strlen(DBMV_Mark_VM_str) + 1 + strlen(lengthStr);
-	char* itemIdType = malloc(lenItemIdType + 1);
+	char* itemIdType = LkMallocFrom(lenItemIdType + 1, __func__);
 	if(itemIdType)
 	{
 		strcpy(itemIdType, "0");
@@ -464,22 +448,16 @@ DllEntry char* LkCreateNewRecordIdTypeRandom(BOOL numeric, uint32_t length)
 */
 DllEntry char* LkCreateDeleteOptions(BOOL optimisticLockControl, const char* const recoverIdType)
 {
-	char* recoverIdType2;
-	if(recoverIdType == NULL)
-		recoverIdType2 = LkCreateRecoverRecordIdTypeNone();
-	else
-		recoverIdType2 = (char*)recoverIdType;
+	const char* recoverIdType2 = recoverIdType ? recoverIdType : RECOVER_RECORD_ID_TYPE_NONE;
 	
 	int len = 1 + strlen(DBMV_Mark_AM_str) + strlen(recoverIdType2);
-	char* deleteOpt = malloc(len + 1);
+	char* deleteOpt = LkMallocFrom(len + 1, __func__);
 	if(deleteOpt)
 	{
 		strcpy(deleteOpt, (optimisticLockControl? "1" : "0"));
 		strcat(deleteOpt, DBMV_Mark_AM_str);
 		strcat(deleteOpt, recoverIdType2);
 	}
-	if(recoverIdType != recoverIdType2)
-		free(recoverIdType2);
 	
 	return deleteOpt;
 }
@@ -499,16 +477,7 @@ DllEntry char* LkCreateDeleteOptions(BOOL optimisticLockControl, const char* con
 */
 DllEntry char* LkCreateRecoverRecordIdTypeNone()
 {
-	// 0 @AM 0
-	int lenRecoverIdType = 2 + strlen(DBMV_Mark_AM_str);
-	char* recoverIdType = malloc(lenRecoverIdType + 1);
-	if(recoverIdType)
-	{
-		strcpy(recoverIdType, "0");
-		strcat(recoverIdType, DBMV_Mark_AM_str);
-		strcat(recoverIdType, "0");
-	}	
-	return recoverIdType;
+	return CopyOptions(RECOVER_RECORD_ID_TYPE_NONE, __func__);
 }
 
 /*
@@ -539,7 +508,7 @@ DllEntry char* LkCreateRecoverRecordIdTypeLinkar(const char* const prefix, const
 {
 	// 1 @VM prefix @VM separator @AM 0
 	int lenRecoverIdType = 2 + strlen(DBMV_Mark_AM_str) + 2*strlen(DBMV_Mark_VM_str) + strlen(prefix) + strlen(separator);
-	char* recoverIdType = malloc(lenRecoverIdType + 1);
+	char* recoverIdType = LkMallocFrom(lenRecoverIdType + 1, __func__);
 	if(recoverIdType)
 	{
 		strcpy(recoverIdType, "1");
@@ -569,15 +538,7 @@ DllEntry char* LkCreateRecoverRecordIdTypeLinkar(const char* const prefix, const
 DllEntry char* LkCreateRecoverRecordIdTypeCustom()
 {	
 	// 0 @AM 1
-	int lenRecoverIdType = 2 + strlen(DBMV_Mark_AM_str);
-	char* recoverIdType = malloc(lenRecoverIdType + 1);
-	if(recoverIdType)
-	{
-		strcpy(recoverIdType, "0");
-		strcat(recoverIdType, DBMV_Mark_AM_str);
-		strcat(recoverIdType, "1");
-	}	
-	return recoverIdType;
+	return CopyOptions("0" DBMV_Mark_AM_str "1", __func__);
 }
 
 /*
@@ -617,39 +578,10 @@ DllEntry char* LkCreateRecoverRecordIdTypeCustom()
 DllEntry char* LkCreateSelectOptions(BOOL onlyRecordId, BOOL pagination, uint32_t regPage, uint32_t numPage, 
                                      BOOL calculated, BOOL conversion, BOOL formatSpec, BOOL originalRecords)
 {
-	char* selectOpt = NULL;
+	char selectOpt[LkOptions_MAX_LENGTH];
+	FormatSelectOptions(selectOpt, onlyRecordId, pagination, regPage, numPage, calculated, conversion, formatSpec, originalRecords);
 	
-	char paginationOpt[100];
-	strcpy(paginationOpt, (pagination? "1" : "0"));
-	if(pagination)
-	{
-		strcat(paginationOpt, DBMV_Mark_VM_str);
-
-		char aux[20];
-		sprintf(aux, "%d", regPage);
-		strcat(paginationOpt, aux);
-		
-		strcat(paginationOpt, DBMV_Mark_VM_str);
-		sprintf(aux, "%d", numPage);
-		strcat(paginationOpt, aux);
-	}
-	strcat(paginationOpt, DBMV_Mark_AM_str);
-	strcat(paginationOpt, (onlyRecordId? "1" : "0"));
-	
-	char* commonOpt = LkCreateCommonOptions(calculated, conversion, formatSpec, originalRecords);
-	if(commonOpt)
-	{
-		int len = strlen(paginationOpt) + strlen(DBMV_Mark_AM_str) + strlen(commonOpt);
-		selectOpt = malloc(len + 1);
-		if(selectOpt)
-		{
-			strcpy(selectOpt, paginationOpt);
-			strcat(selectOpt, DBMV_Mark_AM_str);
-			strcat(selectOpt, commonOpt);
-		}
-	}
-	
-	return selectOpt;
+	return CopyOptions(selectOpt, __func__);
 }
 
 
@@ -675,42 +607,16 @@ static const char* const GetStrRowHeadersType(RowHeadersTYPE rowHeadersType)
 		return "1";
 }
 
-static char* LkCreateLkSchemasOptions(SchemaTYPE schemaType, RowHeadersTYPE rowHeaders, BOOL sqlMode, BOOL rowProperties, BOOL onlyVisibles, BOOL pagination, uint32_t regPage, uint32_t numPage)
+static char* LkCreateLkSchemasOptions(SchemaTYPE schemaType, RowHeadersTYPE rowHeaders, BOOL sqlMode, BOOL rowProperties, BOOL onlyVisibles, BOOL pagination, uint32_t regPage, uint32_t numPage, const char* const entryPoint)
 {		
-	char paginationOpt[100];
-	strcpy(paginationOpt, (pagination? "1" : "0"));
-	if(pagination)
-	{
-		strcat(paginationOpt, DBMV_Mark_VM_str);
-
-		char aux[20];
-		sprintf(aux, "%d", regPage);
-		strcat(paginationOpt, aux);
-		
-		strcat(paginationOpt, DBMV_Mark_VM_str);
-		sprintf(aux, "%d", numPage);
-		strcat(paginationOpt, aux);
-	}
+	char paginationOpt[PAGINATION_MAX_LENGTH];
+	FormatPagination(paginationOpt, pagination, regPage, numPage);
 	
-	int len = 5 + 5 * strlen(DBMV_Mark_AM_str) + strlen(paginationOpt);
+	char lkSchemasOpt[LkOptions_MAX_LENGTH];
+	sprintf(lkSchemasOpt, "%s" DBMV_Mark_AM_str "%d" DBMV_Mark_AM_str "%d" DBMV_Mark_AM_str "%d" DBMV_Mark_AM_str "%s" DBMV_Mark_AM_str "%s",
+			GetStrSchemaType(schemaType), sqlMode ? 1 : 0, rowProperties ? 1 : 0, onlyVisibles ? 1 : 0, GetStrRowHeadersType(rowHeaders), paginationOpt);
 	
-	char* lkSchemasOpt = malloc(len + 1);
-	if(lkSchemasOpt)
-	{	
-		strcpy(lkSchemasOpt, GetStrSchemaType(schemaType));
-		strcat(lkSchemasOpt, DBMV_Mark_AM_str);
-		strcat(lkSchemasOpt, (sqlMode? "1" : "0"));
-		strcat(lkSchemasOpt, DBMV_Mark_AM_str);
-		strcat(lkSchemasOpt, (rowProperties? "1" : "0"));
-		strcat(lkSchemasOpt, DBMV_Mark_AM_str);
-		strcat(lkSchemasOpt, (onlyVisibles? "1" : "0"));
-		strcat(lkSchemasOpt, DBMV_Mark_AM_str);
-		strcat(lkSchemasOpt, GetStrRowHeadersType(rowHeaders));
-		strcat(lkSchemasOpt, DBMV_Mark_AM_str);		
-		strcat(lkSchemasOpt, paginationOpt);
-	}
-		
-	return lkSchemasOpt;
+	return CopyOptions(lkSchemasOpt, entryPoint);
 }
 
 /*
@@ -744,7 +650,7 @@ static char* LkCreateLkSchemasOptions(SchemaTYPE schemaType, RowHeadersTYPE rowH
 */
 DllEntry char* LkCreateSchOptionsTypeLKSCHEMAS(RowHeadersTYPE rowHeaders, BOOL rowProperties, BOOL onlyVisibles, BOOL pagination, uint32_t regPage, uint32_t numPage)
 {
-	return LkCreateLkSchemasOptions(SchemaTYPE_LKSCHEMAS, rowHeaders, FALSE, rowProperties, onlyVisibles, pagination, regPage, numPage);
+	return LkCreateLkSchemasOptions(SchemaTYPE_LKSCHEMAS, rowHeaders, FALSE, rowProperties, onlyVisibles, pagination, regPage, numPage, __func__);
 }
 
 /*
@@ -774,7 +680,7 @@ DllEntry char* LkCreateSchOptionsTypeLKSCHEMAS(RowHeadersTYPE rowHeaders, BOOL r
 */
 DllEntry char* LkCreateSchOptionsTypeSQLMODE(BOOL onlyVisibles, BOOL pagination, uint32_t regPage, uint32_t numPage)
 {
-	return LkCreateLkSchemasOptions(SchemaTYPE_LKSCHEMAS, RowHeadersTYPE_NONE, TRUE, TRUE, onlyVisibles, pagination, regPage, numPage);
+	return LkCreateLkSchemasOptions(SchemaTYPE_LKSCHEMAS, RowHeadersTYPE_NONE, TRUE, TRUE, onlyVisibles, pagination, regPage, numPage, __func__);
 }
 
 /*
@@ -804,46 +710,19 @@ DllEntry char* LkCreateSchOptionsTypeSQLMODE(BOOL onlyVisibles, BOOL pagination,
 */
 DllEntry char* LkCreateSchOptionsTypeDICTIONARIES(RowHeadersTYPE rowHeaders, BOOL pagination, uint32_t regPage, uint32_t numPage)
 {
-	return LkCreateLkSchemasOptions(SchemaTYPE_DICTIONARIES, rowHeaders, FALSE, TRUE, TRUE, pagination, regPage, numPage);
+	return LkCreateLkSchemasOptions(SchemaTYPE_DICTIONARIES, rowHeaders, FALSE, TRUE, TRUE, pagination, regPage, numPage, __func__);
 }
 
-static char* LkCreateLkPropertiesOptions(SchemaTYPE schemaType, RowHeadersTYPE rowHeaders, BOOL sqlMode, BOOL rowProperties, BOOL onlyVisibles, BOOL usePropertyNames, BOOL pagination, uint32_t regPage, uint32_t numPage)
+static char* LkCreateLkPropertiesOptions(SchemaTYPE schemaType, RowHeadersTYPE rowHeaders, BOOL sqlMode, BOOL rowProperties, BOOL onlyVisibles, BOOL usePropertyNames, BOOL pagination, uint32_t regPage, uint32_t numPage, const char* const entryPoint)
 {
-	char paginationOpt[100];
-	strcpy(paginationOpt, (pagination? "1" : "0"));
-	if(pagination)
-	{
-		strcat(paginationOpt, DBMV_Mark_VM_str);
-
-		char aux[20];
-		sprintf(aux, "%d", regPage);
-		strcat(paginationOpt, aux);
-		
-		strcat(paginationOpt, DBMV_Mark_VM_str);
-		sprintf(aux, "%d", numPage);
-		strcat(paginationOpt, aux);
-	}
+	char paginationOpt[PAGINATION_MAX_LENGTH];
+	FormatPagination(paginationOpt, pagination, regPage, numPage);
 	
-	int len = 6 + 6 * strlen(DBMV_Mark_AM_str) + strlen(paginationOpt);
-	char* lkPropertiesOpt = malloc(len + 1);
-	if(lkPropertiesOpt)
-	{	
-		strcpy(lkPropertiesOpt, GetStrSchemaType(schemaType));
-		strcat(lkPropertiesOpt, DBMV_Mark_AM_str);
-		strcat(lkPropertiesOpt, (sqlMode? "1" : "0"));
-		strcat(lkPropertiesOpt, DBMV_Mark_AM_str);
-		strcat(lkPropertiesOpt, (usePropertyNames? "1" : "0"));
-		strcat(lkPropertiesOpt, DBMV_Mark_AM_str);
-		strcat(lkPropertiesOpt, (rowProperties? "1" : "0"));
-		strcat(lkPropertiesOpt, DBMV_Mark_AM_str);
-		strcat(lkPropertiesOpt, (onlyVisibles? "1" : "0"));
-		strcat(lkPropertiesOpt, DBMV_Mark_AM_str);
-		strcat(lkPropertiesOpt, GetStrRowHeadersType(rowHeaders));
-		strcat(lkPropertiesOpt, DBMV_Mark_AM_str);
-		strcat(lkPropertiesOpt, paginationOpt);
-	}
+	char lkPropertiesOpt[LkOptions_MAX_LENGTH];
+	sprintf(lkPropertiesOpt, "%s" DBMV_Mark_AM_str "%d" DBMV_Mark_AM_str "%d" DBMV_Mark_AM_str "%d" DBMV_Mark_AM_str "%d" DBMV_Mark_AM_str "%s" DBMV_Mark_AM_str "%s",
+			GetStrSchemaType(schemaType), sqlMode ? 1 : 0, usePropertyNames ? 1 : 0, rowProperties ? 1 : 0, onlyVisibles ? 1 : 0, GetStrRowHeadersType(rowHeaders), paginationOpt);
 	
-	return lkPropertiesOpt;
+	return CopyOptions(lkPropertiesOpt, entryPoint);
 }
 
 /*
@@ -879,7 +758,7 @@ static char* LkCreateLkPropertiesOptions(SchemaTYPE schemaType, RowHeadersTYPE r
 */
 DllEntry char* LkCreatePropOptionsTypeLKSCHEMAS(RowHeadersTYPE rowHeaders, BOOL rowProperties, BOOL onlyVisibles, BOOL usePropertyNames, BOOL pagination, uint32_t regPage, uint32_t numPage)
 {
-	return LkCreateLkPropertiesOptions(SchemaTYPE_LKSCHEMAS, rowHeaders, FALSE, rowProperties, onlyVisibles, usePropertyNames, pagination, regPage, numPage);
+	return LkCreateLkPropertiesOptions(SchemaTYPE_LKSCHEMAS, rowHeaders, FALSE, rowProperties, onlyVisibles, usePropertyNames, pagination, regPage, numPage, __func__);
 }
 
 /*
@@ -909,7 +788,7 @@ DllEntry char* LkCreatePropOptionsTypeLKSCHEMAS(RowHeadersTYPE rowHeaders, BOOL
 */
 DllEntry char* LkCreatePropOptionsTypeSQLMODE(BOOL onlyVisibles, BOOL pagination, uint32_t regPage, uint32_t numPage)
 {
-	return LkCreateLkPropertiesOptions(SchemaTYPE_LKSCHEMAS, RowHeadersTYPE_NONE, TRUE, TRUE, onlyVisibles, TRUE, pagination, regPage, numPage);
+	return LkCreateLkPropertiesOptions(SchemaTYPE_LKSCHEMAS, RowHeadersTYPE_NONE, TRUE, TRUE, onlyVisibles, TRUE, pagination, regPage, numPage, __func__);
 }
 
 /*
@@ -939,54 +818,21 @@ DllEntry char* LkCreatePropOptionsTypeSQLMODE(BOOL onlyVisibles, BOOL pagination
 */
 DllEntry char* LkCreatePropOptionsTypeDICTIONARIES(RowHeadersTYPE rowHeaders, BOOL pagination, uint32_t regPage, uint32_t numPage)
 {
-	return LkCreateLkPropertiesOptions(SchemaTYPE_DICTIONARIES, rowHeaders, FALSE, FALSE, FALSE, FALSE, pagination, regPage, numPage);
+	return LkCreateLkPropertiesOptions(SchemaTYPE_DICTIONARIES, rowHeaders, FALSE, FALSE, FALSE, FALSE, pagination, regPage, numPage, __func__);
 }
 
-static char* LkCreateLkGetTableOptions(SchemaTYPE schemaType, RowHeadersTYPE rowHeaders, BOOL sqlMode, BOOL rowProperties, BOOL onlyVisibles, BOOL usePropertyNames, BOOL repeatValues, BOOL applyConversion, BOOL applyFormat, BOOL calculated, BOOL pagination, uint32_t regPage, uint32_t numPage)
+static char* LkCreateLkGetTableOptions(SchemaTYPE schemaType, RowHeadersTYPE rowHeaders, BOOL sqlMode, BOOL rowProperties, BOOL onlyVisibles, BOOL usePropertyNames, BOOL repeatValues, BOOL applyConversion, BOOL applyFormat, BOOL calculated, BOOL pagination, uint32_t regPage, uint32_t numPage, const char* const entryPoint)
 {
-	char paginationOpt[100];
-	strcpy(paginationOpt, (pagination? "1" : "0"));
-	if(pagination)
-	{
-		strcat(paginationOpt, DBMV_Mark_VM_str);
-
-		char aux[20];
-		sprintf(aux, "%d", regPage);
-		strcat(paginationOpt, aux);
-		
-		strcat(paginationOpt, DBMV_Mark_VM_str);
-		sprintf(aux, "%d", numPage);
-		strcat(paginationOpt, aux);
-	}
+	char paginationOpt[PAGINATION_MAX_LENGTH];
+	FormatPagination(paginationOpt, pagination, regPage, numPage);
 	
-	int len = 10 + 10 * strlen(DBMV_Mark_AM_str) + strlen(paginationOpt);
-	char* lkGetTableOpt = malloc(len + 1);
-	if(lkGetTableOpt)
-	{	
-		strcpy(lkGetTableOpt, GetStrSchemaType(schemaType));
-		strcat(lkGetTableOpt, DBMV_Mark_AM_str);
-		strcat(lkGetTableOpt, (sqlMode? "1" : "0"));
-		strcat(lkGetTableOpt, DBMV_Mark_AM_str);
-		strcat(lkGetTableOpt, (usePropertyNames? "1" : "0"));
-		strcat(lkGetTableOpt, DBMV_Mark_AM_str);
-		strcat(lkGetTableOpt, (rowProperties? "1" : "0"));
-		strcat(lkGetTableOpt, DBMV_Mark_AM_str);
-		strcat(lkGetTableOpt, (onlyVisibles? "1" : "0"));
-		strcat(lkGetTableOpt, DBMV_Mark_AM_str);
-		strcat(lkGetTableOpt, GetStrRowHeadersType(rowHeaders));
-		strcat(lkGetTableOpt, DBMV_Mark_AM_str);
-		strcat(lkGetTableOpt, (repeatValues? "1" : "0"));
-		strcat(lkGetTableOpt, DBMV_Mark_AM_str);
-		strcat(lkGetTableOpt, (applyConversion? "1" : "0"));
-		strcat(lkGetTableOpt, DBMV_Mark_AM_str);
-		strcat(lkGetTableOpt, (applyFormat? "1" : "0"));
-		strcat(lkGetTableOpt, DBMV_Mark_AM_str);
-		strcat(lkGetTableOpt, (calculated? "1" : "0"));
-		strcat(lkGetTableOpt, DBMV_Mark_AM_str);
-		strcat(lkGetTableOpt, paginationOpt);
-	}
+	char lkGetTableOpt[LkOptions_MAX_LENGTH];
+	sprintf(lkGetTableOpt, "%s" DBMV_Mark_AM_str "%d" DBMV_Mark_AM_str "%d" DBMV_Mark_AM_str "%d" DBMV_Mark_AM_str "%d" DBMV_Mark_AM_str "%s"
+			DBMV_Mark_AM_str "%d" DBMV_Mark_AM_str "%d" DBMV_Mark_AM_str "%d" DBMV_Mark_AM_str "%d" DBMV_Mark_AM_str "%s",
+			GetStrSchemaType(schemaType), sqlMode ? 1 : 0, usePropertyNames ? 1 : 0, rowProperties ? 1 : 0, onlyVisibles ? 1 : 0, GetStrRowHeadersType(rowHeaders),
+			repeatValues ? 1 : 0, applyConversion ? 1 : 0, applyFormat ? 1 : 0, calculated ? 1 : 0, paginationOpt);
 	
-	return lkGetTableOpt;
+	return CopyOptions(lkGetTableOpt, entryPoint);
 }
 
 /*
@@ -1033,7 +879,7 @@ DllEntry char* LkCreateTableOptionsTypeLKSCHEMAS(RowHeadersTYPE rowHeaders, BOOL
  BOOL repeatValues, BOOL applyConversion, BOOL applyFormat, BOOL calculated, 
  BOOL pagination, uint32_t regPage, uint32_t numPage)
  {
-	 return LkCreateLkGetTableOptions(SchemaTYPE_LKSCHEMAS, rowHeaders, FALSE, rowProperties, onlyVisibles, usePropertyNames, repeatValues, applyConversion, applyFormat, calculated, pagination, regPage, numPage);
+	 return LkCreateLkGetTableOptions(SchemaTYPE_LKSCHEMAS, rowHeaders, FALSE, rowProperties, onlyVisibles, usePropertyNames, repeatValues, applyConversion, applyFormat, calculated, pagination, regPage, numPage, __func__);
  }
 									 
 /*
@@ -1071,7 +917,7 @@ DllEntry char* LkCreateTableOptionsTypeSQLMODE(BOOL onlyVisibles,
  BOOL applyConversion, BOOL applyFormat, BOOL calculated, 
  BOOL pagination, uint32_t regPage, uint32_t numPage)
  {
-	 return LkCreateLkGetTableOptions(SchemaTYPE_LKSCHEMAS, RowHeadersTYPE_NONE, TRUE, TRUE, onlyVisibles, TRUE, TRUE, applyConversion, applyFormat, calculated, pagination, regPage, numPage);
+	 return LkCreateLkGetTableOptions(SchemaTYPE_LKSCHEMAS, RowHeadersTYPE_NONE, TRUE, TRUE, onlyVisibles, TRUE, TRUE, applyConversion, applyFormat, calculated, pagination, regPage, numPage, __func__);
  }
 									 
 /*
@@ -1111,7 +957,7 @@ DllEntry char* LkCreateTableOptionsTypeDICTIONARIES(RowHeadersTYPE rowHeaders,
  BOOL repeatValues, BOOL applyConversion, BOOL applyFormat, BOOL calculated, 
  BOOL pagination, uint32_t regPage, uint32_t numPage)
  {
-	 return LkCreateLkGetTableOptions(SchemaTYPE_DICTIONARIES, rowHeaders, FALSE, FALSE, FALSE, FALSE, repeatValues, applyConversion, applyFormat, calculated, pagination, regPage, numPage);
+	 return LkCreateLkGetTableOptions(SchemaTYPE_DICTIONARIES, rowHeaders, FALSE, FALSE, FALSE, FALSE, repeatValues, applyConversion, applyFormat, calculated, pagination, regPage, numPage, __func__);
  }
 									 
 /*
@@ -1145,5 +991,131 @@ DllEntry char* LkCreateTableOptionsTypeNONE(RowHeadersTYPE rowHeaders,
  BOOL repeatValues,  
  BOOL pagination, uint32_t regPage, uint32_t numPage)
  {
-	 return LkCreateLkGetTableOptions(SchemaTYPE_NONE, rowHeaders, FALSE, FALSE, FALSE, FALSE, repeatValues, FALSE, FALSE, FALSE, pagination, regPage, numPage);
+	 return LkCreateLkGetTableOptions(SchemaTYPE_NONE, rowHeaders, FALSE, FALSE, FALSE, FALSE, repeatValues, FALSE, FALSE, FALSE, pagination, regPage, numPage, __func__);
  }
+
+/*
+	Function: LkGetReadOptions
+		Gets the options for LkRead functions, like <LkCreateReadOptions>, but without allocating memory.
+
+	Arguments:
+		calculated - Return the resulting values from the calculated dictionaries.
+		conversion - Execute the defined conversions in the dictionaries before returning.
+		formatSpec - Execute the defined formats in the dictionaries before returning.
+		originalRecords - Return a copy of the records in MV format.
+
+	Returns:
+		A static string with the Read Options codified inside. It must not be released.
+
+	Example:
+		--- Code
+		char* result = LkRead(&error, connectionInfo, "LK.CUSTOMERS", recordIds, "", LkGetReadOptions(TRUE, FALSE, FALSE, FALSE), "", 0);
+		---
+*/
+DllEntry const char* LkGetReadOptions(BOOL calculated, BOOL conversion, BOOL formatSpec, BOOL originalRecords)
+{
+	return commonOptions[OPTIONS_INDEX4(calculated, conversion, formatSpec, originalRecords)];
+}
+
+/*
+	Function: LkGetUpdateOptions
+		Gets the options for LkUpdate functions, like <LkCreateUpdateOptions>, but without allocating memory.
+
+	Arguments:
+		optimisticLockControl - Checks out if the file has not been modified by other user.
+		readAfter - Reads the record again and returns it after the update.
+		calculated - Return the resulting values from the calculated dictionaries.
+		conversion - Execute the defined conversions in the dictionaries before returning.
+		formatSpec - Execute the defined formats in the dictionaries before returning.
+		originalRecords - Return a copy of the records in MV format.
+
+	Returns:
+		A static string with the Update Options codified inside. It must not be released.
+*/
+DllEntry const char* LkGetUpdateOptions(BOOL optimisticLockControl, BOOL readAfter, BOOL calculated, BOOL conversion, BOOL formatSpec, BOOL originalRecords)
+{
+	return updateOptions[OPTIONS_INDEX6(optimisticLockControl, readAfter, calculated, conversion, formatSpec, originalRecords)];
+}
+
+/*
+	Function: LkFormatSelectOptions
+		Writes the options for Select functions, like <LkCreateSelectOptions>, in a buffer provided by the caller.
+		If the buffer is too short, only the first "capacity" - 1 chars are copied, and the function returns the total length.
+
+	Arguments:
+		buffer - Where the options are written. It is always NUL terminated, unless "capacity" is 0. A buffer of <LkOptions_MAX_LENGTH> chars is always enough.
+		capacity - Size of "buffer", including the NUL terminator.
+		onlyRecordId - Returns just the selected records codes.
+		pagination - Indicates if pagination is being used or not.
+		regPage - In case of pagination indicates the number of records by page. It must be bigger than 0.
+		numPage - In case of pagination indicates the page to obtain. It must be bigger than 0.
+		calculated - Return the resulting values from the calculated dictionaries.
+		conversion - Execute the defined conversions in the dictionaries before returning.
+		formatSpec - Execute the defined formats in the dictionaries before returning.
+		originalRecords - Return a copy of the records in MV format.
+
+	Returns:
+		The length of the options, without the NUL terminator.
+
+	Example:
+		--- Code
+		char selectOptions[LkOptions_MAX_LENGTH];
+		LkFormatSelectOptions(selectOptions, sizeof(selectOptions), FALSE, TRUE, 10, numPage, FALSE, FALSE, FALSE, FALSE);
+		---
+*/
+DllEntry uint32_t LkFormatSelectOptions(char* buffer, uint32_t capacity, BOOL onlyRecordId, BOOL pagination, uint32_t regPage, uint32_t numPage,
+										BOOL calculated, BOOL conversion, BOOL formatSpec, BOOL originalRecords)
+{
+	char selectOpt[LkOptions_MAX_LENGTH];
+	uint32_t len = FormatSelectOptions(selectOpt, onlyRecordId, pagination, regPage, numPage, calculated, conversion, formatSpec, originalRecords);
+
+	if(capacity > 0)
+	{
+		uint32_t size = len < capacity ? len : capacity - 1;
+		memcpy(buffer, selectOpt, size);
+		buffer[size] = 0;
+	}
+
+	return len;
+}
+
+/*
+	Function: LkGetDefaultOptions
+		Gets the options used by the LkGet*Args functions when the options argument is NULL or empty, without allocating memory.
+		They are the same options of the LkCreate*Options functions with all the BOOL arguments FALSE, no pagination, and MAINLABEL row headers.
+
+	Arguments:
+		operationCode - The code of the operation, for example <OP_CODE_READ>.
+
+	Returns:
+		A static string with the default options of the operation, or NULL if the operation has no options. It must not be released.
+*/
+DllEntry const char* LkGetDefaultOptions(uint8_t operationCode)
+{
+	switch(operationCode)
+	{
+		case OP_CODE_READ:
+			return commonOptions[0];
+		case OP_CODE_UPDATE:
+		case OP_CODE_UPDATEPARTIAL:
+			return updateOptions[0];
+		case OP_CODE_NEW:
+			return NEW_RECORD_ID_TYPE_NONE DBMV_Mark_AM_str "0" DBMV_Mark_AM_str COMMON_OPTIONS("", 0, 0, 0, 0);
+		case OP_CODE_DELETE:
+			return "0" DBMV_Mark_AM_str RECOVER_RECORD_ID_TYPE_NONE;
+		case OP_CODE_SELECT:
+			return "0" DBMV_Mark_AM_str "0" DBMV_Mark_AM_str COMMON_OPTIONS("", 0, 0, 0, 0);
+		// schemaType @AM sqlMode @AM rowProperties @AM onlyVisibles @AM rowHeaders @AM pagination
+		case OP_CODE_LKSCHEMAS:
+			return "1" DBMV_Mark_AM_str "0" DBMV_Mark_AM_str "0" DBMV_Mark_AM_str "0" DBMV_Mark_AM_str "1" DBMV_Mark_AM_str "0";
+		// schemaType @AM sqlMode @AM usePropertyNames @AM rowProperties @AM onlyVisibles @AM rowHeaders @AM pagination
+		case OP_CODE_LKPROPERTIES:
+			return "1" DBMV_Mark_AM_str "0" DBMV_Mark_AM_str "0" DBMV_Mark_AM_str "0" DBMV_Mark_AM_str "0" DBMV_Mark_AM_str "1" DBMV_Mark_AM_str "0";
+		// The same, with repeatValues @AM applyConversion @AM applyFormat @AM calculated before the pagination
+		case OP_CODE_GETTABLE:
+			return "1" DBMV_Mark_AM_str "0" DBMV_Mark_AM_str "0" DBMV_Mark_AM_str "0" DBMV_Mark_AM_str "0" DBMV_Mark_AM_str "1" DBMV_Mark_AM_str
+				   "0" DBMV_Mark_AM_str "0" DBMV_Mark_AM_str "0" DBMV_Mark_AM_str "0" DBMV_Mark_AM_str "0";
+		default:
+			return NULL;
+	}
+}
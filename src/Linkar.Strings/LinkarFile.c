@@ -0,0 +1,363 @@
+/*
+	File: LinkarFile.c
+	This module contains the functions to work with <LkStrings> stored in files.
+
+	<LkMapFile> maps a file in memory, so a saved <LkString> can be parsed with <LkParseResultFromFile> without reading it into a malloc'd buffer.
+	The pages of the file are loaded by the operating system when they are read, and they can be discarded when memory is needed.
+
+	<LkBufferWriter> writes the buffer of the New, Update or Delete Operations into a file descriptor while it is composed,
+	so only a small memory buffer is used whatever the size of the data is.
+*/
+
+#include "LinkarFile.h"
+#include "LinkarMemory.h"
+#include <string.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+	#include <windows.h>
+	#include <io.h>
+
+	#define LkWrite(fd, data, size) _write(fd, data, size)
+#else
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+	#include <errno.h>
+
+	#define LkWrite(fd, data, size) write(fd, data, size)
+#endif
+
+struct LkMappedFile
+{
+	void* data;
+	uint32_t length;
+#ifdef _WIN32
+	HANDLE file;
+	HANDLE mapping;
+#endif
+};
+
+/*
+	Function: LkMapFile
+		Maps a file in memory for reading. The content of the file is not copied.
+
+	Arguments:
+		path - Path of the file.
+		content - Output argument with the content of the file. It is not NUL terminated, and it is valid until <LkUnmapFile> is called.
+
+	Returns:
+		The mapped file, or NULL if the file can't be opened, it is bigger than 4 GB or there is no memory. It must be released with <LkUnmapFile>.
+
+	Example:
+		--- Code
+		LkStrView content;
+		LkMappedFile* mappedFile = LkMapFile("select.lk", &content);
+		if(mappedFile != NULL)
+		{
+			uint32_t count;
+			LkSpan* lines = LkStrSplitSpans(content.str, content.length, '\n', &count);
+			...
+			LkFreeSpans(lines);
+			LkUnmapFile(mappedFile);
+		}
+		---
+
+	Also See:
+		<LkParseResultFromFile>
+
+		<LkUnmapFile>
+*/
+DllEntry LkMappedFile* LkMapFile(const char* const path, LkStrView* content)
+{
+	content->str = "";
+	content->length = 0;
+
+	LkMappedFile* mappedFile = LkCallocFrom(1, sizeof(LkMappedFile), __func__);
+	if(mappedFile == NULL)
+		return NULL;
+
+#ifdef _WIN32
+	mappedFile->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	LARGE_INTEGER size;
+	if(mappedFile->file == INVALID_HANDLE_VALUE || !GetFileSizeEx(mappedFile->file, &size) || size.QuadPart > UINT32_MAX)
+	{
+		if(mappedFile->file != INVALID_HANDLE_VALUE)
+			CloseHandle(mappedFile->file);
+		LkFree(mappedFile);
+		return NULL;
+	}
+
+	mappedFile->length = (uint32_t)size.QuadPart;
+	if(mappedFile->length > 0)
+	{
+		mappedFile->mapping = CreateFileMappingA(mappedFile->file, NULL, PAGE_READONLY, 0, 0, NULL);
+		if(mappedFile->mapping != NULL)
+			mappedFile->data = MapViewOfFile(mappedFile->mapping, FILE_MAP_READ, 0, 0, 0);
+		if(mappedFile->data == NULL)
+		{
+			if(mappedFile->mapping != NULL)
+				CloseHandle(mappedFile->mapping);
+			CloseHandle(mappedFile->file);
+			LkFree(mappedFile);
+			return NULL;
+		}
+	}
+#else
+	int fd = open(path, O_RDONLY);
+	struct stat info;
+	if(fd < 0 || fstat(fd, &info) != 0 || (uint64_t)info.st_size > UINT32_MAX)
+	{
+		if(fd >= 0)
+			close(fd);
+		LkFree(mappedFile);
+		return NULL;
+	}
+
+	mappedFile->length = (uint32_t)info.st_size;
+	if(mappedFile->length > 0)
+	{
+		mappedFile->data = mmap(NULL, mappedFile->length, PROT_READ, MAP_PRIVATE, fd, 0);
+		if(mappedFile->data == MAP_FAILED)
+		{
+			close(fd);
+			LkFree(mappedFile);
+			return NULL;
+		}
+		// The records are usually read from the beginning to the end
+		madvise(mappedFile->data, mappedFile->length, MADV_SEQUENTIAL);
+	}
+	// The mapping keeps the file open
+	close(fd);
+#endif
+
+	if(mappedFile->length > 0)
+	{
+		content->str = mappedFile->data;
+		content->length = mappedFile->length;
+	}
+
+	return mappedFile;
+}
+
+/*
+	Function: LkUnmapFile
+		Releases a file mapped by <LkMapFile>. The views of its content are not valid anymore.
+
+	Arguments:
+		mappedFile - The mapped file returned by <LkMapFile>.
+
+	Also See:
+		<Release Memory>
+*/
+DllEntry void LkUnmapFile(LkMappedFile* mappedFile)
+{
+	if(mappedFile == NULL)
+		return;
+
+#ifdef _WIN32
+	if(mappedFile->data != NULL)
+	{
+		UnmapViewOfFile(mappedFile->data);
+		CloseHandle(mappedFile->mapping);
+	}
+	CloseHandle(mappedFile->file);
+#else
+	if(mappedFile->data != NULL)
+		munmap(mappedFile->data, mappedFile->length);
+#endif
+
+	LkFree(mappedFile);
+}
+
+struct LkBufferWriter
+{
+	int fd;
+	BOOL failed;
+	uint32_t count;
+	uint32_t length;
+	uint32_t capacity;
+	char* buffer;
+};
+
+/*
+	Function: WriteAll
+		Helper function for <LkBufferWriter> that writes a block of memory into a file descriptor, repeating the write until all of it is written.
+
+	Arguments:
+		fd - The file descriptor.
+		data - The block of memory.
+		size - The size of the block.
+
+	Returns:
+		TRUE if everything was written, FALSE if there was an error.
+*/
+static BOOL WriteAll(int fd, const char* data, uint32_t size)
+{
+	while(size > 0)
+	{
+		int written = LkWrite(fd, data, size > 0x40000000 ? 0x40000000 : size);
+		if(written < 0)
+		{
+#ifndef _WIN32
+			if(errno == EINTR)
+				continue;
+#endif
+			return FALSE;
+		}
+		// Nothing written for a non empty block means that the device can't take more data, so it would loop forever
+		if(written == 0)
+			return FALSE;
+		data += written;
+		size -= written;
+	}
+
+	return TRUE;
+}
+
+/*
+	Function: WriteBytes
+		Helper function for <LkBufferWriter> that adds bytes to the memory buffer, and writes the buffer into the file descriptor when it is full.
+		The blocks bigger than the buffer are written directly.
+
+	Arguments:
+		writer - The writer.
+		data - The bytes to add.
+		size - Number of bytes.
+
+	Returns:
+		TRUE if the bytes were added, FALSE if there was a write error, now or before.
+*/
+static BOOL WriteBytes(LkBufferWriter* writer, const char* data, uint32_t size)
+{
+	if(writer->failed)
+		return FALSE;
+
+	if(size > writer->capacity - writer->length)
+	{
+		if(!WriteAll(writer->fd, writer->buffer, writer->length))
+			writer->failed = TRUE;
+		writer->length = 0;
+		if(size >= writer->capacity)
+		{
+			if(!writer->failed && !WriteAll(writer->fd, data, size))
+				writer->failed = TRUE;
+			return !writer->failed;
+		}
+	}
+
+	memcpy(writer->buffer + writer->length, data, size);
+	writer->length += size;
+	return !writer->failed;
+}
+
+/*
+	Function: LkBufferWriterCreate
+		Creates a writer that composes the buffer of the New, Update or Delete Operations directly into a file descriptor.
+		The items are written block by block, in the order of the buffer: first all the "recordIds", then all the "records", and then all the "originalRecords".
+		<LkBufferWriterNextBlock> is called between the blocks. The result is the same as the one of <LkComposeNewBuffer>, <LkComposeUpdateBuffer> or <LkComposeDeleteBuffer>.
+
+	Arguments:
+		fd - The file descriptor, opened for writing. It is not closed by the writer.
+		bufferSize - Size of the memory buffer used to group the small writes. If 0, <LkBufferWriter_DEFAULT_BUFFER_SIZE> is used.
+
+	Returns:
+		The new writer, or NULL if there is no memory. It must be released with <LkBufferWriterClose>.
+
+	Example:
+		--- Code
+		int fd = open("update.lk", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		LkBufferWriter* writer = LkBufferWriterCreate(fd, 0);
+		for(int i=0; i<count; i++)
+			LkBufferWriterAppend(writer, lstRecordIds[i]);
+		LkBufferWriterNextBlock(writer);
+		for(int i=0; i<count; i++)
+			LkBufferWriterAppend(writer, lstRecords[i]);
+		LkBufferWriterNextBlock(writer);
+		for(int i=0; i<count; i++)
+			LkBufferWriterAppend(writer, lstOriginalRecords[i]);
+		if(!LkBufferWriterClose(writer))
+			printf("Write error\n");
+		close(fd);
+		---
+
+	Also See:
+		<LkBufferWriterClose>
+*/
+DllEntry LkBufferWriter* LkBufferWriterCreate(int fd, uint32_t bufferSize)
+{
+	if(bufferSize == 0)
+		bufferSize = LkBufferWriter_DEFAULT_BUFFER_SIZE;
+
+	LkBufferWriter* writer = LkMallocFrom(sizeof(LkBufferWriter) + bufferSize, __func__);
+	if(writer != NULL)
+	{
+		writer->fd = fd;
+		writer->failed = FALSE;
+		writer->count = 0;
+		writer->length = 0;
+		writer->capacity = bufferSize;
+		writer->buffer = (char*)(writer + 1);
+	}
+
+	return writer;
+}
+
+/*
+	Function: LkBufferWriterAppend
+		Appends an item to the current block of a <LkBufferWriter>, with the <ASCII_RS> separator if it is not the first item of the block.
+
+	Arguments:
+		writer - The writer created by <LkBufferWriterCreate>.
+		item - The "recordId", "record" or "originalRecord". NULL is appended as an empty item.
+
+	Returns:
+		TRUE if the item was appended, FALSE if there was a write error.
+*/
+DllEntry BOOL LkBufferWriterAppend(LkBufferWriter* writer, const char* const item)
+{
+	if(writer->count++ > 0 && !WriteBytes(writer, ASCII_RS_str, 1))
+		return FALSE;
+
+	return item == NULL || WriteBytes(writer, item, strlen(item));
+}
+
+/*
+	Function: LkBufferWriterNextBlock
+		Ends the current block of a <LkBufferWriter> with the <ASCII_FS> separator. The next items are appended to the next block.
+
+	Arguments:
+		writer - The writer created by <LkBufferWriterCreate>.
+
+	Returns:
+		TRUE if the separator was written, FALSE if there was a write error.
+*/
+DllEntry BOOL LkBufferWriterNextBlock(LkBufferWriter* writer)
+{
+	writer->count = 0;
+	return WriteBytes(writer, ASCII_FS_str, 1);
+}
+
+/*
+	Function: LkBufferWriterClose
+		Writes the rest of the buffer of a <LkBufferWriter> into its file descriptor, and releases the writer. The file descriptor is not closed.
+
+	Arguments:
+		writer - The writer created by <LkBufferWriterCreate>.
+
+	Returns:
+		TRUE if all the items were written, FALSE if there was any write error.
+
+	Also See:
+		<Release Memory>
+*/
+DllEntry BOOL LkBufferWriterClose(LkBufferWriter* writer)
+{
+	if(writer == NULL)
+		return FALSE;
+
+	BOOL result = !writer->failed && WriteAll(writer->fd, writer->buffer, writer->length);
+	LkFree(writer);
+	return result;
+}
@@ -0,0 +1,751 @@
+/*
+	File: LinkarMemory.c
+	This module contains the <LkArena> memory pool used by the *Arena functions of the library.
+
+	An arena allocates big blocks of memory and gives consecutive pieces of them, so every allocation is only an addition.
+	The pieces are not released one by one: all of them are released at once with <LkArenaReset>, that keeps the blocks to be reused,
+	or with <LkArenaDestroy>, that releases the blocks too. This way, all the results of a request can be released with only one call.
+
+	A <LkArena> must not be used by several threads at the same time.
+
+	The module also contains the allocator used by all the library. By default it is malloc, realloc and free, but another one
+	(jemalloc, a pool per thread...) can be installed with <LkSetAllocator>. With <LkSetMemoryAccounting>, the size of every block
+	and the function that requested it are kept in a table apart, so the live and peak bytes of the library, and of every one
+	of its functions, can be obtained with <LkGetMemoryStats> and <LkGetMemoryEntryStats>. The blocks themselves are not changed.
+*/
+
+#include "LinkarMemory.h"
+#include <string.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+	#include <windows.h>
+
+	static SRWLOCK statsLock = SRWLOCK_INIT;
+
+	#define LkStatsLock() AcquireSRWLockExclusive(&statsLock)
+	#define LkStatsUnlock() ReleaseSRWLockExclusive(&statsLock)
+#else
+	#include <pthread.h>
+
+	static pthread_mutex_t statsLock = PTHREAD_MUTEX_INITIALIZER;
+
+	#define LkStatsLock() pthread_mutex_lock(&statsLock)
+	#define LkStatsUnlock() pthread_mutex_unlock(&statsLock)
+#endif
+
+// All the pieces are aligned to this size, so they can hold any type
+#define LK_ARENA_ALIGN 16
+
+typedef struct LkArenaBlock
+{
+	struct LkArenaBlock* next;
+	uint32_t capacity;
+	uint32_t used;
+} LkArenaBlock;
+
+struct LkArena
+{
+	LkArenaBlock* first;
+	LkArenaBlock* current;
+	uint32_t blockSize;
+};
+
+// The header of the block is padded, so the first piece is aligned too
+#define LK_ARENA_HEADER_SIZE ((sizeof(LkArenaBlock) + LK_ARENA_ALIGN - 1) & ~(LK_ARENA_ALIGN - 1))
+
+static LkArenaBlock* NewBlock(uint32_t capacity)
+{
+	LkArenaBlock* block = LkMallocFrom(LK_ARENA_HEADER_SIZE + capacity, "LkArenaAlloc");
+	if(block)
+	{
+		block->next = NULL;
+		block->capacity = capacity;
+		block->used = 0;
+	}
+
+	return block;
+}
+
+/*
+	Function: LkArenaCreate
+		Creates a memory pool for the *Arena functions of the library.
+
+	Arguments:
+		blockSize - Size of the memory blocks that the arena allocates. If 0, <LkArena_DEFAULT_BLOCK_SIZE> is used. Bigger allocations get their own block.
+
+	Returns:
+		The new arena, or NULL if there is no memory. It must be released with <LkArenaDestroy>.
+
+	Example:
+		--- Code
+		LkArena* arena = LkArenaCreate(0);
+		while(...) // For every request
+		{
+			uint32_t count;
+			char** records = LkExtractRecordsArena(arena, lkStringResult, &count);
+			...
+			LkArenaReset(arena); // Releases "records" and everything else allocated for the request
+		}
+		LkArenaDestroy(arena);
+		---
+
+	Also See:
+		<LkArenaReset>
+
+		<LkArenaDestroy>
+*/
+DllEntry LkArena* LkArenaCreate(uint32_t blockSize)
+{
+	LkArena* arena = LkMallocFrom(sizeof(LkArena), __func__);
+	if(arena)
+	{
+		arena->blockSize = blockSize > 0 ? blockSize : LkArena_DEFAULT_BLOCK_SIZE;
+		arena->first = NULL;
+		arena->current = NULL;
+	}
+
+	return arena;
+}
+
+/*
+	Function: LkArenaAlloc
+		Allocates memory from an arena. The memory is aligned to 16 bytes, and it is valid until <LkArenaReset> or <LkArenaDestroy> is called.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		size - Number of bytes to allocate.
+
+	Returns:
+		Pointer to the allocated memory, or NULL if there is no memory. It must not be released with free or <LkFree>.
+*/
+DllEntry void* LkArenaAlloc(LkArena* arena, uint32_t size)
+{
+	if(arena == NULL || size > UINT32_MAX - LK_ARENA_HEADER_SIZE - LK_ARENA_ALIGN)
+		return NULL;
+
+	uint32_t alignedSize = (size + LK_ARENA_ALIGN - 1) & ~(LK_ARENA_ALIGN - 1);
+	LkArenaBlock* block = arena->current;
+	if(block == NULL || block->capacity - block->used < alignedSize)
+	{
+		// After a reset, the next blocks are empty and can be reused
+		if(block != NULL && block->next != NULL && block->next->capacity >= alignedSize)
+			block = block->next;
+		else
+		{
+			LkArenaBlock* newBlock = NewBlock(alignedSize > arena->blockSize ? alignedSize : arena->blockSize);
+			if(newBlock == NULL)
+				return NULL;
+
+			if(block == NULL)
+			{
+				newBlock->next = arena->first;
+				arena->first = newBlock;
+			}
+			else
+			{
+				newBlock->next = block->next;
+				block->next = newBlock;
+			}
+			block = newBlock;
+		}
+		arena->current = block;
+	}
+
+	void* piece = (char*)block + LK_ARENA_HEADER_SIZE + block->used;
+	block->used += alignedSize;
+	return piece;
+}
+
+/*
+	Function: LkArenaCopy
+		Copies a string, or a fragment of a string, into an arena, adding the NUL terminator.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		str - The string to copy. It doesn't need to be NUL terminated.
+		length - Number of chars to copy.
+
+	Returns:
+		The new NUL terminated string, or NULL if there is no memory.
+*/
+DllEntry char* LkArenaCopy(LkArena* arena, const char* const str, uint32_t length)
+{
+	char* result = LkArenaAlloc(arena, length + 1);
+	if(result)
+	{
+		if(length > 0)
+			memcpy(result, str, length);
+		result[length] = 0;
+	}
+
+	return result;
+}
+
+/*
+	Function: LkArenaReset
+		Releases at once all the memory allocated from an arena. The blocks of memory are kept, so the arena can be reused without allocating them again.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+*/
+DllEntry void LkArenaReset(LkArena* arena)
+{
+	if(arena == NULL)
+		return;
+
+	LkArenaBlock* block;
+	for(block = arena->first; block != NULL; block = block->next)
+		block->used = 0;
+	arena->current = arena->first;
+}
+
+/*
+	Function: LkArenaDestroy
+		Releases an arena and all the memory allocated from it.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+
+	Also See:
+		<Release Memory>
+*/
+DllEntry void LkArenaDestroy(LkArena* arena)
+{
+	if(arena == NULL)
+		return;
+
+	LkArenaBlock* block = arena->first;
+	while(block != NULL)
+	{
+		LkArenaBlock* next = block->next;
+		LkFree(block);
+		block = next;
+	}
+	LkFree(arena);
+}
+
+// Item of the table of the accounted blocks. The pointer is the key, so the blocks are returned as the allocator gives them
+typedef struct
+{
+	void* ptr;
+	size_t size;
+	uint32_t entry;
+} LkMemoryBlock;
+
+static void* DefaultMalloc(void* context, size_t size)
+{
+	(void)context;
+	return malloc(size);
+}
+
+static void* DefaultRealloc(void* context, void* ptr, size_t size)
+{
+	(void)context;
+	return realloc(ptr, size);
+}
+
+static void DefaultFree(void* context, void* ptr)
+{
+	(void)context;
+	free(ptr);
+}
+
+static LkMallocFunction allocatorMalloc = DefaultMalloc;
+static LkReallocFunction allocatorRealloc = DefaultRealloc;
+static LkFreeFunction allocatorFree = DefaultFree;
+static void* allocatorContext = NULL;
+
+// Once the first block is allocated, the allocator and the accounting can't be changed, because the blocks must be released in the same way
+static volatile BOOL allocatorInUse = FALSE;
+static BOOL accounting = FALSE;
+
+// The entry 0 collects the allocations without entry point, and those of the functions that don't fit in the table
+static LkMemoryStats memoryStats;
+static LkMemoryEntryStats entryStats[LkMemory_MAX_ENTRY_POINTS] = { { "LkMalloc", 0, 0, 0, 0 } };
+
+// Open addressing table of the accounted blocks. Its capacity is a power of 2, and it is kept at most half full
+static LkMemoryBlock* blocks = NULL;
+static size_t blocksCapacity = 0;
+static size_t blocksCount = 0;
+
+/*
+	Function: FindEntry
+		Helper function that finds, or adds, the entry of <entryStats> of a function. Open addressing on a hash of the name is used,
+		because the same name can have several addresses when it is written in several places. It must be called with the statistics locked.
+
+	Arguments:
+		entryPoint - Name of the function that requests the memory, or NULL.
+
+	Returns:
+		The index of the entry.
+*/
+static uint32_t FindEntry(const char* const entryPoint)
+{
+	if(entryPoint == NULL)
+		return 0;
+
+	uint32_t hash = 2166136261u;
+	const char* p;
+	for(p = entryPoint; *p; p++)
+		hash = (hash ^ (uint8_t)*p) * 16777619u;
+
+	uint32_t i;
+	for(i = 0; i < LkMemory_MAX_ENTRY_POINTS - 1; i++)
+	{
+		uint32_t index = 1 + (hash + i) % (LkMemory_MAX_ENTRY_POINTS - 1);
+		LkMemoryEntryStats* entry = &entryStats[index];
+		if(entry->entryPoint == NULL)
+		{
+			entry->entryPoint = entryPoint;
+			return index;
+		}
+		if(entry->entryPoint == entryPoint || strcmp(entry->entryPoint, entryPoint) == 0)
+			return index;
+	}
+
+	return 0;
+}
+
+/*
+	Function: AddLiveBytes
+		Helper function that accounts an allocation, a reallocation or a release in the totals and in one entry. It must be called with the statistics locked.
+
+	Arguments:
+		index - The entry of the function that requested the memory.
+		newSize - Size of the block after the operation, 0 when it is released.
+		oldSize - Size of the block before the operation, 0 when it is allocated.
+*/
+static void AddLiveBytes(uint32_t index, size_t newSize, size_t oldSize)
+{
+	LkMemoryEntryStats* entry = &entryStats[index];
+	memoryStats.liveBytes += newSize;
+	memoryStats.liveBytes -= oldSize;
+	entry->liveBytes += newSize;
+	entry->liveBytes -= oldSize;
+	if(newSize > 0)
+	{
+		memoryStats.allocations++;
+		entry->allocations++;
+		entry->totalBytes += newSize;
+		if(memoryStats.liveBytes > memoryStats.peakBytes)
+			memoryStats.peakBytes = memoryStats.liveBytes;
+		if(entry->liveBytes > entry->peakBytes)
+			entry->peakBytes = entry->liveBytes;
+	}
+	else
+		memoryStats.frees++;
+}
+
+static size_t BlockSlot(const void* const ptr)
+{
+	uint64_t hash = ((uint64_t)(uintptr_t)ptr >> 4) * 0x9E3779B97F4A7C15ull;
+	return (size_t)(hash >> 32) & (blocksCapacity - 1);
+}
+
+/*
+	Function: RemoveBlock
+		Helper function that takes a block out of the table of the accounted blocks. The next blocks of its run are moved back,
+		so no deleted marks are needed. It must be called with the statistics locked.
+
+	Arguments:
+		ptr - The block to remove.
+		block - Receives the size and the entry of the block.
+
+	Returns:
+		TRUE if the block was in the table.
+*/
+static BOOL RemoveBlock(const void* const ptr, LkMemoryBlock* block)
+{
+	if(blocksCount == 0)
+		return FALSE;
+
+	size_t mask = blocksCapacity - 1;
+	size_t i = BlockSlot(ptr);
+	while(blocks[i].ptr != ptr)
+	{
+		if(blocks[i].ptr == NULL)
+			return FALSE;
+		i = (i + 1) & mask;
+	}
+	*block = blocks[i];
+	blocksCount--;
+
+	size_t j = i;
+	for(;;)
+	{
+		j = (j + 1) & mask;
+		if(blocks[j].ptr == NULL)
+			break;
+		// The block of "j" can fill the hole only if its slot is not between the hole and "j"
+		size_t slot = BlockSlot(blocks[j].ptr);
+		if(((j - slot) & mask) >= ((j - i) & mask))
+		{
+			blocks[i] = blocks[j];
+			i = j;
+		}
+	}
+	blocks[i].ptr = NULL;
+
+	return TRUE;
+}
+
+/*
+	Function: AddBlock
+		Helper function that puts a block in the table of the accounted blocks, growing the table when it is half full.
+		If the same address is already there, its previous block was released with free instead of <LkFree>, so it stops being live.
+		It must be called with the statistics locked.
+
+	Arguments:
+		ptr - The new block.
+		size - Size of the block.
+		entry - The entry of the function that requested it.
+
+	Returns:
+		TRUE if the block was put in the table, FALSE if the table can't grow. In that case the block is not accounted, but it is still valid.
+*/
+static BOOL AddBlock(void* ptr, size_t size, uint32_t entry)
+{
+	LkMemoryBlock old;
+	if(RemoveBlock(ptr, &old))
+		AddLiveBytes(old.entry, 0, old.size);
+
+	if((blocksCount + 1) * 2 > blocksCapacity)
+	{
+		size_t newCapacity = blocksCapacity > 0 ? blocksCapacity * 2 : 1024;
+		LkMemoryBlock* newBlocks = newCapacity <= SIZE_MAX / sizeof(LkMemoryBlock) ? allocatorMalloc(allocatorContext, newCapacity * sizeof(LkMemoryBlock)) : NULL;
+		if(newBlocks == NULL)
+			return FALSE;
+		memset(newBlocks, 0, newCapacity * sizeof(LkMemoryBlock));
+
+		LkMemoryBlock* oldBlocks = blocks;
+		size_t oldCapacity = blocksCapacity;
+		blocks = newBlocks;
+		blocksCapacity = newCapacity;
+		blocksCount = 0;
+
+		size_t i;
+		for(i = 0; i < oldCapacity; i++)
+			if(oldBlocks[i].ptr != NULL)
+				AddBlock(oldBlocks[i].ptr, oldBlocks[i].size, oldBlocks[i].entry);
+		if(oldBlocks != NULL)
+			allocatorFree(allocatorContext, oldBlocks);
+	}
+
+	size_t i = BlockSlot(ptr);
+	while(blocks[i].ptr != NULL)
+		i = (i + 1) & (blocksCapacity - 1);
+	blocks[i].ptr = ptr;
+	blocks[i].size = size;
+	blocks[i].entry = entry;
+	blocksCount++;
+	return TRUE;
+}
+
+/*
+	Function: LkSetAllocator
+		Installs the functions used by the library to allocate and release memory. It must be called before any other function of the library.
+
+	Arguments:
+		mallocFunction - Function that allocates memory. If NULL, malloc, realloc and free are used.
+		reallocFunction - Function that changes the size of the memory allocated with "mallocFunction".
+		freeFunction - Function that releases the memory allocated with "mallocFunction" or "reallocFunction".
+		context - Free pointer passed to the three functions, for example a pool of memory.
+
+	Returns:
+		TRUE if the allocator was installed, or FALSE if the library has already allocated memory, or some function is missing.
+
+	Remarks:
+		When an allocator is installed, the results of the functions of the library that are allocated by the open-source modules must be released with <LkFree>,
+		or with their own Free function (<LkFreeParsedResult>, <LkFreeColumns>...), instead of free or LkFreeMemory.
+		The results of the operations executed by the Linkar private library are not affected, and they are released as always.
+
+	Example:
+		--- Code
+		static void* PoolMalloc(void* context, size_t size) { return je_malloc(size); }
+		static void* PoolRealloc(void* context, void* ptr, size_t size) { return je_realloc(ptr, size); }
+		static void PoolFree(void* context, void* ptr) { je_free(ptr); }
+
+		int main()
+		{
+			LkSetAllocator(PoolMalloc, PoolRealloc, PoolFree, NULL);
+			...
+		}
+		---
+
+	Also See:
+		<LkSetMemoryAccounting>
+*/
+DllEntry BOOL LkSetAllocator(LkMallocFunction mallocFunction, LkReallocFunction reallocFunction, LkFreeFunction freeFunction, void* context)
+{
+	if(allocatorInUse)
+		return FALSE;
+
+	if(mallocFunction == NULL)
+	{
+		allocatorMalloc = DefaultMalloc;
+		allocatorRealloc = DefaultRealloc;
+		allocatorFree = DefaultFree;
+		allocatorContext = NULL;
+		return TRUE;
+	}
+
+	if(reallocFunction == NULL || freeFunction == NULL)
+		return FALSE;
+
+	allocatorMalloc = mallocFunction;
+	allocatorRealloc = reallocFunction;
+	allocatorFree = freeFunction;
+	allocatorContext = context;
+	return TRUE;
+}
+
+/*
+	Function: LkSetMemoryAccounting
+		Enables or disables the accounting of the memory allocated by the library. It must be called before any other function of the library, except <LkSetAllocator>.
+
+	Arguments:
+		enabled - TRUE to account every allocation, so <LkGetMemoryStats> and <LkGetMemoryEntryStats> can be used.
+
+	Returns:
+		TRUE if the accounting was changed, or FALSE if the library has already allocated memory.
+
+	Remarks:
+		The accounting adds an item of a table to every block, and a lock to every allocation and release, so it is intended to find where the memory goes, not for production.
+		The pointers returned by the library are not changed, so its results are released as always. But the bytes of the results released with free or LkFreeMemory
+		instead of <LkFree> keep being counted as live, until their address is allocated again.
+
+	Example:
+		--- Code
+		LkSetMemoryAccounting(TRUE);
+		...
+		LkMemoryEntryStats entries[LkMemory_MAX_ENTRY_POINTS];
+		uint32_t count = LkGetMemoryEntryStats(entries, LkMemory_MAX_ENTRY_POINTS);
+		for(uint32_t i = 0; i < count; i++)
+			printf("%s: %llu live, %llu peak, %llu allocations\n", entries[i].entryPoint, entries[i].liveBytes, entries[i].peakBytes, entries[i].allocations);
+		---
+*/
+DllEntry BOOL LkSetMemoryAccounting(BOOL enabled)
+{
+	if(allocatorInUse)
+		return (accounting != 0) == (enabled != 0);
+
+	accounting = enabled;
+	return TRUE;
+}
+
+/*
+	Function: LkMallocFrom
+		Allocates memory with the allocator of the library, accounting it to a function. The modules of the library call it with their own name.
+
+	Arguments:
+		size - Number of bytes to allocate.
+		entryPoint - Name of the function that requests the memory, or NULL. It must be a string that is never released, like __func__.
+
+	Returns:
+		Pointer to the allocated memory, or NULL if there is no memory. It must be released with <LkFree>.
+*/
+DllEntry void* LkMallocFrom(size_t size, const char* const entryPoint)
+{
+	if(!allocatorInUse)
+		allocatorInUse = TRUE;
+
+	void* ptr = allocatorMalloc(allocatorContext, size);
+	if(ptr == NULL || !accounting)
+		return ptr;
+
+	LkStatsLock();
+	// Only the blocks in the table are counted, because LkFree can't subtract the others
+	uint32_t entry = FindEntry(entryPoint);
+	if(AddBlock(ptr, size, entry))
+		AddLiveBytes(entry, size, 0);
+	LkStatsUnlock();
+
+	return ptr;
+}
+
+/*
+	Function: LkCallocFrom
+		Allocates memory filled with zeros with the allocator of the library, accounting it to a function.
+
+	Arguments:
+		count - Number of elements.
+		size - Size of every element.
+		entryPoint - Name of the function that requests the memory, or NULL. It must be a string that is never released, like __func__.
+
+	Returns:
+		Pointer to the allocated memory, or NULL if there is no memory. It must be released with <LkFree>.
+*/
+DllEntry void* LkCallocFrom(size_t count, size_t size, const char* const entryPoint)
+{
+	if(size > 0 && count > SIZE_MAX / size)
+		return NULL;
+
+	void* ptr = LkMallocFrom(count * size, entryPoint);
+	if(ptr)
+		memset(ptr, 0, count * size);
+
+	return ptr;
+}
+
+/*
+	Function: LkReallocFrom
+		Changes the size of the memory allocated with the allocator of the library. The memory keeps being accounted to the function that allocated it.
+
+	Arguments:
+		ptr - The memory to change, or NULL to allocate new memory.
+		size - New number of bytes.
+		entryPoint - Name of the function that requests the memory, used only when "ptr" is NULL.
+
+	Returns:
+		Pointer to the reallocated memory, or NULL if there is no memory. In that case, "ptr" is not released.
+*/
+DllEntry void* LkReallocFrom(void* ptr, size_t size, const char* const entryPoint)
+{
+	if(ptr == NULL)
+		return LkMallocFrom(size, entryPoint);
+
+	if(!accounting)
+		return allocatorRealloc(allocatorContext, ptr, size);
+
+	// The block leaves the table before it is released, so another thread can't get its address while it is still there
+	LkMemoryBlock block;
+	LkStatsLock();
+	BOOL accounted = RemoveBlock(ptr, &block);
+	LkStatsUnlock();
+
+	void* newPtr = allocatorRealloc(allocatorContext, ptr, size);
+
+	LkStatsLock();
+	// A block that can't be put back in the table stops being accounted, so its bytes are subtracted as if it was released
+	if(newPtr != NULL)
+	{
+		uint32_t entry = accounted ? block.entry : FindEntry(entryPoint);
+		if(AddBlock(newPtr, size, entry))
+			AddLiveBytes(entry, size, accounted ? block.size : 0);
+		else if(accounted)
+			AddLiveBytes(entry, 0, block.size);
+	}
+	else if(accounted && !AddBlock(ptr, block.size, block.entry))
+		AddLiveBytes(block.entry, 0, block.size);
+	LkStatsUnlock();
+
+	return newPtr;
+}
+
+/*
+	Function: LkMalloc
+		Allocates memory with the allocator of the library. It is accounted to the "LkMalloc" entry.
+
+	Arguments:
+		size - Number of bytes to allocate.
+
+	Returns:
+		Pointer to the allocated memory, or NULL if there is no memory. It must be released with <LkFree>.
+*/
+DllEntry void* LkMalloc(size_t size)
+{
+	return LkMallocFrom(size, NULL);
+}
+
+/*
+	Function: LkCalloc
+		Allocates memory filled with zeros with the allocator of the library. It is accounted to the "LkMalloc" entry.
+
+	Arguments:
+		count - Number of elements.
+		size - Size of every element.
+
+	Returns:
+		Pointer to the allocated memory, or NULL if there is no memory. It must be released with <LkFree>.
+*/
+DllEntry void* LkCalloc(size_t count, size_t size)
+{
+	return LkCallocFrom(count, size, NULL);
+}
+
+/*
+	Function: LkRealloc
+		Changes the size of the memory allocated with the allocator of the library.
+
+	Arguments:
+		ptr - The memory to change, or NULL to allocate new memory.
+		size - New number of bytes.
+
+	Returns:
+		Pointer to the reallocated memory, or NULL if there is no memory. In that case, "ptr" is not released.
+*/
+DllEntry void* LkRealloc(void* ptr, size_t size)
+{
+	return LkReallocFrom(ptr, size, NULL);
+}
+
+/*
+	Function: LkFree
+		Releases the memory allocated with the allocator of the library. It can be used to release any result allocated by the open-source modules of the library.
+
+	Arguments:
+		ptr - The memory to release. It can be NULL.
+
+	Also See:
+		<Release Memory>
+*/
+DllEntry void LkFree(void* ptr)
+{
+	if(ptr == NULL)
+		return;
+
+	if(accounting)
+	{
+		LkMemoryBlock block;
+		LkStatsLock();
+		if(RemoveBlock(ptr, &block))
+			AddLiveBytes(block.entry, 0, block.size);
+		LkStatsUnlock();
+	}
+
+	allocatorFree(allocatorContext, ptr);
+}
+
+/*
+	Function: LkGetMemoryStats
+		Obtains the totals of the memory allocated by the library, when the accounting is enabled with <LkSetMemoryAccounting>.
+
+	Arguments:
+		stats - The <LkMemoryStats> to fill. All its fields are 0 when the accounting is not enabled.
+*/
+DllEntry void LkGetMemoryStats(LkMemoryStats* stats)
+{
+	LkStatsLock();
+	*stats = memoryStats;
+	LkStatsUnlock();
+}
+
+/*
+	Function: LkGetMemoryEntryStats
+		Obtains the memory allocated by every function of the library, when the accounting is enabled with <LkSetMemoryAccounting>.
+
+	Arguments:
+		entries - The array to fill, with an item for every function that has allocated memory.
+		capacity - Number of items of "entries". Use <LkMemory_MAX_ENTRY_POINTS> to obtain all of them.
+
+	Returns:
+		The number of functions that have allocated memory. If it is greater than "capacity", only the first "capacity" items are filled.
+*/
+DllEntry uint32_t LkGetMemoryEntryStats(LkMemoryEntryStats* entries, uint32_t capacity)
+{
+	uint32_t count = 0;
+	uint32_t i;
+
+	LkStatsLock();
+	for(i = 0; i < LkMemory_MAX_ENTRY_POINTS; i++)
+		if(entryStats[i].allocations > 0)
+		{
+			if(count < capacity)
+				entries[count] = entryStats[i];
+			count++;
+		}
+	LkStatsUnlock();
+
+	return count;
+}
@@ -0,0 +1,387 @@
+/*
+	File: LinkarScan.c
+	This module contains the functions that find and count delimiter chars inside <LkStrings> and dynamic arrays.
+
+	They are used by the other modules of the library to split and count by <DBMV_Mark (char)> and <ASCII (uint8_t)> delimiters.
+	On x86 and x64 CPUs the blocks of 16 or 32 bytes are compared with SSE2 or AVX2 instructions. The instruction set is selected
+	the first time any of the functions is called, according to the CPU where the program is running. On other CPUs, or when the
+	CPU doesn't support SSE2, portable C code is used.
+
+	None of these functions allocates memory.
+*/
+
+#include "LinkarScan.h"
+#include <string.h>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	#define LK_SCAN_X86 1
+	#include <intrin.h>
+	#include <immintrin.h>
+	#define LK_SCAN_TARGET_SSE2
+	#define LK_SCAN_TARGET_AVX2
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+	#define LK_SCAN_X86 1
+	#include <immintrin.h>
+	#define LK_SCAN_TARGET_SSE2 __attribute__ ((target ("sse2")))
+	#define LK_SCAN_TARGET_AVX2 __attribute__ ((target ("avx2")))
+#endif
+
+// The detected level is read and written atomically, because several threads can detect it at the same time.
+// It doesn't publish any other data, so the accesses don't need to be ordered
+#if defined(_MSC_VER)
+	// MSVC reads and writes a volatile byte with one instruction
+	static volatile int8_t scanLevel = -1;
+
+	#define LkScanLoadLevel() (scanLevel)
+	#define LkScanStoreLevel(level) (scanLevel = (level))
+#else
+	static int8_t scanLevel = -1;
+
+	#define LkScanLoadLevel() __atomic_load_n(&scanLevel, __ATOMIC_RELAXED)
+	#define LkScanStoreLevel(level) __atomic_store_n(&scanLevel, (level), __ATOMIC_RELAXED)
+#endif
+
+static const char* FindByteScalar(const char* const str, uint32_t length, char byte)
+{
+	return memchr(str, byte, length);
+}
+
+static uint32_t CountByteScalar(const char* const str, uint32_t length, char byte)
+{
+	uint32_t count = 0;
+	uint32_t i;
+	for(i = 0; i < length; i++)
+		if(str[i] == byte)
+			count++;
+
+	return count;
+}
+
+static const char* FindAnyScalar(const char* const str, uint32_t length, const char* const set, uint32_t setLength)
+{
+	BOOL table[256] = { FALSE };
+	uint32_t i;
+	for(i = 0; i < setLength; i++)
+		table[(uint8_t)set[i]] = TRUE;
+
+	for(i = 0; i < length; i++)
+		if(table[(uint8_t)str[i]])
+			return str + i;
+
+	return NULL;
+}
+
+#ifdef LK_SCAN_X86
+
+static uint32_t TrailingZeros(uint32_t mask)
+{
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanForward(&index, mask);
+	return index;
+#else
+	return __builtin_ctz(mask);
+#endif
+}
+
+static uint8_t DetectLevel()
+{
+#ifdef _MSC_VER
+	int info[4];
+	__cpuid(info, 0);
+	int maxLeaf = info[0];
+
+	__cpuid(info, 1);
+	BOOL sse2 = (info[3] >> 26) & 1;
+	BOOL osxsave = (info[2] >> 27) & 1;
+	BOOL avx = (info[2] >> 28) & 1;
+
+	// AVX2 needs the OS to save the YMM registers too
+	if(maxLeaf >= 7 && osxsave && avx && (_xgetbv(0) & 0x06) == 0x06)
+	{
+		__cpuidex(info, 7, 0);
+		if((info[1] >> 5) & 1)
+			return LkScanLEVEL_AVX2;
+	}
+
+	return sse2 ? LkScanLEVEL_SSE2 : LkScanLEVEL_SCALAR;
+#else
+	__builtin_cpu_init();
+	if(__builtin_cpu_supports("avx2"))
+		return LkScanLEVEL_AVX2;
+	else if(__builtin_cpu_supports("sse2"))
+		return LkScanLEVEL_SSE2;
+	else
+		return LkScanLEVEL_SCALAR;
+#endif
+}
+
+static LK_SCAN_TARGET_SSE2 const char* FindByteSSE2(const char* const str, uint32_t length, char byte)
+{
+	const char* p = str;
+	const char* end = str + length;
+	__m128i needle = _mm_set1_epi8(byte);
+	for(; end - p >= 16; p += 16)
+	{
+		uint32_t mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)p), needle));
+		if(mask)
+			return p + TrailingZeros(mask);
+	}
+
+	return FindByteScalar(p, end - p, byte);
+}
+
+static LK_SCAN_TARGET_SSE2 uint32_t CountByteSSE2(const char* const str, uint32_t length, char byte)
+{
+	const char* p = str;
+	const char* end = str + length;
+	__m128i needle = _mm_set1_epi8(byte);
+	__m128i zero = _mm_setzero_si128();
+	__m128i total = zero;
+	while(end - p >= 16)
+	{
+		// Every byte of the accumulator counts up to 255 matches, then they are added to the 64 bits totals
+		uint32_t blocks = (end - p) / 16;
+		if(blocks > 255)
+			blocks = 255;
+
+		__m128i partial = zero;
+		uint32_t i;
+		for(i = 0; i < blocks; i++, p += 16)
+			partial = _mm_sub_epi8(partial, _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)p), needle));
+		total = _mm_add_epi64(total, _mm_sad_epu8(partial, zero));
+	}
+
+	uint32_t count = _mm_cvtsi128_si32(total) + _mm_cvtsi128_si32(_mm_srli_si128(total, 8));
+	return count + CountByteScalar(p, end - p, byte);
+}
+
+static LK_SCAN_TARGET_SSE2 const char* FindAnySSE2(const char* const str, uint32_t length, const char* const set, uint32_t setLength)
+{
+	const char* p = str;
+	const char* end = str + length;
+	__m128i needles[LkScanFindAny_MAX_SET];
+	uint32_t i;
+	for(i = 0; i < setLength; i++)
+		needles[i] = _mm_set1_epi8(set[i]);
+
+	for(; end - p >= 16; p += 16)
+	{
+		__m128i block = _mm_loadu_si128((const __m128i*)p);
+		__m128i found = _mm_cmpeq_epi8(block, needles[0]);
+		for(i = 1; i < setLength; i++)
+			found = _mm_or_si128(found, _mm_cmpeq_epi8(block, needles[i]));
+
+		uint32_t mask = _mm_movemask_epi8(found);
+		if(mask)
+			return p + TrailingZeros(mask);
+	}
+
+	return FindAnyScalar(p, end - p, set, setLength);
+}
+
+static LK_SCAN_TARGET_AVX2 const char* FindByteAVX2(const char* const str, uint32_t length, char byte)
+{
+	const char* p = str;
+	const char* end = str + length;
+	__m256i needle = _mm256_set1_epi8(byte);
+	for(; end - p >= 32; p += 32)
+	{
+		uint32_t mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)p), needle));
+		if(mask)
+			return p + TrailingZeros(mask);
+	}
+
+	return FindByteSSE2(p, end - p, byte);
+}
+
+static LK_SCAN_TARGET_AVX2 uint32_t CountByteAVX2(const char* const str, uint32_t length, char byte)
+{
+	const char* p = str;
+	const char* end = str + length;
+	__m256i needle = _mm256_set1_epi8(byte);
+	__m256i zero = _mm256_setzero_si256();
+	__m256i total = zero;
+	while(end - p >= 32)
+	{
+		uint32_t blocks = (end - p) / 32;
+		if(blocks > 255)
+			blocks = 255;
+
+		__m256i partial = zero;
+		uint32_t i;
+		for(i = 0; i < blocks; i++, p += 32)
+			partial = _mm256_sub_epi8(partial, _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)p), needle));
+		total = _mm256_add_epi64(total, _mm256_sad_epu8(partial, zero));
+	}
+
+	__m128i sum = _mm_add_epi64(_mm256_castsi256_si128(total), _mm256_extracti128_si256(total, 1));
+	uint32_t count = _mm_cvtsi128_si32(sum) + _mm_cvtsi128_si32(_mm_srli_si128(sum, 8));
+	return count + CountByteSSE2(p, end - p, byte);
+}
+
+static LK_SCAN_TARGET_AVX2 const char* FindAnyAVX2(const char* const str, uint32_t length, const char* const set, uint32_t setLength)
+{
+	const char* p = str;
+	const char* end = str + length;
+	__m256i needles[LkScanFindAny_MAX_SET];
+	uint32_t i;
+	for(i = 0; i < setLength; i++)
+		needles[i] = _mm256_set1_epi8(set[i]);
+
+	for(; end - p >= 32; p += 32)
+	{
+		__m256i block = _mm256_loadu_si256((const __m256i*)p);
+		__m256i found = _mm256_cmpeq_epi8(block, needles[0]);
+		for(i = 1; i < setLength; i++)
+			found = _mm256_or_si256(found, _mm256_cmpeq_epi8(block, needles[i]));
+
+		uint32_t mask = _mm256_movemask_epi8(found);
+		if(mask)
+			return p + TrailingZeros(mask);
+	}
+
+	return FindAnySSE2(p, end - p, set, setLength);
+}
+
+#else
+
+static uint8_t DetectLevel()
+{
+	return LkScanLEVEL_SCALAR;
+}
+
+#endif
+
+/*
+	Function: LkScanGetLevel
+		Gets the instruction set used by the functions of this module in the current CPU.
+
+	Returns:
+		One of the <LkScanLEVEL> constants: LkScanLEVEL_SCALAR, LkScanLEVEL_SSE2 or LkScanLEVEL_AVX2.
+*/
+DllEntry uint8_t LkScanGetLevel()
+{
+	// Several threads can do the detection at the same time, but all of them get the same result
+	int8_t level = LkScanLoadLevel();
+	if(level < 0)
+	{
+		level = DetectLevel();
+		LkScanStoreLevel(level);
+	}
+
+	return level;
+}
+
+/*
+	Function: LkScanFindByte
+		Finds the first occurrence of a char inside a string, like memchr.
+
+	Arguments:
+		str - The string where the char is searched. It can contain NUL chars, because its length is given by "length".
+		length - Length of "str".
+		byte - The char to find, for example <ASCII_RS> or <DBMV_Mark_AM>.
+
+	Returns:
+		Pointer to the first occurrence of "byte" inside "str", or NULL if it is not found.
+
+	Example:
+		--- Code
+		const char* record = "CUSTOMER UPDATE 2þADDRESS 2þ444";
+		const char* am = LkScanFindByte(record, strlen(record), DBMV_Mark_AM);
+		---
+*/
+DllEntry const char* LkScanFindByte(const char* const str, uint32_t length, char byte)
+{
+	if(str == NULL)
+		return NULL;
+
+#ifdef LK_SCAN_X86
+	switch(LkScanGetLevel())
+	{
+		case LkScanLEVEL_AVX2:
+			return FindByteAVX2(str, length, byte);
+		case LkScanLEVEL_SSE2:
+			return FindByteSSE2(str, length, byte);
+	}
+#endif
+	return FindByteScalar(str, length, byte);
+}
+
+/*
+	Function: LkScanCountByte
+		Counts the occurrences of a char inside a string.
+
+	Arguments:
+		str - The string where the char is counted. It can contain NUL chars, because its length is given by "length".
+		length - Length of "str".
+		byte - The char to count, for example <ASCII_RS> or <DBMV_Mark_AM>.
+
+	Returns:
+		The number of occurrences found.
+
+	Example:
+		--- Code
+		const char* record = "CUSTOMER UPDATE 2þADDRESS 2þ444";
+		uint32_t numAttributes = LkScanCountByte(record, strlen(record), DBMV_Mark_AM) + 1;
+		---
+*/
+DllEntry uint32_t LkScanCountByte(const char* const str, uint32_t length, char byte)
+{
+	if(str == NULL)
+		return 0;
+
+#ifdef LK_SCAN_X86
+	switch(LkScanGetLevel())
+	{
+		case LkScanLEVEL_AVX2:
+			return CountByteAVX2(str, length, byte);
+		case LkScanLEVEL_SSE2:
+			return CountByteSSE2(str, length, byte);
+	}
+#endif
+	return CountByteScalar(str, length, byte);
+}
+
+/*
+	Function: LkScanFindAny
+		Finds the first char of a string that is any of the chars of a set, in only one pass.
+		For example, it can find the next mark of a dynamic array, whatever its level is.
+
+	Arguments:
+		str - The string where the chars are searched. It can contain NUL chars, because its length is given by "length".
+		length - Length of "str".
+		set - The chars to find. It can contain NUL chars, because its length is given by "setLength".
+		setLength - Number of chars of "set". Up to <LkScanFindAny_MAX_SET> chars are compared with SIMD instructions.
+
+	Returns:
+		Pointer to the first char of "str" that is in "set", or NULL if none of them is found.
+
+	Example:
+		--- Code
+		const char marks[] = { DBMV_Mark_AM, DBMV_Mark_VM, DBMV_Mark_SM };
+		const char* mark = LkScanFindAny(record, strlen(record), marks, 3);
+		---
+*/
+DllEntry const char* LkScanFindAny(const char* const str, uint32_t length, const char* const set, uint32_t setLength)
+{
+	if(str == NULL || set == NULL || setLength == 0)
+		return NULL;
+
+	if(setLength == 1)
+		return LkScanFindByte(str, length, set[0]);
+
+#ifdef LK_SCAN_X86
+	if(setLength <= LkScanFindAny_MAX_SET)
+	{
+		switch(LkScanGetLevel())
+		{
+			case LkScanLEVEL_AVX2:
+				return FindAnyAVX2(str, length, set, setLength);
+			case LkScanLEVEL_SSE2:
+				return FindAnySSE2(str, length, set, setLength);
+		}
+	}
+#endif
+	return FindAnyScalar(str, length, set, setLength);
+}
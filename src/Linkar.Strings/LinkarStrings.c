@@ -8,6 +8,8 @@
 
 #include "LinkarStrings.h"
 #include "LinkarStringsHelper.h"
+#include "LinkarScan.h"
+#include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include <malloc.h>
@@ -962,6 +964,53 @@ DllEntry char* LkComposeSubroutineArgs(const char** const lstArgs, uint32_t coun
     return LkStrJoin(lstArgs, count, ASCII_DC4_str);
 }
 
+/*
+	Function: JoinStrings
+		Helper function for the LkCompose*Buffer and LkCompose*Arena functions, that joins an array of strings with only one allocation. NULL strings are joined as empty strings.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>, or NULL to allocate the result with the allocator of the library.
+		lstStr - Array of strings to be joined.
+		count - The array size.
+		delim - The string placed between every two strings.
+		entryPoint - Name of the function that requests the memory, for <LkSetMemoryAccounting>.
+
+	Returns:
+		The joined string, or NULL if there is no memory.
+*/
+static char* JoinStrings(LkArena* arena, const char* const* const lstStr, uint32_t count, const char* const delim, const char* const entryPoint)
+{
+	uint32_t lenDelim = strlen(delim);
+	uint32_t len = count > 0 ? (count - 1) * lenDelim : 0;
+	uint32_t i;
+	for(i = 0; i < count; i++)
+		if(lstStr[i])
+			len += strlen(lstStr[i]);
+
+	char* result = arena ? LkArenaAlloc(arena, len + 1) : LkMallocFrom(len + 1, entryPoint);
+	if(result == NULL)
+		return NULL;
+
+	char* p = result;
+	for(i = 0; i < count; i++)
+	{
+		if(i > 0)
+		{
+			memcpy(p, delim, lenDelim);
+			p += lenDelim;
+		}
+		if(lstStr[i])
+		{
+			uint32_t lenStr = strlen(lstStr[i]);
+			memcpy(p, lstStr[i], lenStr);
+			p += lenStr;
+		}
+	}
+	*p = 0;
+
+	return result;
+}
+
 /*
 	Function: LkComposeUpdateBuffer
 		Compose the fully buffer of the Update Operations with the block of "recordIds", "records" and "originalRecords".
@@ -1018,38 +1067,8 @@ DllEntry char* LkComposeSubroutineArgs(const char** const lstArgs, uint32_t coun
 */
 DllEntry char* LkComposeUpdateBuffer(const char* const recordIds, const char* const records, const char* const originalRecords)
 {
-	int lenRecordIds = 0;
-	int lenRecords = 0;
-	int lenOriginalRecords = 0;
-	if(recordIds != NULL)
-		lenRecordIds = strlen(recordIds);
-	if(records != NULL)
-		lenRecords = strlen(records);
-	if(originalRecords != NULL)
-		lenOriginalRecords = strlen(originalRecords);
-		
-	uint32_t len = lenRecordIds + lenRecords + lenOriginalRecords + 2*strlen(ASCII_FS_str) + 1;
-	char* updateBuffer = malloc(len);
-	if(updateBuffer != NULL)
-	{
-		if(recordIds != NULL)
-		{
-			strcpy(updateBuffer, recordIds);
-			strcat(updateBuffer, ASCII_FS_str);
-		}
-		else
-			strcpy(updateBuffer, ASCII_FS_str);
-		
-		if(records != NULL)
-			strcat(updateBuffer, records);
-		
-		strcat(updateBuffer, ASCII_FS_str);
-		
-		if(originalRecords != NULL)
-			strcat(updateBuffer, originalRecords);
-	}
-	
-	return updateBuffer;
+	const char* parts[3] = { recordIds, records, originalRecords };
+	return JoinStrings(NULL, parts, 3, ASCII_FS_str, __func__);
 }
         
 /*
@@ -1121,30 +1140,8 @@ DllEntry char* LkComposeUpdateBuffer(const char* const recordIds, const char* co
 */
 DllEntry char* LkComposeNewBuffer(const char* const recordIds, const char* const records)
 {
-	int lenRecordIds = 0;
-	int lenRecords = 0;
-	if(recordIds != NULL)
-		lenRecordIds = strlen(recordIds);
-	if(records != NULL)
-		lenRecords = strlen(records);
-
-	uint32_t len = lenRecordIds + lenRecords + strlen(ASCII_FS_str) + 1;
-    char* newBuffer = malloc(len);
-	if(newBuffer != NULL)
-	{
-		if(recordIds != NULL)
-		{
-			strcpy(newBuffer, recordIds);
-			strcat(newBuffer, ASCII_FS_str);
-		}
-		else
-			strcpy(newBuffer, ASCII_FS_str);
-
-		if(records != NULL)
-			strcat(newBuffer, records);
-	}
-	
-	return newBuffer;
+	const char* parts[2] = { recordIds, records };
+	return JoinStrings(NULL, parts, 2, ASCII_FS_str, __func__);
 }
 
 /*
@@ -1196,28 +1193,2480 @@ DllEntry char* LkComposeNewBuffer(const char* const recordIds, const char* const
 */
 DllEntry char* LkComposeDeleteBuffer(const char* const recordIds, const char* const originalRecords)
 {
-	int lenRecordIds = 0;
-	int lenOriginalRecords = 0;
-	if(recordIds != NULL)
-		lenRecordIds = strlen(recordIds);
-	if(originalRecords != NULL)
-		lenOriginalRecords = strlen(originalRecords);
+	const char* parts[2] = { recordIds, originalRecords };
+	return JoinStrings(NULL, parts, 2, ASCII_FS_str, __func__);
+}
+
+/*
+	Struct: LkBufferBuilderPart
+		One of the blocks of a <LkBufferBuilder>: the "recordIds", the "records" or the "originalRecords".
+*/
+typedef struct
+{
+	char* data;
+	uint32_t length;
+	uint32_t capacity;
+	uint32_t count;
+} LkBufferBuilderPart;
+
+struct LkBufferBuilder
+{
+	LkBufferBuilderPart parts[3];
+};
+
+#define LkBufferBuilder_IDS 0
+#define LkBufferBuilder_RECORDS 1
+#define LkBufferBuilder_ORIGINAL_RECORDS 2
+
+/*
+	Function: ReserveBuilderPart
+		Helper function for <LkBufferBuilder> that makes sure a block has room for some more chars. The capacity is doubled every time it grows,
+		so appending n chars one by one costs O(n) copies in total.
+
+	Arguments:
+		part - The block.
+		size - Number of chars that are going to be appended.
+		entryPoint - Name of the function that requests the memory, for <LkSetMemoryAccounting>.
+
+	Returns:
+		TRUE if there is room, FALSE if there is no memory.
+*/
+static BOOL ReserveBuilderPart(LkBufferBuilderPart* part, uint32_t size, const char* const entryPoint)
+{
+	uint64_t needed = (uint64_t)part->length + size;
+	if(needed <= part->capacity)
+		return TRUE;
+	if(needed > UINT32_MAX)
+		return FALSE;
+
+	uint64_t capacity = part->capacity > 0 ? part->capacity : 256;
+	while(capacity < needed)
+		capacity *= 2;
+	if(capacity > UINT32_MAX)
+		capacity = UINT32_MAX;
+
+	char* data = LkReallocFrom(part->data, (size_t)capacity, entryPoint);
+	if(data == NULL)
+		return FALSE;
+
+	part->data = data;
+	part->capacity = (uint32_t)capacity;
+	return TRUE;
+}
+
+/*
+	Function: AppendBuilderPart
+		Helper function for <LkBufferBuilder> that appends an item to a block, with the <ASCII_RS> separator if it is not the first one.
+
+	Arguments:
+		part - The block.
+		str - The item. NULL is appended as an empty item.
+		entryPoint - Name of the function that requests the memory, for <LkSetMemoryAccounting>.
+
+	Returns:
+		TRUE if the item was appended, FALSE if there is no memory.
+*/
+static BOOL AppendBuilderPart(LkBufferBuilderPart* part, const char* const str, const char* const entryPoint)
+{
+	uint32_t length = str ? strlen(str) : 0;
+	uint32_t separator = part->count > 0 ? 1 : 0;
+	if(!ReserveBuilderPart(part, length + separator, entryPoint))
+		return FALSE;
+
+	if(separator)
+		part->data[part->length++] = ASCII_RS;
+	if(length > 0)
+		memcpy(part->data + part->length, str, length);
+	part->length += length;
+	part->count++;
+	return TRUE;
+}
+
+/*
+	Function: LkBufferBuilderCreate
+		Creates a builder that composes the buffer of the New, Update or Delete Operations one record at a time.
+		The "recordIds", "records" and "originalRecords" are appended to blocks that double their size when they are full. The final buffer is the block
+		of "recordIds" with the other blocks copied after it, so the "records" are copied only once, instead of joining them with <LkComposeRecords>
+		and copying them again with <LkComposeUpdateBuffer>.
 
-	uint32_t len = lenRecordIds + lenOriginalRecords + strlen(ASCII_FS_str) + 1;
-	char* deleteBuffer = malloc(len);
-	if(deleteBuffer != NULL)
+	Arguments:
+		capacity - Expected size in bytes of every block, to avoid growing them. It can be 0.
+
+	Returns:
+		The new builder, or NULL if there is no memory. It must be released with <LkBufferBuilderDestroy>.
+
+	Example:
+		--- Code
+		LkBufferBuilder* builder = LkBufferBuilderCreate(0);
+		for(int i=0; i<count; i++)
+		{
+			LkBufferBuilderAppendId(builder, lstRecordIds[i]);
+			LkBufferBuilderAppendRecord(builder, lstRecords[i]);
+			LkBufferBuilderAppendOriginalRecord(builder, lstOriginalRecords[i]);
+		}
+		char* updateBuffer = LkBufferBuilderBuildUpdate(builder);
+		LkBufferBuilderDestroy(builder);
+
+		result = LkUpdate(&error, credentialOptions, filename, updateBuffer, updateOptions, customVars, receiveTimeout);
+		LkFreeMemory(updateBuffer);
+		---
+
+	Also See:
+		<LkBufferBuilderBuildUpdate>
+
+		<LkBufferBuilderDestroy>
+*/
+DllEntry LkBufferBuilder* LkBufferBuilderCreate(uint32_t capacity)
+{
+	LkBufferBuilder* builder = LkCallocFrom(1, sizeof(LkBufferBuilder), __func__);
+	if(builder != NULL && capacity > 0)
 	{
-		if(recordIds != NULL)
+		uint32_t i;
+		for(i = 0; i < 3; i++)
 		{
-			strcpy(deleteBuffer, recordIds);
-			strcat(deleteBuffer, ASCII_FS_str);
+			if(!ReserveBuilderPart(&builder->parts[i], capacity, __func__))
+			{
+				LkBufferBuilderDestroy(builder);
+				return NULL;
+			}
 		}
-		else
-			strcpy(deleteBuffer, ASCII_FS_str);
+	}
+
+	return builder;
+}
+
+/*
+	Function: LkBufferBuilderAppendId
+		Appends the id of a record to a <LkBufferBuilder>.
+
+	Arguments:
+		builder - The builder created by <LkBufferBuilderCreate>.
+		recordId - The id of the record.
+
+	Returns:
+		TRUE if the id was appended, FALSE if there is no memory.
+*/
+DllEntry BOOL LkBufferBuilderAppendId(LkBufferBuilder* builder, const char* const recordId)
+{
+	return AppendBuilderPart(&builder->parts[LkBufferBuilder_IDS], recordId, __func__);
+}
+
+/*
+	Function: LkBufferBuilderAppendRecord
+		Appends a record to a <LkBufferBuilder>. The records must be appended in the same order as their ids.
+
+	Arguments:
+		builder - The builder created by <LkBufferBuilderCreate>.
+		record - The record.
+
+	Returns:
+		TRUE if the record was appended, FALSE if there is no memory.
+*/
+DllEntry BOOL LkBufferBuilderAppendRecord(LkBufferBuilder* builder, const char* const record)
+{
+	return AppendBuilderPart(&builder->parts[LkBufferBuilder_RECORDS], record, __func__);
+}
+
+/*
+	Function: LkBufferBuilderAppendOriginalRecord
+		Appends an original record to a <LkBufferBuilder>, for the Update and Delete Operations with optimistic lock. The original records must be appended in the same order as their ids.
+
+	Arguments:
+		builder - The builder created by <LkBufferBuilderCreate>.
+		originalRecord - The original record.
+
+	Returns:
+		TRUE if the original record was appended, FALSE if there is no memory.
+*/
+DllEntry BOOL LkBufferBuilderAppendOriginalRecord(LkBufferBuilder* builder, const char* const originalRecord)
+{
+	return AppendBuilderPart(&builder->parts[LkBufferBuilder_ORIGINAL_RECORDS], originalRecord, __func__);
+}
+
+/*
+	Function: BuildBuffer
+		Helper function for the LkBufferBuilderBuild functions. The block of "recordIds" becomes the final buffer: the other blocks are copied after it,
+		separated by <ASCII_FS>, and the builder is emptied to be reused.
+
+	Arguments:
+		builder - The builder.
+		parts - The indexes of the blocks that follow the "recordIds".
+		numParts - The number of elements of "parts".
+		entryPoint - Name of the function that requests the memory, for <LkSetMemoryAccounting>.
+
+	Returns:
+		The buffer, or NULL if there is no memory.
+*/
+static char* BuildBuffer(LkBufferBuilder* builder, const uint32_t* const parts, uint32_t numParts, const char* const entryPoint)
+{
+	LkBufferBuilderPart* ids = &builder->parts[LkBufferBuilder_IDS];
+	uint32_t size = numParts + 1;
+	uint32_t i;
+	for(i = 0; i < numParts; i++)
+		size += builder->parts[parts[i]].length;
+
+	if(!ReserveBuilderPart(ids, size, entryPoint))
+		return NULL;
+
+	for(i = 0; i < numParts; i++)
+	{
+		LkBufferBuilderPart* part = &builder->parts[parts[i]];
+		ids->data[ids->length++] = ASCII_FS;
+		if(part->length > 0)
+			memcpy(ids->data + ids->length, part->data, part->length);
+		ids->length += part->length;
+	}
+	ids->data[ids->length] = 0;
+
+	char* buffer = ids->data;
+	memset(ids, 0, sizeof(LkBufferBuilderPart));
+	for(i = 1; i < 3; i++)
+	{
+		builder->parts[i].length = 0;
+		builder->parts[i].count = 0;
+	}
 
-		if(originalRecords != NULL)
-			strcat(deleteBuffer, originalRecords);
+	return buffer;
+}
+
+/*
+	Function: LkBufferBuilderBuildUpdate
+		Builds the buffer of the Update Operations with the "recordIds", "records" and "originalRecords" appended to a <LkBufferBuilder>, like <LkComposeUpdateBuffer> does.
+		After that, the builder is empty and can be used for another buffer.
+
+	Arguments:
+		builder - The builder created by <LkBufferBuilderCreate>.
+
+	Returns:
+		The buffer to be used by Update Operations, or NULL if there is no memory.
+
+	Also See:
+		<Release Memory>
+*/
+DllEntry char* LkBufferBuilderBuildUpdate(LkBufferBuilder* builder)
+{
+	const uint32_t parts[2] = { LkBufferBuilder_RECORDS, LkBufferBuilder_ORIGINAL_RECORDS };
+	return BuildBuffer(builder, parts, 2, __func__);
+}
+
+/*
+	Function: LkBufferBuilderBuildNew
+		Builds the buffer of the New Operations with the "recordIds" and "records" appended to a <LkBufferBuilder>, like <LkComposeNewBuffer> does.
+		After that, the builder is empty and can be used for another buffer.
+
+	Arguments:
+		builder - The builder created by <LkBufferBuilderCreate>.
+
+	Returns:
+		The buffer to be used by New Operations, or NULL if there is no memory.
+
+	Also See:
+		<Release Memory>
+*/
+DllEntry char* LkBufferBuilderBuildNew(LkBufferBuilder* builder)
+{
+	const uint32_t parts[1] = { LkBufferBuilder_RECORDS };
+	return BuildBuffer(builder, parts, 1, __func__);
+}
+
+/*
+	Function: LkBufferBuilderBuildDelete
+		Builds the buffer of the Delete Operations with the "recordIds" and "originalRecords" appended to a <LkBufferBuilder>, like <LkComposeDeleteBuffer> does.
+		After that, the builder is empty and can be used for another buffer.
+
+	Arguments:
+		builder - The builder created by <LkBufferBuilderCreate>.
+
+	Returns:
+		The buffer to be used by Delete Operations, or NULL if there is no memory.
+
+	Also See:
+		<Release Memory>
+*/
+DllEntry char* LkBufferBuilderBuildDelete(LkBufferBuilder* builder)
+{
+	const uint32_t parts[1] = { LkBufferBuilder_ORIGINAL_RECORDS };
+	return BuildBuffer(builder, parts, 1, __func__);
+}
+
+/*
+	Function: LkBufferBuilderDestroy
+		Releases a <LkBufferBuilder>. The buffers already built are not released.
+
+	Arguments:
+		builder - The builder created by <LkBufferBuilderCreate>.
+
+	Also See:
+		<Release Memory>
+*/
+DllEntry void LkBufferBuilderDestroy(LkBufferBuilder* builder)
+{
+	if(builder == NULL)
+		return;
+
+	uint32_t i;
+	for(i = 0; i < 3; i++)
+		LkFree(builder->parts[i].data);
+	LkFree(builder);
+}
+
+/*
+	Function: FindChangedFields
+		Helper function for <LkComposeUpdatePartialBuffer> that compares a record with its original record field by field,
+		and marks the fields that are different. A field that only exists in one of them is compared with an empty field.
+
+	Arguments:
+		record - The modified record.
+		originalRecord - The original record.
+		changed - Array with a flag for every field, that is set to 1 for the different fields. It grows when the records have more fields than "numFields".
+		numFields - Number of elements of "changed". It is updated when the array grows.
+		entryPoint - Name of the function that requests the memory, for <LkSetMemoryAccounting>.
+
+	Returns:
+		TRUE on success, FALSE if there is no memory.
+*/
+static BOOL FindChangedFields(const char* const record, const char* const originalRecord, uint8_t** changed, uint32_t* numFields, const char* const entryPoint)
+{
+	const char* field = record ? record : "";
+	const char* originalField = originalRecord ? originalRecord : "";
+	const char* end = field + strlen(field);
+	const char* originalEnd = originalField + strlen(originalField);
+
+	uint32_t i;
+	for(i = 0; field != NULL || originalField != NULL; i++)
+	{
+		const char* fieldEnd = field ? LkScanFindByte(field, end - field, DBMV_Mark_AM) : NULL;
+		const char* originalFieldEnd = originalField ? LkScanFindByte(originalField, originalEnd - originalField, DBMV_Mark_AM) : NULL;
+		uint32_t length = field ? (fieldEnd ? fieldEnd : end) - field : 0;
+		uint32_t originalLength = originalField ? (originalFieldEnd ? originalFieldEnd : originalEnd) - originalField : 0;
+
+		if(length != originalLength || (length > 0 && memcmp(field, originalField, length) != 0))
+		{
+			if(i >= *numFields)
+			{
+				uint32_t newNumFields = *numFields > 0 ? *numFields : 64;
+				while(newNumFields <= i)
+					newNumFields *= 2;
+				uint8_t* newChanged = LkReallocFrom(*changed, newNumFields, entryPoint);
+				if(newChanged == NULL)
+					return FALSE;
+				memset(newChanged + *numFields, 0, newNumFields - *numFields);
+				*changed = newChanged;
+				*numFields = newNumFields;
+			}
+			(*changed)[i] = 1;
+		}
+
+		field = fieldEnd ? fieldEnd + 1 : NULL;
+		originalField = originalFieldEnd ? originalFieldEnd + 1 : NULL;
+	}
+
+	return TRUE;
+}
+
+/*
+	Function: AppendChangedFields
+		Helper function for <LkComposeUpdatePartialBuffer> that appends to a block of a <LkBufferBuilder> only the changed fields of a record,
+		separated by <DBMV_Mark_AM>, with the <ASCII_RS> separator if it is not the first record of the block.
+
+	Arguments:
+		part - The block.
+		record - The record.
+		changed - Array with a flag for every field, set to 1 for the changed fields.
+		numFields - Number of elements of "changed".
+		entryPoint - Name of the function that requests the memory, for <LkSetMemoryAccounting>.
+
+	Returns:
+		TRUE if the fields were appended, FALSE if there is no memory.
+*/
+static BOOL AppendChangedFields(LkBufferBuilderPart* part, const char* const record, const uint8_t* const changed, uint32_t numFields, const char* const entryPoint)
+{
+	const char* field = record ? record : "";
+	const char* end = field + strlen(field);
+
+	// The fields are never longer than the record, so there is enough room for all of them and their separators
+	if(!ReserveBuilderPart(part, (end - field) + numFields + 1, entryPoint))
+		return FALSE;
+
+	if(part->count > 0)
+		part->data[part->length++] = ASCII_RS;
+	part->count++;
+
+	BOOL first = TRUE;
+	uint32_t i;
+	for(i = 0; i < numFields; i++)
+	{
+		const char* fieldEnd = field ? LkScanFindByte(field, end - field, DBMV_Mark_AM) : NULL;
+		if(changed[i])
+		{
+			if(!first)
+				part->data[part->length++] = DBMV_Mark_AM;
+			first = FALSE;
+			if(field != NULL)
+			{
+				uint32_t length = (fieldEnd ? fieldEnd : end) - field;
+				memcpy(part->data + part->length, field, length);
+				part->length += length;
+			}
+		}
+		field = fieldEnd ? fieldEnd + 1 : NULL;
+	}
+
+	return TRUE;
+}
+
+/*
+	Function: LkComposeUpdatePartialBuffer
+		Compares the records with their original records, and composes the buffer and the list of dictionaries of the UpdatePartial Operations
+		with only the fields that have changed, instead of sending the whole records with the Update Operations.
+		The changed fields of all the records are sent, so a field that has changed in any record is sent for all of them.
+		The original records contain the same fields, so the optimistic lock control checks the fields that are updated.
+
+	Arguments:
+		lstRecordIds - Array with the record ids.
+		lstRecords - Array with the modified records.
+		lstOriginalRecords - Array with the original records, for example the ones returned by <LkExtractOriginalRecords> after a Read Operation.
+		count - Number of elements of the arrays.
+		lstDictionaryNames - Array with the dictionary name of every field: the first element is the name of field 1. If NULL, or the name of a field is NULL or empty, the format LKFLDx is used, where x is the attribute number.
+		numDictionaryNames - Number of elements of "lstDictionaryNames".
+		dictionaries - Output argument with the names of the changed fields, separated by space, to be used as the "dictionaries" argument of <LkGetUpdatePartialArgs>. It is an empty string if no field has changed.
+
+	Returns:
+		The buffer to be used as the "records" argument of <LkGetUpdatePartialArgs>, or NULL if there is no memory.
+
+	Example:
+		--- Code
+		char* dictionaries;
+		char* records = LkComposeUpdatePartialBuffer(lstRecordIds, lstRecords, lstOriginalRecords, count, lstDictionaryNames, numDictionaryNames, &dictionaries);
+		if(records != NULL && *dictionaries != 0)
+		{
+			char* operationArguments = LkGetUpdatePartialArgs("LK.CUSTOMERS", records, dictionaries, NULL, NULL);
+			...
+		}
+		free(records);
+		free(dictionaries);
+		---
+
+	Also See:
+		<LkComposeUpdateBuffer>
+
+		<Release Memory>
+*/
+DllEntry char* LkComposeUpdatePartialBuffer(const char** const lstRecordIds, const char** const lstRecords, const char** const lstOriginalRecords, uint32_t count, const char** const lstDictionaryNames, uint32_t numDictionaryNames, char** dictionaries)
+{
+	*dictionaries = NULL;
+
+	uint8_t* changed = NULL;
+	uint32_t numFields = 0;
+	uint32_t i;
+	for(i = 0; i < count; i++)
+	{
+		if(!FindChangedFields(lstRecords[i], lstOriginalRecords[i], &changed, &numFields, __func__))
+		{
+			LkFree(changed);
+			return NULL;
+		}
+	}
+
+	// The flags after the last changed field are not needed
+	while(numFields > 0 && !changed[numFields - 1])
+		numFields--;
+
+	// The fields without name are sent as "LKFLD" and their number, that has 10 digits at most
+	uint64_t size = 1;
+	for(i = 0; i < numFields; i++)
+	{
+		if(changed[i])
+		{
+			const char* name = i < numDictionaryNames && lstDictionaryNames && lstDictionaryNames[i] ? lstDictionaryNames[i] : "";
+			size += (*name ? strlen(name) : 5 + 10) + 1;
+		}
+	}
+
+	char* names = size < UINT32_MAX ? LkMallocFrom((size_t)size, __func__) : NULL;
+	LkBufferBuilder* builder = LkCallocFrom(1, sizeof(LkBufferBuilder), __func__);
+	char* buffer = NULL;
+	if(names != NULL && builder != NULL)
+	{
+		char* p = names;
+		for(i = 0; i < numFields; i++)
+		{
+			if(changed[i])
+			{
+				const char* name = i < numDictionaryNames && lstDictionaryNames && lstDictionaryNames[i] ? lstDictionaryNames[i] : "";
+				if(p != names)
+					*p++ = ' ';
+				if(*name)
+				{
+					strcpy(p, name);
+					p += strlen(name);
+				}
+				else
+					p += sprintf(p, "LKFLD%u", i + 1);
+			}
+		}
+		*p = 0;
+
+		BOOL ok = TRUE;
+		for(i = 0; i < count && ok; i++)
+		{
+			ok = AppendBuilderPart(&builder->parts[LkBufferBuilder_IDS], lstRecordIds[i], __func__) &&
+				AppendChangedFields(&builder->parts[LkBufferBuilder_RECORDS], lstRecords[i], changed, numFields, __func__) &&
+				AppendChangedFields(&builder->parts[LkBufferBuilder_ORIGINAL_RECORDS], lstOriginalRecords[i], changed, numFields, __func__);
+		}
+		if(ok)
+		{
+			const uint32_t parts[2] = { LkBufferBuilder_RECORDS, LkBufferBuilder_ORIGINAL_RECORDS };
+			buffer = BuildBuffer(builder, parts, 2, __func__);
+		}
 	}
 
-	return deleteBuffer;
+	LkBufferBuilderDestroy(builder);
+	LkFree(changed);
+	if(buffer == NULL)
+		LkFree(names);
+	else
+		*dictionaries = names;
+
+	return buffer;
+}
+
+/*
+	Struct: LkParsedSection
+		Position of a section inside the <LkString> indexed by a <LkParsedResult>.
+		The name of the section is the label that THIS_LIST contains for it.
+*/
+typedef struct
+{
+	uint32_t nameOffset;
+	uint32_t nameLength;
+	uint32_t offset;
+	uint32_t length;
+} LkParsedSection;
+
+struct LkParsedResult
+{
+	const char* lkString;
+	uint32_t length;
+	uint32_t count;
+	LkParsedSection* sections;
+	LkMappedFile* mappedFile;
+};
+
+/*
+	Function: LkParseResult
+		Scans an operation resultant <LkString> once, and keeps the position and length of every section named in THIS_LIST.
+		After that, any section can be obtained with <LkParsedGetSection> without scanning or copying the <LkString> again.
+
+	Arguments:
+		lkString - Text string to be indexed. It is not copied, so it must not be released while the <LkParsedResult> is in use.
+
+	Returns:
+		The index of the sections of the <LkString>, or NULL if "lkString" is NULL. It must be released with <LkFreeParsedResult>.
+
+	Example:
+		--- Code
+		// lkStringResult it's a char * returned by a LkRead function
+
+		LkParsedResult* parsedResult = LkParseResult(lkStringResult);
+		uint32_t numRecords = LkParsedGetTotalRecords(parsedResult);
+		LkStrView recordIds;
+		if(LkParsedGetSection(parsedResult, RECORD_IDS_KEY, &recordIds))
+			printf("%.*s\r\n", recordIds.length, recordIds.str);
+		LkFreeParsedResult(parsedResult);
+		LkFreeMemory(lkStringResult);
+		---
+
+	Also See:
+		<LkString>
+
+		<LkParsedGetSection>
+
+		<LkFreeParsedResult>
+*/
+DllEntry LkParsedResult* LkParseResult(const char* const lkString)
+{
+	if(lkString == NULL)
+		return NULL;
+
+	return LkParseResultLength(lkString, strlen(lkString));
+}
+
+/*
+	Function: LkParseResultLength
+		Like <LkParseResult>, but the length of the <LkString> is given, so it doesn't need to be NUL terminated.
+		It is useful to parse a <LkString> stored in a file mapped with <LkMapFile>, or any other block of memory.
+
+	Arguments:
+		lkString - Text string to be indexed. It is not copied, so it must not be released while the <LkParsedResult> is in use.
+		length - Length of "lkString".
+
+	Returns:
+		The index of the sections of the <LkString>, or NULL if "lkString" is NULL. It must be released with <LkFreeParsedResult>.
+
+	Also See:
+		<LkParseResult>
+
+		<LkParseResultFromFile>
+*/
+DllEntry LkParsedResult* LkParseResultLength(const char* const lkString, uint32_t length)
+{
+	if(lkString == NULL)
+		return NULL;
+
+	const char* end = lkString + length;
+	const char* headerEnd = LkScanFindByte(lkString, length, ASCII_FS);
+	if(headerEnd == NULL)
+		headerEnd = end;
+
+	// Every label of THIS_LIST names one section, THIS_LIST itself included
+	uint32_t count = LkScanCountByte(lkString, headerEnd - lkString, DBMV_Mark_AM) + 1;
+
+	LkParsedResult* parsedResult = LkMallocFrom(sizeof(LkParsedResult) + count * sizeof(LkParsedSection), __func__);
+	if(parsedResult == NULL)
+		return NULL;
+
+	parsedResult->lkString = lkString;
+	parsedResult->length = length;
+	parsedResult->count = count;
+	parsedResult->sections = (LkParsedSection*)(parsedResult + 1);
+	parsedResult->mappedFile = NULL;
+
+	const char* name = lkString;
+	const char* section = lkString;
+	uint32_t i;
+	for(i = 0; i < count; i++)
+	{
+		LkParsedSection* parsedSection = &parsedResult->sections[i];
+
+		const char* nameEnd = LkScanFindByte(name, headerEnd - name, DBMV_Mark_AM);
+		if(nameEnd == NULL)
+			nameEnd = headerEnd;
+		parsedSection->nameOffset = name - lkString;
+		parsedSection->nameLength = nameEnd - name;
+		name = nameEnd + 1;
+
+		if(section <= end)
+		{
+			const char* sectionEnd = LkScanFindByte(section, end - section, ASCII_FS);
+			if(sectionEnd == NULL)
+				sectionEnd = end;
+			parsedSection->offset = section - lkString;
+			parsedSection->length = sectionEnd - section;
+			section = sectionEnd + 1;
+		}
+		else
+		{
+			// THIS_LIST names more sections than the LkString contains
+			parsedSection->offset = length;
+			parsedSection->length = 0;
+		}
+	}
+
+	return parsedResult;
+}
+
+/*
+	Function: LkParseResultFromFile
+		Maps in memory a file with a saved <LkString>, for example the result of a LkRead or LkSelect function, and indexes it like <LkParseResult>.
+		The file is not read into a malloc'd buffer: its pages are loaded by the operating system when the sections are read.
+
+	Arguments:
+		path - Path of the file.
+
+	Returns:
+		The index of the sections of the <LkString>, or NULL if the file can't be mapped. It must be released with <LkFreeParsedResult>, that unmaps the file too.
+
+	Example:
+		--- Code
+		LkParsedResult* parsedResult = LkParseResultFromFile("select.lk");
+		LkRecordIterator iterator;
+		LkStrView recordId, record;
+		LkRecordIteratorInit(&iterator, parsedResult);
+		while(LkRecordIteratorNext(&iterator, &recordId, &record, NULL, NULL))
+		{
+			...
+		}
+		LkFreeParsedResult(parsedResult);
+		---
+
+	Also See:
+		<LkMapFile>
+
+		<LkFreeParsedResult>
+*/
+DllEntry LkParsedResult* LkParseResultFromFile(const char* const path)
+{
+	LkStrView content;
+	LkMappedFile* mappedFile = LkMapFile(path, &content);
+	if(mappedFile == NULL)
+		return NULL;
+
+	LkParsedResult* parsedResult = LkParseResultLength(content.str, content.length);
+	if(parsedResult == NULL)
+		LkUnmapFile(mappedFile);
+	else
+		parsedResult->mappedFile = mappedFile;
+
+	return parsedResult;
+}
+
+/*
+	Function: LkParsedGetSection
+		Gets a section of a <LkString> previously indexed with <LkParseResult>, as a view into the <LkString>.
+
+	Arguments:
+		parsedResult - The index returned by <LkParseResult>.
+		tag - The name of the section, as it appears in THIS_LIST. For example <RECORDS_KEY> or <ERRORS_KEY>.
+		section - Output argument with the position and length of the section inside the <LkString>. It is not NUL terminated.
+
+	Returns:
+		TRUE if THIS_LIST contains the section, FALSE otherwise. When FALSE is returned, "section" is set to an empty view.
+
+	Example:
+		--- Code
+		LkStrView records;
+		if(LkParsedGetSection(parsedResult, RECORDS_KEY, &records))
+		{
+			uint32_t numRecords = LkDCount(..) // or split "records" with ASCII_RS
+		}
+		---
+
+	Also See:
+		<LkParseResult>
+*/
+DllEntry BOOL LkParsedGetSection(const LkParsedResult* const parsedResult, const char* const tag, LkStrView* section)
+{
+	section->str = "";
+	section->length = 0;
+	if(parsedResult == NULL || tag == NULL)
+		return FALSE;
+
+	uint32_t lenTag = strlen(tag);
+	uint32_t i;
+	for(i = 0; i < parsedResult->count; i++)
+	{
+		const LkParsedSection* parsedSection = &parsedResult->sections[i];
+		if(parsedSection->nameLength == lenTag && memcmp(parsedResult->lkString + parsedSection->nameOffset, tag, lenTag) == 0)
+		{
+			section->str = parsedResult->lkString + parsedSection->offset;
+			section->length = parsedSection->length;
+			return TRUE;
+		}
+	}
+
+	return FALSE;
+}
+
+/*
+	Function: LkParsedGetTotalRecords
+		Gets the total number of records from a <LkString> previously indexed with <LkParseResult>.
+
+	Arguments:
+		parsedResult - The index returned by <LkParseResult>.
+
+	Returns:
+		The total number of records from the <LkString>. 0 if there is no TOTAL_RECORDS section.
+
+	Also See:
+		<LkExtractTotalRecords>
+
+		<LkParseResult>
+*/
+DllEntry uint32_t LkParsedGetTotalRecords(const LkParsedResult* const parsedResult)
+{
+	LkStrView block;
+	LkParsedGetSection(parsedResult, TOTAL_RECORDS_KEY, &block);
+
+	uint32_t result = 0;
+	uint32_t i;
+	for(i = 0; i < block.length && block.str[i] >= '0' && block.str[i] <= '9'; i++)
+		result = result * 10 + (block.str[i] - '0');
+
+	return result;
+}
+
+/*
+	Function: LkFreeParsedResult
+		Releases the index created by <LkParseResult>. The indexed <LkString> is not released, except the file mapped by <LkParseResultFromFile>, that is unmapped.
+
+	Arguments:
+		parsedResult - The index returned by <LkParseResult>.
+
+	Also See:
+		<LkParseResult>
+
+		<Release Memory>
+*/
+DllEntry void LkFreeParsedResult(LkParsedResult* parsedResult)
+{
+	if(parsedResult != NULL)
+		LkUnmapFile(parsedResult->mappedFile);
+	LkFree(parsedResult);
+}
+
+/*
+	Function: LkStrSplitSpansInto
+		Splits a string by a delimiter into the array of <LkSpan> provided by the caller. The items are not copied.
+		If the array is too short, only the first "capacity" items are stored, and the function returns the total number of items, so it can be called again with an array of the right size.
+
+	Arguments:
+		str - Text string to be split. It can contain NUL chars, because its length is given by "length".
+		length - Length of "str".
+		delim - Delimiter char, for example <ASCII_RS>, <DBMV_Mark_AM>, <DBMV_Mark_VM> or <DBMV_Mark_SM>.
+		spans - Array where the offset and length of every item inside "str" is stored. It can be NULL if "capacity" is 0.
+		capacity - Number of elements of "spans".
+
+	Returns:
+		The number of items in "str", that is the number of delimiters plus one. An empty string has 0 items.
+
+	Example:
+		--- Code
+		LkSpan spans[64];
+		uint32_t count = LkStrSplitSpansInto(recordIds.str, recordIds.length, ASCII_RS, spans, 64);
+		for(int i=0; i<count && i<64; i++)
+		{
+			printf("%.*s\r\n", spans[i].length, recordIds.str + spans[i].offset);
+		}
+		---
+
+	Also See:
+		<LkStrSplitSpans>
+*/
+DllEntry uint32_t LkStrSplitSpansInto(const char* const str, uint32_t length, const char delim, LkSpan* spans, uint32_t capacity)
+{
+	if(str == NULL || length == 0)
+		return 0;
+
+	const char* end = str + length;
+	const char* item = str;
+	uint32_t count = 0;
+	while(1)
+	{
+		const char* itemEnd = LkScanFindByte(item, end - item, delim);
+		if(itemEnd == NULL)
+			itemEnd = end;
+
+		if(count < capacity)
+		{
+			spans[count].offset = item - str;
+			spans[count].length = itemEnd - item;
+		}
+		count++;
+
+		if(itemEnd == end)
+			break;
+		item = itemEnd + 1;
+	}
+
+	return count;
+}
+
+/*
+	Function: LkStrSplitSpans
+		Splits a string by a delimiter, like LkStrSplit, but without copying the items.
+		Only one array of <LkSpan> is allocated for all the items, instead of one string for each item.
+
+	Arguments:
+		str - Text string to be split. It can contain NUL chars, because its length is given by "length".
+		length - Length of "str".
+		delim - Delimiter char, for example <ASCII_RS>, <DBMV_Mark_AM>, <DBMV_Mark_VM> or <DBMV_Mark_SM>.
+		count - Output argument with the number of items, that is the number of elements of the array.
+
+	Returns:
+		Array with the offset and length of every item inside "str", or NULL if "str" is empty. It must be released with <LkFreeSpans>.
+
+	Example:
+		--- Code
+		LkStrView recordIds;
+		LkParsedGetSection(parsedResult, RECORD_IDS_KEY, &recordIds);
+
+		uint32_t count;
+		LkSpan* spans = LkStrSplitSpans(recordIds.str, recordIds.length, ASCII_RS, &count);
+		for(int i=0; i<count; i++)
+		{
+			printf("%.*s\r\n", spans[i].length, recordIds.str + spans[i].offset);
+		}
+		LkFreeSpans(spans);
+		---
+
+	Also See:
+		<LkStrSplitSpansInto>
+
+		<LkFreeSpans>
+*/
+DllEntry LkSpan* LkStrSplitSpans(const char* const str, uint32_t length, const char delim, uint32_t* count)
+{
+	*count = LkStrSplitSpansInto(str, length, delim, NULL, 0);
+	if(*count == 0)
+		return NULL;
+
+	LkSpan* spans = LkMallocFrom(*count * sizeof(LkSpan), __func__);
+	if(spans == NULL)
+	{
+		*count = 0;
+		return NULL;
+	}
+
+	LkStrSplitSpansInto(str, length, delim, spans, *count);
+	return spans;
+}
+
+/*
+	Function: GetNumChunks
+		Helper function for the *Parallel functions that decides in how many pieces a string is processed.
+
+	Arguments:
+		config - The options of the parallel function. It can be NULL.
+		length - Length of the string.
+
+	Returns:
+		The number of pieces: 1 if there is no thread pool or the string is smaller than two pieces, and never more than 4 pieces for every thread,
+		so the threads that finish early can take the pieces of the slower ones.
+*/
+static uint32_t GetNumChunks(const LkParallelConfig* const config, uint64_t length)
+{
+	if(config == NULL || config->pool == NULL)
+		return 1;
+
+	uint32_t minChunkSize = config->minChunkSize > 0 ? config->minChunkSize : LkParallelConfig_DEFAULT_CHUNK_SIZE;
+	uint64_t numChunks = length / minChunkSize;
+	uint64_t maxChunks = (uint64_t)(LkThreadPoolGetNumThreads(config->pool) + 1) * 4;
+	if(numChunks > maxChunks)
+		numChunks = maxChunks;
+
+	return numChunks > 1 ? (uint32_t)numChunks : 1;
+}
+
+/*
+	Struct: SplitContext
+		State shared by the tasks of <LkStrSplitSpansParallel>.
+*/
+typedef struct
+{
+	const char* str;
+	uint32_t length;
+	char delim;
+	uint32_t numChunks;
+	uint32_t* firstItems;
+	LkSpan* spans;
+	uint32_t count;
+} SplitContext;
+
+#define SplitChunkStart(context, chunk) ((uint32_t)((uint64_t)(context)->length * (chunk) / (context)->numChunks))
+
+static void SplitCountTask(void* argument, uint32_t chunk)
+{
+	SplitContext* context = argument;
+	uint32_t start = SplitChunkStart(context, chunk);
+	uint32_t end = SplitChunkStart(context, chunk + 1);
+	context->firstItems[chunk] = LkScanCountByte(context->str + start, end - start, context->delim);
+}
+
+// Every delimiter starts a new item, so only the offsets are stored here. The lengths need the offset of the next item, which can be in another chunk.
+static void SplitOffsetsTask(void* argument, uint32_t chunk)
+{
+	SplitContext* context = argument;
+	const char* end = context->str + SplitChunkStart(context, chunk + 1);
+	const char* delim = context->str + SplitChunkStart(context, chunk);
+	uint32_t item = context->firstItems[chunk];
+	while((delim = LkScanFindByte(delim, end - delim, context->delim)) != NULL)
+	{
+		delim++;
+		context->spans[++item].offset = delim - context->str;
+	}
+}
+
+static void SplitLengthsTask(void* argument, uint32_t chunk)
+{
+	SplitContext* context = argument;
+	uint32_t first = (uint32_t)((uint64_t)context->count * chunk / context->numChunks);
+	uint32_t last = (uint32_t)((uint64_t)context->count * (chunk + 1) / context->numChunks);
+	uint32_t i;
+	for(i = first; i < last; i++)
+	{
+		uint32_t itemEnd = i + 1 < context->count ? context->spans[i + 1].offset - 1 : context->length;
+		context->spans[i].length = itemEnd - context->spans[i].offset;
+	}
+}
+
+/*
+	Function: LkStrSplitSpansParallel
+		Splits a very big string by a delimiter, like <LkStrSplitSpans>, using the threads of a <LkThreadPool>.
+		The string is divided into pieces of at least "minChunkSize" bytes of the <LkParallelConfig>, and the delimiters of every piece are searched by a different thread.
+		It is useful to index the records of the results of hundreds of MB, like the ones of LkSelect or LkGetTable over whole files.
+
+	Arguments:
+		str - Text string to be split. It can contain NUL chars, because its length is given by "length".
+		length - Length of "str".
+		delim - Delimiter char, for example <ASCII_RS>, <DBMV_Mark_AM>, <DBMV_Mark_VM> or <DBMV_Mark_SM>.
+		config - The thread pool and the minimum size of every piece. If NULL, or if the string is small, it works like <LkStrSplitSpans>.
+		count - Output argument with the number of items, that is the number of elements of the array.
+
+	Returns:
+		Array with the offset and length of every item inside "str", or NULL if "str" is empty. It must be released with <LkFreeSpans>.
+
+	Example:
+		--- Code
+		// lkStringResult it's a char * returned by a LkSelect function
+		LkParallelConfig config = { LkThreadPoolCreate(0), 0 };
+
+		LkStrView records;
+		LkParsedResult* parsedResult = LkParseResult(lkStringResult);
+		LkParsedGetSection(parsedResult, RECORDS_KEY, &records);
+
+		uint32_t count;
+		LkSpan* spans = LkStrSplitSpansParallel(records.str, records.length, ASCII_RS, &config, &count);
+		...
+		LkFreeSpans(spans);
+		LkFreeParsedResult(parsedResult);
+		LkThreadPoolDestroy(config.pool);
+		---
+
+	Also See:
+		<LkStrSplitSpans>
+
+		<LkThreadPoolCreate>
+*/
+DllEntry LkSpan* LkStrSplitSpansParallel(const char* const str, uint32_t length, const char delim, const LkParallelConfig* const config, uint32_t* count)
+{
+	SplitContext context;
+	context.numChunks = GetNumChunks(config, length);
+	if(context.numChunks == 1 || str == NULL)
+		return LkStrSplitSpans(str, length, delim, count);
+
+	*count = 0;
+	context.str = str;
+	context.length = length;
+	context.delim = delim;
+	context.firstItems = LkMallocFrom(context.numChunks * sizeof(uint32_t), __func__);
+	if(context.firstItems == NULL)
+		return NULL;
+
+	LkThreadPoolRun(config->pool, context.numChunks, SplitCountTask, &context);
+
+	// The number of delimiters of every chunk becomes the index of the first item that starts in it
+	uint32_t i;
+	context.count = 1;
+	for(i = 0; i < context.numChunks; i++)
+	{
+		uint32_t numDelims = context.firstItems[i];
+		context.firstItems[i] = context.count - 1;
+		context.count += numDelims;
+	}
+
+	context.spans = LkMallocFrom(context.count * sizeof(LkSpan), __func__);
+	if(context.spans != NULL)
+	{
+		context.spans[0].offset = 0;
+		LkThreadPoolRun(config->pool, context.numChunks, SplitOffsetsTask, &context);
+		LkThreadPoolRun(config->pool, context.numChunks, SplitLengthsTask, &context);
+		*count = context.count;
+	}
+
+	LkFree(context.firstItems);
+	return context.spans;
+}
+
+/*
+	Function: LkFreeSpans
+		Releases the array returned by <LkStrSplitSpans> or <LkStrSplitSpansParallel>.
+
+	Arguments:
+		spans - The array returned by <LkStrSplitSpans> or <LkStrSplitSpansParallel>.
+
+	Also See:
+		<Release Memory>
+*/
+DllEntry void LkFreeSpans(LkSpan* spans)
+{
+	LkFree(spans);
+}
+
+/*
+	Function: LkRecordIteratorInit
+		Starts a walk through the records of an MV <LkString> previously indexed with <LkParseResult>.
+		The records are obtained one by one with <LkRecordIteratorNext>, without creating arrays with all of them like <LkExtractRecordIds> and <LkExtractRecords> do.
+
+	Arguments:
+		iterator - The iterator to be initialized.
+		parsedResult - The index returned by <LkParseResult>. It must not be released while the iterator is in use.
+
+	Example:
+		--- Code
+		// lkStringResult it's a char * returned by a LkRead function
+
+		LkParsedResult* parsedResult = LkParseResult(lkStringResult);
+		LkRecordIterator iterator;
+		LkStrView recordId, record;
+		LkRecordIteratorInit(&iterator, parsedResult);
+		while(LkRecordIteratorNext(&iterator, &recordId, &record, NULL, NULL))
+		{
+			printf("%.*s: %.*s\r\n", recordId.length, recordId.str, record.length, record.str);
+		}
+		LkFreeParsedResult(parsedResult);
+		LkFreeMemory(lkStringResult);
+		---
+
+	Also See:
+		<LkRecordIteratorNext>
+
+		<LkParseResult>
+*/
+DllEntry void LkRecordIteratorInit(LkRecordIterator* iterator, const LkParsedResult* const parsedResult)
+{
+	const char* tags[4] = { RECORD_IDS_KEY, RECORDS_KEY, CALCULATED_KEY, ORIGINAL_RECORDS_KEY };
+	uint32_t i;
+	for(i = 0; i < 4; i++)
+	{
+		// Like the LkExtract functions, an empty section has no items
+		LkParsedGetSection(parsedResult, tags[i], &iterator->sections[i]);
+		iterator->positions[i] = iterator->sections[i].length > 0 ? 0 : UINT32_MAX;
+		iterator->items[i] = 0;
+	}
+	iterator->index = 0;
+}
+
+/*
+	Function: NextIteratorItem
+		Helper function for <LkRecordIteratorNext> that gets the next item of a section and moves its position after it.
+
+	Arguments:
+		iterator - The iterator.
+		section - The number of the section, from 0 to 3.
+		item - Output argument with the item. It can be NULL when the item is skipped.
+*/
+static void NextIteratorItem(LkRecordIterator* iterator, uint32_t section, LkStrView* item)
+{
+	const char* str = iterator->sections[section].str;
+	const char* start = str + iterator->positions[section];
+	const char* end = str + iterator->sections[section].length;
+	const char* itemEnd = LkScanFindByte(start, end - start, ASCII_RS);
+	if(itemEnd == NULL)
+	{
+		itemEnd = end;
+		iterator->positions[section] = UINT32_MAX;
+	}
+	else
+		iterator->positions[section] = itemEnd + 1 - str;
+	iterator->items[section]++;
+
+	if(item != NULL)
+	{
+		item->str = start;
+		item->length = itemEnd - start;
+	}
+}
+
+/*
+	Function: HasIteratorItem
+		Helper function for <LkRecordIteratorNext> that checks if a section has an item for the current record.
+		The items of the records skipped while the section was not requested are scanned now.
+
+	Arguments:
+		iterator - The iterator.
+		section - The number of the section, from 0 to 3.
+
+	Returns:
+		TRUE if the section has an item at the position of "index", FALSE if it has fewer items.
+*/
+static BOOL HasIteratorItem(LkRecordIterator* iterator, uint32_t section)
+{
+	while(iterator->items[section] < iterator->index && iterator->positions[section] != UINT32_MAX)
+		NextIteratorItem(iterator, section, NULL);
+
+	return iterator->positions[section] != UINT32_MAX;
+}
+
+/*
+	Function: LkRecordIteratorNext
+		Gets the next record of the walk started by <LkRecordIteratorInit>.
+		The record code, the record, the calculated values and the original record are returned as views into the <LkString>, without copying them.
+
+	Arguments:
+		iterator - The iterator initialized by <LkRecordIteratorInit>.
+		recordId - Output argument with the code of the record. It can be NULL if it is not needed.
+		record - Output argument with the record. It can be NULL if it is not needed.
+		calculated - Output argument with the calculated values of the record. It can be NULL if it is not needed.
+		originalRecord - Output argument with the original record. It can be NULL if it is not needed.
+
+	Returns:
+		TRUE if a record was returned, FALSE if there are no more records.
+		When a section has fewer items than the others, an empty view is returned for it.
+
+	Remarks:
+		Only the sections whose output argument is not NULL are scanned. RECORD_ID or RECORD are also scanned to know where the walk ends when none of them is requested, or when the requested one has no more items.
+		A section that is requested after some calls without it scans the skipped items once, so its items are still the ones of the current record.
+
+	Also See:
+		<LkRecordIteratorInit>
+*/
+DllEntry BOOL LkRecordIteratorNext(LkRecordIterator* iterator, LkStrView* recordId, LkStrView* record, LkStrView* calculated, LkStrView* originalRecord)
+{
+	// The walk ends when there are no more codes and no more records. The requested sections are checked first, because they are scanned anyway
+	if(!(recordId != NULL && HasIteratorItem(iterator, 0)) && !(record != NULL && HasIteratorItem(iterator, 1)) &&
+		!HasIteratorItem(iterator, 0) && !HasIteratorItem(iterator, 1))
+		return FALSE;
+
+	LkStrView* items[4] = { recordId, record, calculated, originalRecord };
+	uint32_t i;
+	for(i = 0; i < 4; i++)
+	{
+		if(items[i] == NULL)
+			continue;
+
+		if(HasIteratorItem(iterator, i))
+			NextIteratorItem(iterator, i, items[i]);
+		else
+		{
+			items[i]->str = "";
+			items[i]->length = 0;
+		}
+	}
+
+	iterator->index++;
+	return TRUE;
+}
+
+/*
+	Function: FindSection
+		Helper function for the *Arena functions that finds a section of a <LkString> without allocating memory.
+
+	Arguments:
+		lkString - Text string on which you are going to search.
+		tag - The name of the section, as it appears in THIS_LIST.
+		section - Output argument with the position and length of the section inside "lkString".
+
+	Returns:
+		TRUE if THIS_LIST contains the section, FALSE otherwise.
+*/
+static BOOL FindSection(const char* const lkString, const char* const tag, LkStrView* section)
+{
+	section->str = "";
+	section->length = 0;
+	if(lkString == NULL)
+		return FALSE;
+
+	uint32_t length = strlen(lkString);
+	uint32_t lenTag = strlen(tag);
+	const char* end = lkString + length;
+	const char* headerEnd = LkScanFindByte(lkString, length, ASCII_FS);
+	if(headerEnd == NULL)
+		headerEnd = end;
+
+	// Position of the tag inside THIS_LIST, that is the number of the section
+	const char* name = lkString;
+	uint32_t index = 0;
+	while(1)
+	{
+		const char* nameEnd = LkScanFindByte(name, headerEnd - name, DBMV_Mark_AM);
+		if(nameEnd == NULL)
+			nameEnd = headerEnd;
+		if(nameEnd - name == lenTag && memcmp(name, tag, lenTag) == 0)
+			break;
+		if(nameEnd == headerEnd)
+			return FALSE;
+		name = nameEnd + 1;
+		index++;
+	}
+
+	const char* data = lkString;
+	for(; index > 0; index--)
+	{
+		data = LkScanFindByte(data, end - data, ASCII_FS);
+		if(data == NULL)
+			return TRUE;
+		data++;
+	}
+
+	const char* dataEnd = LkScanFindByte(data, end - data, ASCII_FS);
+	section->str = data;
+	section->length = (dataEnd ? dataEnd : end) - data;
+	return TRUE;
+}
+
+/*
+	Function: ExtractListArena
+		Helper function for the LkExtract*Arena functions, that extracts a section of a <LkString> and splits it into an arena.
+		The pointer array and all the strings are allocated in only one piece of the arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		lkString - Text string on which you are going to extract.
+		tag - The name of the section.
+		delim - The delimiter of the items of the section.
+		emptyIsNone - If TRUE, an empty section returns NULL and count 0, like most of the LkExtract functions do.
+		count - Output argument with the number of strings.
+
+	Returns:
+		Pointer array of strings allocated in the arena, or NULL.
+*/
+static char** ExtractListArena(LkArena* arena, const char* const lkString, const char* const tag, char delim, BOOL emptyIsNone, uint32_t* count)
+{
+	*count = 0;
+	LkStrView section;
+	if(!FindSection(lkString, tag, &section) || (emptyIsNone && section.length == 0))
+		return NULL;
+
+	uint32_t numItems = LkScanCountByte(section.str, section.length, delim) + 1;
+	char** data = LkArenaAlloc(arena, numItems * sizeof(char*) + section.length + 1);
+	if(data == NULL)
+		return NULL;
+
+	// The section is copied only once, and every delimiter is changed by the NUL terminator of an item
+	char* items = (char*)(data + numItems);
+	memcpy(items, section.str, section.length);
+	items[section.length] = 0;
+
+	char* item = items;
+	char* end = items + section.length;
+	uint32_t i;
+	for(i = 0; i < numItems; i++)
+	{
+		data[i] = item;
+		char* itemEnd = (char*)LkScanFindByte(item, end - item, delim);
+		if(itemEnd == NULL)
+			break;
+		*itemEnd = 0;
+		item = itemEnd + 1;
+	}
+
+	*count = numItems;
+	return data;
+}
+
+/*
+	Function: ExtractBlockArena
+		Helper function for the LkExtract*Arena functions, that copies a section of a <LkString> into an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		lkString - Text string on which you are going to extract.
+		tag - The name of the section.
+
+	Returns:
+		The section allocated in the arena, or NULL if THIS_LIST doesn't contain it.
+*/
+static char* ExtractBlockArena(LkArena* arena, const char* const lkString, const char* const tag)
+{
+	LkStrView section;
+	if(FindSection(lkString, tag, &section))
+		return LkArenaCopy(arena, section.str, section.length);
+	else
+		return NULL;
+}
+
+/*
+	Function: LkExtractRecordIdsArena
+		Like <LkExtractRecordIds>, but the pointer array and the strings are allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		lkString - Text string on which you are going to extract.
+		count - Output argument that inform about the size of the pointer array, that mean, how many strings contains.
+
+	Returns:
+		Pointer array of string with the codes from the <LkString>. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char** LkExtractRecordIdsArena(LkArena* arena, const char* const lkString, uint32_t* count)
+{
+	return ExtractListArena(arena, lkString, RECORD_IDS_KEY, ASCII_RS, TRUE, count);
+}
+
+/*
+	Function: LkExtractRecordsArena
+		Like <LkExtractRecords>, but the pointer array and the strings are allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		lkString - Text string on which you are going to extract.
+		count - Output argument that inform about the size of the pointer array, that mean, how many strings contains.
+
+	Returns:
+		Pointer array of string with the records from the <LkString>. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char** LkExtractRecordsArena(LkArena* arena, const char* const lkString, uint32_t* count)
+{
+	return ExtractListArena(arena, lkString, RECORDS_KEY, ASCII_RS, TRUE, count);
+}
+
+/*
+	Function: LkExtractErrorsArena
+		Like <LkExtractErrors>, but the pointer array and the strings are allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		lkString - Text string on which you are going to extract.
+		count - Output argument that inform about the size of the pointer array, that mean, how many strings contains.
+
+	Returns:
+		Pointer array of string with the errors from the <LkString>. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char** LkExtractErrorsArena(LkArena* arena, const char* const lkString, uint32_t* count)
+{
+	return ExtractListArena(arena, lkString, ERRORS_KEY, DBMV_Mark_AM, TRUE, count);
+}
+
+/*
+	Function: LkExtractRecordsCalculatedArena
+		Like <LkExtractRecordsCalculated>, but the pointer array and the strings are allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		lkString - Text string on which you are going to extract.
+		count - Output argument that inform about the size of the pointer array, that mean, how many strings contains.
+
+	Returns:
+		Pointer array of string with the calculated values from the <LkString>. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char** LkExtractRecordsCalculatedArena(LkArena* arena, const char* const lkString, uint32_t* count)
+{
+	return ExtractListArena(arena, lkString, CALCULATED_KEY, DBMV_Mark_AM, TRUE, count);
+}
+
+/*
+	Function: LkExtractRecordsDictsArena
+		Like <LkExtractRecordsDicts>, but the pointer array and the strings are allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		lkString - Text string on which you are going to extract.
+		count - Output argument that inform about the size of the pointer array, that mean, how many strings contains.
+
+	Returns:
+		Pointer array of string with the dictionaries of the records from the <LkString>. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char** LkExtractRecordsDictsArena(LkArena* arena, const char* const lkString, uint32_t* count)
+{
+	return ExtractListArena(arena, lkString, RECORD_DICTS_KEY, DBMV_Mark_AM, TRUE, count);
+}
+
+/*
+	Function: LkExtractRecordsCalculatedDictsArena
+		Like <LkExtractRecordsCalculatedDicts>, but the pointer array and the strings are allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		lkString - Text string on which you are going to extract.
+		count - Output argument that inform about the size of the pointer array, that mean, how many strings contains.
+
+	Returns:
+		Pointer array of string with the dictionaries of the calculated values from the <LkString>. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char** LkExtractRecordsCalculatedDictsArena(LkArena* arena, const char* const lkString, uint32_t* count)
+{
+	return ExtractListArena(arena, lkString, CALCULATED_DICTS_KEY, DBMV_Mark_AM, TRUE, count);
+}
+
+/*
+	Function: LkExtractRecordsIdDictsArena
+		Like <LkExtractRecordsIdDicts>, but the pointer array and the strings are allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		lkString - Text string on which you are going to extract.
+		count - Output argument that inform about the size of the pointer array, that mean, how many strings contains.
+
+	Returns:
+		Pointer array of string with the dictionaries of the codes from the <LkString>. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char** LkExtractRecordsIdDictsArena(LkArena* arena, const char* const lkString, uint32_t* count)
+{
+	return ExtractListArena(arena, lkString, RECORD_ID_DICTS_KEY, DBMV_Mark_AM, TRUE, count);
+}
+
+/*
+	Function: LkExtractOriginalRecordsArena
+		Like <LkExtractOriginalRecords>, but the pointer array and the strings are allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		lkString - Text string on which you are going to extract.
+		count - Output argument that inform about the size of the pointer array, that mean, how many strings contains.
+
+	Returns:
+		Pointer array of string with the original records from the <LkString>. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char** LkExtractOriginalRecordsArena(LkArena* arena, const char* const lkString, uint32_t* count)
+{
+	return ExtractListArena(arena, lkString, ORIGINAL_RECORDS_KEY, ASCII_RS, TRUE, count);
+}
+
+/*
+	Function: LkExtractDictionariesArena
+		Like <LkExtractDictionaries>, but the pointer array and the strings are allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		lkString - Text string on which you are going to extract.
+		count - Output argument that inform about the size of the pointer array, that mean, how many strings contains.
+
+	Returns:
+		Pointer array of string with the file dictionaries of the <LkString>. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char** LkExtractDictionariesArena(LkArena* arena, const char* const lkString, uint32_t* count)
+{
+	return ExtractListArena(arena, lkString, RECORDS_KEY, ASCII_RS, TRUE, count);
+}
+
+/*
+	Function: LkExtractConversionArena
+		Like <LkExtractConversion>, but the string is allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		lkString - Text string on which you are going to extract.
+
+	Returns:
+		String CONVERSION value of the <LkString>. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char* LkExtractConversionArena(LkArena* arena, const char* const lkString)
+{
+	return ExtractBlockArena(arena, lkString, CONVERSION_KEY);
+}
+
+/*
+	Function: LkExtractFormatArena
+		Like <LkExtractFormat>, but the string is allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		lkString - Text string on which you are going to extract.
+
+	Returns:
+		String FORMAT value of the <LkString>. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char* LkExtractFormatArena(LkArena* arena, const char* const lkString)
+{
+	return ExtractBlockArena(arena, lkString, FORMAT_KEY);
+}
+
+/*
+	Function: LkExtractCapturingArena
+		Like <LkExtractCapturing>, but the string is allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		lkString - Text string on which you are going to extract.
+
+	Returns:
+		String CAPTURING value of the <LkString>. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char* LkExtractCapturingArena(LkArena* arena, const char* const lkString)
+{
+	return ExtractBlockArena(arena, lkString, CAPTURING_KEY);
+}
+
+/*
+	Function: LkExtractReturningArena
+		Like <LkExtractReturning>, but the string is allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		lkString - Text string on which you are going to extract.
+
+	Returns:
+		String RETURNING value of the <LkString>. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char* LkExtractReturningArena(LkArena* arena, const char* const lkString)
+{
+	return ExtractBlockArena(arena, lkString, RETURNING_KEY);
+}
+
+/*
+	Function: LkExtractSubroutineArgsArena
+		Like <LkExtractSubroutineArgs>, but the pointer array and the strings are allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		lkString - Text string on which you are going to extract.
+		count - Output argument that inform about the size of the pointer array, that mean, how many strings contains.
+
+	Returns:
+		Pointer array of string with the arguments of the subroutine. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char** LkExtractSubroutineArgsArena(LkArena* arena, const char* const lkString, uint32_t* count)
+{
+	return ExtractListArena(arena, lkString, ARGUMENTS_KEY, ASCII_DC4, FALSE, count);
+}
+
+/*
+	Function: LkExtractRowPropertiesArena
+		Like <LkExtractRowProperties>, but the pointer array and the strings are allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		lkString - Text string on which you are going to extract.
+		count - Output argument that inform about the size of the pointer array, that mean, how many strings contains.
+
+	Returns:
+		Pointer array of string with the ROWPROPERTIES value of the <LkString>. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char** LkExtractRowPropertiesArena(LkArena* arena, const char* const lkString, uint32_t* count)
+{
+	return ExtractListArena(arena, lkString, ROWPROPERTIES_KEY, DBMV_Mark_AM, FALSE, count);
+}
+
+/*
+	Function: LkExtractRowHeadersArena
+		Like <LkExtractRowHeaders>, but the pointer array and the strings are allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		lkString - Text string on which you are going to extract.
+		count - Output argument that inform about the size of the pointer array, that mean, how many strings contains.
+
+	Returns:
+		Pointer array of string with the ROWHEADERS value of the <LkString>. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char** LkExtractRowHeadersArena(LkArena* arena, const char* const lkString, uint32_t* count)
+{
+	return ExtractListArena(arena, lkString, ROWHEADERS_KEY, DBMV_Mark_AM, FALSE, count);
+}
+
+/*
+	Function: LkComposeRecordIdsArena
+		Like <LkComposeRecordIds>, but the string is allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		lstRecordIds - Array (pointer to array of char pointers) with the "recordIds" to be joined.
+		count - The array size.
+
+	Returns:
+		The final string of "recordIds" to be used in CRUD Operations. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char* LkComposeRecordIdsArena(LkArena* arena, const char** const lstRecordIds, uint32_t count)
+{
+	return JoinStrings(arena, lstRecordIds, count, ASCII_RS_str, __func__);
+}
+
+/*
+	Function: LkComposeRecordsArena
+		Like <LkComposeRecords>, but the string is allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		lstRecords - Array (pointer to array of char pointers) with the "records" to be joined.
+		count - The array size.
+
+	Returns:
+		The final string of "records" to be used in CRUD Operations. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char* LkComposeRecordsArena(LkArena* arena, const char** const lstRecords, uint32_t count)
+{
+	return JoinStrings(arena, lstRecords, count, ASCII_RS_str, __func__);
+}
+
+/*
+	Function: LkComposeOriginalRecordsArena
+		Like <LkComposeOriginalRecords>, but the string is allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		lstOriginalRecords - Array (pointer to array of char pointers) with the "originalRecords" to be joined.
+		count - The array size.
+
+	Returns:
+		The final string of "originalRecords" to be used in CRUD Operations. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char* LkComposeOriginalRecordsArena(LkArena* arena, const char** const lstOriginalRecords, uint32_t count)
+{
+	return JoinStrings(arena, lstOriginalRecords, count, ASCII_RS_str, __func__);
+}
+
+/*
+	Function: LkComposeDictionariesArena
+		Like <LkComposeDictionaries>, but the string is allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		lstDictionaries - Array (pointer to array of char pointers) with the dictionaries to be joined.
+		count - The array size.
+
+	Returns:
+		The final string of dictionaries. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char* LkComposeDictionariesArena(LkArena* arena, const char** const lstDictionaries, uint32_t count)
+{
+	return JoinStrings(arena, lstDictionaries, count, " ", __func__);
+}
+
+/*
+	Function: LkComposeExpressionsArena
+		Like <LkComposeExpressions>, but the string is allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		lstExpressions - Array (pointer to array of char pointers) with the expressions to be joined.
+		count - The array size.
+
+	Returns:
+		The final string of expressions. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char* LkComposeExpressionsArena(LkArena* arena, const char** const lstExpressions, uint32_t count)
+{
+	return JoinStrings(arena, lstExpressions, count, DBMV_Mark_AM_str, __func__);
+}
+
+/*
+	Function: LkComposeSubroutineArgsArena
+		Like <LkComposeSubroutineArgs>, but the string is allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		lstArgs - Array (pointer to array of char pointers) with the arguments to be joined.
+		count - The array size.
+
+	Returns:
+		The final string of arguments for the LkSubroutine functions. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char* LkComposeSubroutineArgsArena(LkArena* arena, const char** const lstArgs, uint32_t count)
+{
+	return JoinStrings(arena, lstArgs, count, ASCII_DC4_str, __func__);
+}
+
+/*
+	Function: LkComposeUpdateBufferArena
+		Like <LkComposeUpdateBuffer>, but the string is allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		recordIds - The "recordIds" composed by <LkComposeRecordIds>.
+		records - The "records" composed by <LkComposeRecords>.
+		originalRecords - The "originalRecords" composed by <LkComposeOriginalRecords>. It can be NULL.
+
+	Returns:
+		The buffer for the LkUpdate functions. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char* LkComposeUpdateBufferArena(LkArena* arena, const char* const recordIds, const char* const records, const char* const originalRecords)
+{
+	const char* parts[3] = { recordIds, records, originalRecords };
+	return JoinStrings(arena, parts, 3, ASCII_FS_str, __func__);
+}
+
+/*
+	Function: LkComposeNewBufferArena
+		Like <LkComposeNewBuffer>, but the string is allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		recordIds - The "recordIds" composed by <LkComposeRecordIds>.
+		records - The "records" composed by <LkComposeRecords>.
+
+	Returns:
+		The buffer for the LkNew functions. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char* LkComposeNewBufferArena(LkArena* arena, const char* const recordIds, const char* const records)
+{
+	const char* parts[2] = { recordIds, records };
+	return JoinStrings(arena, parts, 2, ASCII_FS_str, __func__);
+}
+
+/*
+	Function: LkComposeDeleteBufferArena
+		Like <LkComposeDeleteBuffer>, but the string is allocated in an arena.
+
+	Arguments:
+		arena - The arena created by <LkArenaCreate>.
+		recordIds - The "recordIds" composed by <LkComposeRecordIds>.
+		originalRecords - The "originalRecords" composed by <LkComposeOriginalRecords>. It can be NULL.
+
+	Returns:
+		The buffer for the LkDelete functions. It is released by <LkArenaReset> or <LkArenaDestroy>.
+*/
+DllEntry char* LkComposeDeleteBufferArena(LkArena* arena, const char* const recordIds, const char* const originalRecords)
+{
+	const char* parts[2] = { recordIds, originalRecords };
+	return JoinStrings(arena, parts, 2, ASCII_FS_str, __func__);
+}
+
+/*
+	Function: FindValue
+		Helper function for <LkExtractColumns> that narrows a field of a record to one of its values.
+
+	Arguments:
+		str - The record.
+		span - The position and length of the field inside "str". On return, the position and length of the value, or an empty span if it doesn't exist.
+		value - The 1-based position of the value.
+*/
+static void FindValue(const char* const str, LkSpan* span, uint32_t value)
+{
+	const char* item = str + span->offset;
+	const char* end = item + span->length;
+	uint32_t i;
+	for(i = 1; i < value; i++)
+	{
+		item = LkScanFindByte(item, end - item, DBMV_Mark_VM);
+		if(item == NULL)
+		{
+			span->length = 0;
+			return;
+		}
+		item++;
+	}
+
+	const char* itemEnd = LkScanFindByte(item, end - item, DBMV_Mark_VM);
+	span->offset = item - str;
+	span->length = (itemEnd ? itemEnd : end) - item;
+}
+
+/*
+	Struct: ColumnsContext
+		State shared by the tasks of <ExtractColumnsFromSection>. The records are divided in chunks of consecutive records, and every task works on one chunk.
+*/
+typedef struct
+{
+	LkStrView records;
+	const uint32_t* attributes;
+	uint32_t numAttributes;
+	uint32_t value;
+	uint32_t maxAttribute;
+	const int32_t* firstColumn;
+	const int32_t* nextColumn;
+	const LkSpan* recordSpans;
+	uint32_t numRecords;
+	uint32_t numChunks;
+	LkSpan* cells;
+	uint32_t* chunkSizes;
+	LkColumns* result;
+} ColumnsContext;
+
+// The biggest attribute number accepted, because the columns that take every attribute number are indexed in a table
+#define LkColumns_MAX_ATTRIBUTE 1048576
+
+#define ColumnsChunkStart(context, chunk) ((uint32_t)((uint64_t)(context)->numRecords * (chunk) / (context)->numChunks))
+
+// First phase: the position of every cell, and the size of every column inside the chunk
+static void LocateCellsTask(void* argument, uint32_t chunk)
+{
+	ColumnsContext* context = argument;
+	const char* str = context->records.str;
+	uint32_t numAttributes = context->numAttributes;
+	uint32_t* sizes = context->chunkSizes + (uint64_t)chunk * numAttributes;
+	uint32_t last = ColumnsChunkStart(context, chunk + 1);
+	uint32_t i, j;
+	for(i = ColumnsChunkStart(context, chunk); i < last; i++)
+	{
+		const char* record = str + context->recordSpans[i].offset;
+		const char* recordEnd = record + context->recordSpans[i].length;
+
+		LkSpan* recordCells = context->cells + (uint64_t)i * numAttributes;
+		for(j = 0; j < numAttributes; j++)
+		{
+			recordCells[j].offset = record - str;
+			recordCells[j].length = 0;
+		}
+
+		const char* field = record;
+		uint32_t attribute;
+		for(attribute = 1; attribute <= context->maxAttribute && field != NULL; attribute++)
+		{
+			const char* fieldEnd = LkScanFindByte(field, recordEnd - field, DBMV_Mark_AM);
+			int32_t column;
+			for(column = context->firstColumn[attribute]; column >= 0; column = context->nextColumn[column])
+			{
+				recordCells[column].offset = field - str;
+				recordCells[column].length = (fieldEnd ? fieldEnd : recordEnd) - field;
+				if(context->value > 0)
+					FindValue(str, &recordCells[column], context->value);
+			}
+			field = fieldEnd ? fieldEnd + 1 : NULL;
+		}
+
+		for(j = 0; j < numAttributes; j++)
+			sizes[j] += recordCells[j].length + 1;
+	}
+}
+
+// Second phase: the cells of the chunk are copied to their place in the columns
+static void CopyCellsTask(void* argument, uint32_t chunk)
+{
+	ColumnsContext* context = argument;
+	uint32_t numAttributes = context->numAttributes;
+	uint32_t first = ColumnsChunkStart(context, chunk);
+	uint32_t last = ColumnsChunkStart(context, chunk + 1);
+	uint32_t i, j;
+	for(j = 0; j < numAttributes; j++)
+	{
+		LkColumn* column = &context->result->columns[j];
+		uint32_t offset = context->chunkSizes[(uint64_t)chunk * numAttributes + j];
+		for(i = first; i < last; i++)
+		{
+			const LkSpan* cell = &context->cells[(uint64_t)i * numAttributes + j];
+			column->offsets[i] = offset;
+			memcpy(column->data + offset, context->records.str + cell->offset, cell->length);
+			offset += cell->length;
+			column->data[offset++] = 0;
+		}
+	}
+}
+
+/*
+	Function: BuildColumns
+		Helper function for <ExtractColumnsFromSection> that locates the cells of all the records and copies them into the columns.
+
+	Arguments:
+		context - The records, the columns to extract and the auxiliary arrays, already allocated.
+		pool - The thread pool used to process the chunks of records, or NULL to process them in the calling thread.
+		entryPoint - Name of the function that requests the memory, for <LkSetMemoryAccounting>.
+
+	Returns:
+		The columns, allocated in only one block, or NULL if there is no memory.
+*/
+static LkColumns* BuildColumns(ColumnsContext* context, LkThreadPool* pool, const char* const entryPoint)
+{
+	uint32_t i, j;
+	if(context->numRecords > 0)
+		LkThreadPoolRun(pool, context->numChunks, LocateCellsTask, context);
+
+	// The size of every chunk becomes its offset inside the column
+	uint32_t* columnSizes = context->chunkSizes + (uint64_t)context->numChunks * context->numAttributes;
+	uint64_t size = sizeof(LkColumns) + (uint64_t)context->numAttributes * sizeof(LkColumn);
+	for(j = 0; j < context->numAttributes; j++)
+	{
+		uint32_t offset = 0;
+		for(i = 0; i < context->numChunks; i++)
+		{
+			uint32_t chunkSize = context->chunkSizes[(uint64_t)i * context->numAttributes + j];
+			context->chunkSizes[(uint64_t)i * context->numAttributes + j] = offset;
+			offset += chunkSize;
+		}
+		columnSizes[j] = offset;
+		size += (context->numRecords + 1) * sizeof(uint32_t) + offset;
+	}
+
+	// The columns are copied into only one block
+	LkColumns* result = (size_t)size == size ? LkMallocFrom((size_t)size, entryPoint) : NULL;
+	if(result == NULL)
+		return NULL;
+
+	context->result = result;
+	result->numRecords = context->numRecords;
+	result->numColumns = context->numAttributes;
+	result->columns = (LkColumn*)(result + 1);
+	uint32_t* offsets = (uint32_t*)(result->columns + context->numAttributes);
+	for(j = 0; j < context->numAttributes; j++)
+	{
+		result->columns[j].attribute = context->attributes[j];
+		result->columns[j].offsets = offsets;
+		result->columns[j].offsets[context->numRecords] = columnSizes[j];
+		offsets += context->numRecords + 1;
+	}
+	char* data = (char*)offsets;
+	for(j = 0; j < context->numAttributes; j++)
+	{
+		result->columns[j].data = data;
+		data += columnSizes[j];
+	}
+
+	if(context->numRecords > 0)
+		LkThreadPoolRun(pool, context->numChunks, CopyCellsTask, context);
+
+	return result;
+}
+
+/*
+	Function: ExtractColumnsFromSection
+		Helper function for <LkExtractColumns> and <LkExtractColumnsParallel> that transposes a RECORD section into columns.
+
+	Arguments:
+		records - The RECORD section.
+		attributes - The 1-based attribute numbers of the columns.
+		numAttributes - The number of columns.
+		value - The 1-based value to take from every attribute, or 0 to take the whole attribute.
+		config - The thread pool used to process the records, or NULL to process them in the calling thread.
+		entryPoint - Name of the function that requests the memory, for <LkSetMemoryAccounting>.
+
+	Returns:
+		The columns, allocated in only one block. It must be released with <LkFreeColumns>.
+*/
+static LkColumns* ExtractColumnsFromSection(LkStrView records, const uint32_t* const attributes, uint32_t numAttributes, uint32_t value, const LkParallelConfig* const config, const char* const entryPoint)
+{
+	ColumnsContext context;
+	context.records = records;
+	context.attributes = attributes;
+	context.numAttributes = numAttributes;
+	context.value = value;
+	context.maxAttribute = 0;
+	context.result = NULL;
+
+	uint32_t i, j;
+	for(j = 0; j < numAttributes; j++)
+		if(attributes[j] > context.maxAttribute)
+			context.maxAttribute = attributes[j];
+
+	LkSpan* recordSpans = LkStrSplitSpansParallel(records.str, records.length, ASCII_RS, config, &context.numRecords);
+	context.recordSpans = recordSpans;
+	context.numChunks = GetNumChunks(config, records.length);
+	if(context.numChunks > context.numRecords)
+		context.numChunks = context.numRecords > 0 ? context.numRecords : 1;
+
+	// The sizes of the blocks are checked before they are computed, so they can't wrap around size_t
+	int32_t* firstColumn = NULL;
+	context.cells = NULL;
+	context.chunkSizes = NULL;
+	if(numAttributes <= SIZE_MAX / sizeof(int32_t) - context.maxAttribute - 1 &&
+		(numAttributes == 0 || (context.numRecords <= (SIZE_MAX / sizeof(LkSpan) - 1) / numAttributes &&
+		(size_t)context.numChunks + 1 <= (SIZE_MAX / sizeof(uint32_t) - 1) / numAttributes)))
+	{
+		// For every attribute number, the list of columns that take it, so every record is scanned only once
+		firstColumn = LkMallocFrom(((size_t)context.maxAttribute + 1 + numAttributes) * sizeof(int32_t), entryPoint);
+		context.cells = LkMallocFrom(((size_t)context.numRecords * numAttributes + 1) * sizeof(LkSpan), entryPoint);
+		// One row of sizes for every chunk, and the last row for the sizes of the whole columns
+		context.chunkSizes = LkCallocFrom(((size_t)context.numChunks + 1) * numAttributes + 1, sizeof(uint32_t), entryPoint);
+	}
+	if(firstColumn != NULL && context.cells != NULL && context.chunkSizes != NULL && (recordSpans != NULL || context.numRecords == 0))
+	{
+		int32_t* nextColumn = firstColumn + context.maxAttribute + 1;
+		for(i = 0; i <= context.maxAttribute; i++)
+			firstColumn[i] = -1;
+		for(j = numAttributes; j > 0; j--)
+		{
+			nextColumn[j - 1] = firstColumn[attributes[j - 1]];
+			firstColumn[attributes[j - 1]] = j - 1;
+		}
+		context.firstColumn = firstColumn;
+		context.nextColumn = nextColumn;
+
+		context.result = BuildColumns(&context, config ? config->pool : NULL, entryPoint);
+	}
+
+	LkFree(recordSpans);
+	LkFree(firstColumn);
+	LkFree(context.cells);
+	LkFree(context.chunkSizes);
+	return context.result;
+}
+
+/*
+	Function: LkExtractColumns
+		Extracts some attributes of all the records of an operation resultant <LkString>, as columns.
+		Every column contains the values of one attribute for all the records, one after another in the same memory block, so they can be processed without calling <LkExtract> for every record and attribute.
+		The RECORD section is scanned only once, whatever the number of columns is.
+
+	Arguments:
+		lkString - Text string on which you are going to extract.
+		attributes - Array with the 1-based numbers of the attributes to extract, up to 1048576. An attribute can be repeated, and the order is free.
+		numAttributes - The array size, that is the number of columns.
+		value - The 1-based number of the multivalue to extract from every attribute, or 0 to extract the whole attributes.
+
+	Returns:
+		The <LkColumns> with one column for every element of "attributes", or NULL if an attribute number is 0 or too big, or there is no memory. It must be released with <LkFreeColumns>.
+
+	Example:
+		--- Code
+		// lkStringResult it's a char * returned by a LkSelect function
+
+		uint32_t attributes[2] = { 1, 3 }; // CUSTOMER NAME and CUSTOMER PHONE
+		LkColumns* columns = LkExtractColumns(lkStringResult, attributes, 2, 0);
+		for(int i=0; i<columns->numRecords; i++)
+		{
+			printf("%s %s\r\n", LkColumnGet(&columns->columns[0], i), LkColumnGet(&columns->columns[1], i));
+		}
+		LkFreeColumns(columns);
+		LkFreeMemory(lkStringResult);
+		---
+
+	Also See:
+		<LkColumns>
+
+		<LkFreeColumns>
+*/
+DllEntry LkColumns* LkExtractColumns(const char* const lkString, const uint32_t* const attributes, uint32_t numAttributes, uint32_t value)
+{
+	uint32_t j;
+	for(j = 0; j < numAttributes; j++)
+		if(attributes[j] == 0 || attributes[j] > LkColumns_MAX_ATTRIBUTE)
+			return NULL;
+
+	LkStrView records;
+	FindSection(lkString, RECORDS_KEY, &records);
+	return ExtractColumnsFromSection(records, attributes, numAttributes, value, NULL, __func__);
+}
+
+/*
+	Function: LkExtractColumnsParallel
+		Extracts some attributes of all the records of a very big operation resultant <LkString>, as columns, like <LkExtractColumns>, using the threads of a <LkThreadPool>.
+		The records are divided in chunks, and every chunk is located and copied by a different thread. The result is the same as the one of <LkExtractColumns>.
+
+	Arguments:
+		lkString - Text string on which you are going to extract.
+		attributes - Array with the 1-based numbers of the attributes to extract, up to 1048576. An attribute can be repeated, and the order is free.
+		numAttributes - The array size, that is the number of columns.
+		value - The 1-based number of the multivalue to extract from every attribute, or 0 to extract the whole attributes.
+		config - The thread pool and the minimum size of every chunk of records. If NULL, or if the RECORD section is small, it works like <LkExtractColumns>.
+
+	Returns:
+		The <LkColumns> with one column for every element of "attributes", or NULL if an attribute number is 0 or too big, or there is no memory. It must be released with <LkFreeColumns>.
+
+	Example:
+		--- Code
+		// lkStringResult it's a char * returned by a LkGetTable function
+		LkParallelConfig config = { LkThreadPoolCreate(0), 0 };
+
+		uint32_t attributes[2] = { 1, 3 }; // CUSTOMER NAME and CUSTOMER PHONE
+		LkColumns* columns = LkExtractColumnsParallel(lkStringResult, attributes, 2, 0, &config);
+		...
+		LkFreeColumns(columns);
+		LkThreadPoolDestroy(config.pool);
+		---
+
+	Also See:
+		<LkExtractColumns>
+
+		<LkThreadPoolCreate>
+*/
+DllEntry LkColumns* LkExtractColumnsParallel(const char* const lkString, const uint32_t* const attributes, uint32_t numAttributes, uint32_t value, const LkParallelConfig* const config)
+{
+	uint32_t j;
+	for(j = 0; j < numAttributes; j++)
+		if(attributes[j] == 0 || attributes[j] > LkColumns_MAX_ATTRIBUTE)
+			return NULL;
+
+	LkStrView records;
+	FindSection(lkString, RECORDS_KEY, &records);
+	return ExtractColumnsFromSection(records, attributes, numAttributes, value, config, __func__);
+}
+
+/*
+	Function: LkFreeColumns
+		Releases the columns returned by <LkExtractColumns> or <LkExtractColumnsParallel>.
+
+	Arguments:
+		columns - The columns returned by <LkExtractColumns> or <LkExtractColumnsParallel>.
+
+	Also See:
+		<Release Memory>
+*/
+DllEntry void LkFreeColumns(LkColumns* columns)
+{
+	LkFree(columns);
+}
+
+/*
+	Function: FindCell
+		Helper function for the LkDecodeColumn functions that finds an attribute, or a value of an attribute, inside a record.
+
+	Arguments:
+		record - The record.
+		length - Length of "record".
+		attribute - The 1-based attribute number.
+		value - The 1-based value number, or 0 for the whole attribute.
+		cell - Output argument with the position and length of the attribute or value inside "record". It is empty if it doesn't exist.
+*/
+static void FindCell(const char* const record, uint32_t length, uint32_t attribute, uint32_t value, LkSpan* cell)
+{
+	const char* end = record + length;
+	const char* field = record;
+	uint32_t i;
+	for(i = 1; i < attribute; i++)
+	{
+		field = LkScanFindByte(field, end - field, DBMV_Mark_AM);
+		if(field == NULL)
+		{
+			cell->offset = length;
+			cell->length = 0;
+			return;
+		}
+		field++;
+	}
+
+	const char* fieldEnd = LkScanFindByte(field, end - field, DBMV_Mark_AM);
+	cell->offset = field - record;
+	cell->length = (fieldEnd ? fieldEnd : end) - field;
+	if(value > 0)
+		FindValue(record, cell, value);
+}
+
+/*
+	Function: ParseEightDigits
+		Helper function for <ParseNumber> that converts 8 digits at once, using 64 bits arithmetic instead of one multiplication per digit.
+
+	Arguments:
+		str - Pointer to the 8 chars.
+		result - Output argument with the number of 8 digits.
+
+	Returns:
+		TRUE if the 8 chars are digits, FALSE otherwise.
+*/
+static BOOL ParseEightDigits(const char* const str, uint64_t* result)
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	uint32_t i;
+	uint64_t number = 0;
+	for(i = 0; i < 8; i++)
+	{
+		if(str[i] < '0' || str[i] > '9')
+			return FALSE;
+		number = number * 10 + (str[i] - '0');
+	}
+	*result = number;
+	return TRUE;
+#else
+	uint64_t chunk;
+	memcpy(&chunk, str, 8);
+
+	// All the bytes must be between 0x30 and 0x39
+	if(((chunk & 0xF0F0F0F0F0F0F0F0ULL) | (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) != 0x3333333333333333ULL)
+		return FALSE;
+
+	// The first char is in the lowest byte: pairs of digits, then groups of 4, then the 8 digits
+	chunk -= 0x3030303030303030ULL;
+	chunk = (chunk * 10 + (chunk >> 8)) & 0x00FF00FF00FF00FFULL;
+	chunk = (chunk * 100 + (chunk >> 16)) & 0x0000FFFF0000FFFFULL;
+	chunk = (chunk * 10000 + (chunk >> 32)) & 0x00000000FFFFFFFFULL;
+	*result = chunk;
+	return TRUE;
+#endif
+}
+
+/*
+	Function: ParseNumber
+		Helper function for the LkDecodeColumn functions that parses a decimal number with optional sign and decimal point.
+
+	Arguments:
+		str - The number. It is not NUL terminated.
+		length - Length of "str".
+		mantissa - Output argument with all the digits of the number as an integer, including the decimals.
+		numDecimals - Output argument with the number of digits after the decimal point.
+		hasPoint - Output argument that is TRUE when the number has a decimal point.
+
+	Returns:
+		TRUE if the text is a valid number of up to 18 digits, not counting the leading zeros, FALSE otherwise.
+*/
+static BOOL ParseNumber(const char* str, uint32_t length, int64_t* mantissa, uint32_t* numDecimals, BOOL* hasPoint)
+{
+	const char* end = str + length;
+	BOOL negative = FALSE;
+	if(str < end && (*str == '-' || *str == '+'))
+	{
+		negative = (*str == '-');
+		str++;
+	}
+
+	// The leading zeros don't count for the limit of 18 digits
+	const char* digits = str;
+	while(str < end && *str == '0')
+		str++;
+	BOOL leadingZeros = str > digits;
+
+	uint64_t number = 0;
+	uint32_t numDigits = 0;
+	*numDecimals = 0;
+	*hasPoint = FALSE;
+	while(str < end)
+	{
+		uint64_t chunk;
+		if(end - str >= 8 && numDigits <= 10 && ParseEightDigits(str, &chunk))
+		{
+			number = number * 100000000ULL + chunk;
+			numDigits += 8;
+			if(*hasPoint)
+				*numDecimals += 8;
+			str += 8;
+		}
+		else if(*str >= '0' && *str <= '9')
+		{
+			if(numDigits >= 18)
+				return FALSE;
+			number = number * 10 + (*str - '0');
+			numDigits++;
+			if(*hasPoint)
+				(*numDecimals)++;
+			str++;
+		}
+		else if(*str == '.' && !*hasPoint)
+		{
+			*hasPoint = TRUE;
+			str++;
+		}
+		else
+			return FALSE;
+	}
+
+	if(numDigits == 0 && !leadingZeros)
+		return FALSE;
+
+	*mantissa = negative ? -(int64_t)number : (int64_t)number;
+	return TRUE;
+}
+
+static const int64_t powersOf10[19] =
+{
+	1LL, 10LL, 100LL, 1000LL, 10000LL, 100000LL, 1000000LL, 10000000LL, 100000000LL, 1000000000LL,
+	10000000000LL, 100000000000LL, 1000000000000LL, 10000000000000LL, 100000000000000LL,
+	1000000000000000LL, 10000000000000000LL, 100000000000000000LL, 1000000000000000000LL
+};
+
+/*
+	Function: DecodeColumn
+		Helper function for <LkDecodeColumnInt64> and <LkDecodeColumnDouble>, that parses one attribute or value of every record.
+
+	Arguments:
+		lkString - Text string on which you are going to extract.
+		attribute - The 1-based attribute number.
+		value - The 1-based value number, or 0 for the whole attribute.
+		impliedDecimals - Number of implied decimals of the values without decimal point, like the MD conversion codes.
+		asDouble - TRUE to return the values as double, FALSE to return them as int64_t.
+		entryPoint - Name of the function that requests the memory, for <LkSetMemoryAccounting>.
+
+	Returns:
+		The new column, allocated in only one memory block.
+*/
+static void* DecodeColumn(const char* const lkString, uint32_t attribute, uint32_t value, uint8_t impliedDecimals, BOOL asDouble, const char* const entryPoint)
+{
+	if(attribute == 0 || impliedDecimals > 18)
+		return NULL;
+
+	LkStrView records;
+	FindSection(lkString, RECORDS_KEY, &records);
+	uint32_t numRecords = records.length > 0 ? LkScanCountByte(records.str, records.length, ASCII_RS) + 1 : 0;
+
+	// LkInt64Column and LkDoubleColumn have the same layout, only the type of "values" is different
+	// The size is checked before it is computed, so it can't wrap around size_t
+	uint32_t sizeHeader = (sizeof(LkInt64Column) + 7) & ~7;
+	if(numRecords > (SIZE_MAX - sizeHeader - 1) / (sizeof(int64_t) + 1))
+		return NULL;
+	LkInt64Column* column = LkMallocFrom(sizeHeader + (size_t)numRecords * sizeof(int64_t) + ((size_t)numRecords + 7) / 8, entryPoint);
+	if(column == NULL)
+		return NULL;
+
+	column->numRecords = numRecords;
+	column->numNulls = 0;
+	column->values = (int64_t*)((char*)column + sizeHeader);
+	column->nulls = (uint8_t*)(column->values + numRecords);
+	memset(column->nulls, 0, (numRecords + 7) / 8);
+	double* doubleValues = (double*)column->values;
+
+	const char* end = records.str + records.length;
+	const char* record = records.str;
+	uint32_t i;
+	for(i = 0; i < numRecords; i++)
+	{
+		const char* recordEnd = LkScanFindByte(record, end - record, ASCII_RS);
+		if(recordEnd == NULL)
+			recordEnd = end;
+
+		LkSpan cell;
+		FindCell(record, recordEnd - record, attribute, value, &cell);
+
+		int64_t mantissa;
+		uint32_t numDecimals;
+		BOOL hasPoint;
+		BOOL valid = ParseNumber(record + cell.offset, cell.length, &mantissa, &numDecimals, &hasPoint);
+		if(valid && !asDouble && hasPoint && numDecimals < impliedDecimals)
+		{
+			// The number scaled to the implied decimals must fit in an int64_t
+			int64_t scale = powersOf10[impliedDecimals - numDecimals];
+			valid = mantissa <= INT64_MAX / scale && mantissa >= -(INT64_MAX / scale);
+		}
+
+		if(!valid)
+		{
+			column->nulls[i >> 3] |= 1 << (i & 7);
+			column->numNulls++;
+			column->values[i] = 0;
+		}
+		else if(asDouble)
+			doubleValues[i] = (double)mantissa / powersOf10[hasPoint ? numDecimals : impliedDecimals];
+		else if(!hasPoint)
+			column->values[i] = mantissa;
+		else if(numDecimals >= impliedDecimals)
+			column->values[i] = mantissa / powersOf10[numDecimals - impliedDecimals];
+		else
+			column->values[i] = mantissa * powersOf10[impliedDecimals - numDecimals];
+
+		record = recordEnd + 1;
+	}
+
+	return column;
+}
+
+/*
+	Function: LkDecodeColumnInt64
+		Parses an attribute, or a value of an attribute, of all the records of an operation resultant <LkString> as integer numbers, without extracting them as strings.
+		The numbers are returned in units of the last implied decimal: with 2 implied decimals (like the MD2 conversion code), "12345" is 12345 (123.45), and a value with decimal point like "123.4" is scaled to 12340.
+
+	Arguments:
+		lkString - Text string on which you are going to extract.
+		attribute - The 1-based attribute number.
+		value - The 1-based multivalue number, or 0 to parse the whole attribute.
+		impliedDecimals - Number of implied decimals of the stored values, from 0 to 18.
+
+	Returns:
+		The <LkInt64Column> with one number for every record, or NULL if there is no memory or the arguments are wrong. Empty values, values that are not numbers and values too big for an int64_t once scaled are marked in the null bitmap, and their number is 0. It must be released with <LkFreeInt64Column>.
+
+	Example:
+		--- Code
+		// lkStringResult it's a char * returned by a LkSelect function
+
+		LkInt64Column* amounts = LkDecodeColumnInt64(lkStringResult, 4, 0, 2);
+		int64_t total = 0;
+		for(int i=0; i<amounts->numRecords; i++)
+		{
+			if(!LkIsNull(amounts, i))
+				total += amounts->values[i];
+		}
+		LkFreeInt64Column(amounts);
+		---
+
+	Also See:
+		<LkDecodeColumnDouble>
+*/
+DllEntry LkInt64Column* LkDecodeColumnInt64(const char* const lkString, uint32_t attribute, uint32_t value, uint8_t impliedDecimals)
+{
+	return DecodeColumn(lkString, attribute, value, impliedDecimals, FALSE, __func__);
+}
+
+/*
+	Function: LkDecodeColumnDouble
+		Parses an attribute, or a value of an attribute, of all the records of an operation resultant <LkString> as floating point numbers, without extracting them as strings.
+		The values without decimal point are divided by the implied decimals: with 2 implied decimals (like the MD2 conversion code), "12345" is 123.45. The values with decimal point are taken as they are.
+
+	Arguments:
+		lkString - Text string on which you are going to extract.
+		attribute - The 1-based attribute number.
+		value - The 1-based multivalue number, or 0 to parse the whole attribute.
+		impliedDecimals - Number of implied decimals of the stored values, from 0 to 18.
+
+	Returns:
+		The <LkDoubleColumn> with one number for every record, or NULL if there is no memory or the arguments are wrong. Empty values and values that are not numbers are marked in the null bitmap. It must be released with <LkFreeDoubleColumn>.
+
+	Also See:
+		<LkDecodeColumnInt64>
+*/
+DllEntry LkDoubleColumn* LkDecodeColumnDouble(const char* const lkString, uint32_t attribute, uint32_t value, uint8_t impliedDecimals)
+{
+	return DecodeColumn(lkString, attribute, value, impliedDecimals, TRUE, __func__);
+}
+
+/*
+	Function: LkFreeInt64Column
+		Releases the column returned by <LkDecodeColumnInt64>.
+
+	Arguments:
+		column - The column returned by <LkDecodeColumnInt64>.
+
+	Also See:
+		<Release Memory>
+*/
+DllEntry void LkFreeInt64Column(LkInt64Column* column)
+{
+	LkFree(column);
+}
+
+/*
+	Function: LkFreeDoubleColumn
+		Releases the column returned by <LkDecodeColumnDouble>.
+
+	Arguments:
+		column - The column returned by <LkDecodeColumnDouble>.
+
+	Also See:
+		<Release Memory>
+*/
+DllEntry void LkFreeDoubleColumn(LkDoubleColumn* column)
+{
+	LkFree(column);
 }
@@ -0,0 +1,838 @@
+/*
+	File: LinkarThreadPool.c
+	This module contains the <LkThreadPool> used by the *Parallel functions of the library.
+
+	The pool has a fixed number of worker threads, that wait for the functions submitted with <LkThreadPoolSubmit>.
+	<LkThreadPoolRun> splits a piece of work into tasks. The worker threads and the calling thread take the next pending task
+	from a shared counter until all of them are done, so a thread that finishes its tasks early keeps taking the tasks that
+	the slower threads have not started yet.
+
+	The pool also runs the asynchronous operations of the library. <LkFutureSubmit> queues a function that returns a string,
+	and the <LkFuture> it returns can be waited, with or without a timeout, cancelled while it has not started, or given a
+	callback that is called when it finishes. A thread that submits many operations doesn't need to wait for every one of them.
+
+	Windows threads are used in Windows, and POSIX threads in Linux.
+*/
+
+#include "LinkarThreadPool.h"
+#include "LinkarMemory.h"
+#include <stdlib.h>
+
+#ifdef _WIN32
+	#include <windows.h>
+	#include <process.h>
+
+	typedef CRITICAL_SECTION LkMutex;
+	typedef CONDITION_VARIABLE LkCond;
+	typedef HANDLE LkThread;
+	typedef DWORD LkThreadId;
+	typedef volatile LONG LkAtomic;
+
+	#define LkMutexInit(mutex) InitializeCriticalSection(mutex)
+	#define LkMutexDestroy(mutex) DeleteCriticalSection(mutex)
+	#define LkMutexLock(mutex) EnterCriticalSection(mutex)
+	#define LkMutexUnlock(mutex) LeaveCriticalSection(mutex)
+	#define LkCondInit(cond) InitializeConditionVariable(cond)
+	#define LkCondDestroy(cond)
+	#define LkCondWait(cond, mutex) SleepConditionVariableCS(cond, mutex, INFINITE)
+	#define LkCondSignal(cond) WakeConditionVariable(cond)
+	#define LkCondBroadcast(cond) WakeAllConditionVariable(cond)
+	#define LkAtomicFetchAdd(atomic) (InterlockedIncrement(atomic) - 1)
+	#define LkThreadSelf() GetCurrentThreadId()
+	#define LkThreadEqual(thread1, thread2) ((thread1) == (thread2))
+
+	static SRWLOCK asyncPoolLock = SRWLOCK_INIT;
+
+	#define LkAsyncPoolLock() AcquireSRWLockExclusive(&asyncPoolLock)
+	#define LkAsyncPoolUnlock() ReleaseSRWLockExclusive(&asyncPoolLock)
+#else
+	#include <pthread.h>
+	#include <unistd.h>
+	#include <time.h>
+	#include <errno.h>
+
+	typedef pthread_mutex_t LkMutex;
+	typedef pthread_cond_t LkCond;
+	typedef pthread_t LkThread;
+	typedef pthread_t LkThreadId;
+	typedef volatile long LkAtomic;
+
+	#define LkMutexInit(mutex) pthread_mutex_init(mutex, NULL)
+	#define LkMutexDestroy(mutex) pthread_mutex_destroy(mutex)
+	#define LkMutexLock(mutex) pthread_mutex_lock(mutex)
+	#define LkMutexUnlock(mutex) pthread_mutex_unlock(mutex)
+	#define LkCondInit(cond) pthread_cond_init(cond, NULL)
+	#define LkCondDestroy(cond) pthread_cond_destroy(cond)
+	#define LkCondWait(cond, mutex) pthread_cond_wait(cond, mutex)
+	#define LkCondSignal(cond) pthread_cond_signal(cond)
+	#define LkCondBroadcast(cond) pthread_cond_broadcast(cond)
+	#define LkAtomicFetchAdd(atomic) __sync_fetch_and_add(atomic, 1)
+	#define LkThreadSelf() pthread_self()
+	#define LkThreadEqual(thread1, thread2) pthread_equal(thread1, thread2)
+
+	static pthread_mutex_t asyncPoolLock = PTHREAD_MUTEX_INITIALIZER;
+
+	#define LkAsyncPoolLock() pthread_mutex_lock(&asyncPoolLock)
+	#define LkAsyncPoolUnlock() pthread_mutex_unlock(&asyncPoolLock)
+#endif
+
+typedef struct LkThreadPoolJob
+{
+	LkThreadPoolFunction function;
+	void* argument;
+	struct LkThreadPoolJob* next;
+} LkThreadPoolJob;
+
+struct LkThreadPool
+{
+	uint32_t numThreads;
+	LkThread* threads;
+	LkThreadPoolJob* first;
+	LkThreadPoolJob* last;
+	BOOL stopping;
+	LkMutex mutex;
+	LkCond jobReady;
+	LkCond jobDone;
+};
+
+/*
+	Struct: ParallelRun
+		State of a <LkThreadPoolRun> call, shared by the calling thread and the helper jobs.
+*/
+typedef struct
+{
+	LkParallelTask task;
+	void* context;
+	uint32_t numTasks;
+	LkAtomic nextTask;
+	uint32_t numHelpers;
+} ParallelRun;
+
+static void WorkerLoop(LkThreadPool* pool)
+{
+	LkMutexLock(&pool->mutex);
+	while(1)
+	{
+		while(pool->first == NULL && !pool->stopping)
+			LkCondWait(&pool->jobReady, &pool->mutex);
+		if(pool->first == NULL)
+			break;
+
+		LkThreadPoolJob* job = pool->first;
+		pool->first = job->next;
+		if(pool->first == NULL)
+			pool->last = NULL;
+		LkMutexUnlock(&pool->mutex);
+
+		job->function(job->argument);
+		LkFree(job);
+
+		LkMutexLock(&pool->mutex);
+	}
+	LkMutexUnlock(&pool->mutex);
+}
+
+#ifdef _WIN32
+static unsigned __stdcall WorkerThread(void* argument)
+{
+	WorkerLoop(argument);
+	return 0;
+}
+#else
+static void* WorkerThread(void* argument)
+{
+	WorkerLoop(argument);
+	return NULL;
+}
+#endif
+
+static uint32_t GetNumCpus()
+{
+#ifdef _WIN32
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return info.dwNumberOfProcessors;
+#else
+	long numCpus = sysconf(_SC_NPROCESSORS_ONLN);
+	return numCpus > 0 ? numCpus : 1;
+#endif
+}
+
+/*
+	Function: LkThreadPoolCreate
+		Creates a thread pool for the *Parallel functions of the library.
+		The same pool can be used by several functions and several threads at the same time.
+
+	Arguments:
+		numThreads - Number of worker threads. If 0, one thread for every CPU of the computer.
+
+	Returns:
+		The new thread pool, or NULL if the threads can't be created. It must be released with <LkThreadPoolDestroy>.
+
+	Example:
+		--- Code
+		LkParallelConfig config = { LkThreadPoolCreate(0), 0 };
+		uint32_t attributes[2] = { 1, 3 };
+		LkColumns* columns = LkExtractColumnsParallel(lkStringResult, attributes, 2, 0, &config);
+		...
+		LkFreeColumns(columns);
+		LkThreadPoolDestroy(config.pool);
+		---
+
+	Also See:
+		<LkThreadPoolDestroy>
+*/
+DllEntry LkThreadPool* LkThreadPoolCreate(uint32_t numThreads)
+{
+	if(numThreads == 0)
+		numThreads = GetNumCpus();
+
+	LkThreadPool* pool = LkMallocFrom(sizeof(LkThreadPool) + numThreads * sizeof(LkThread), __func__);
+	if(pool == NULL)
+		return NULL;
+
+	pool->numThreads = 0;
+	pool->threads = (LkThread*)(pool + 1);
+	pool->first = NULL;
+	pool->last = NULL;
+	pool->stopping = FALSE;
+	LkMutexInit(&pool->mutex);
+	LkCondInit(&pool->jobReady);
+	LkCondInit(&pool->jobDone);
+
+	for(; pool->numThreads < numThreads; pool->numThreads++)
+	{
+#ifdef _WIN32
+		LkThread thread = (HANDLE)_beginthreadex(NULL, 0, WorkerThread, pool, 0, NULL);
+		if(thread == 0)
+			break;
+#else
+		LkThread thread;
+		if(pthread_create(&thread, NULL, WorkerThread, pool) != 0)
+			break;
+#endif
+		pool->threads[pool->numThreads] = thread;
+	}
+
+	if(pool->numThreads == 0)
+	{
+		LkThreadPoolDestroy(pool);
+		return NULL;
+	}
+
+	return pool;
+}
+
+/*
+	Function: LkThreadPoolGetNumThreads
+		Gets the number of worker threads of a thread pool.
+
+	Arguments:
+		pool - The thread pool created by <LkThreadPoolCreate>.
+
+	Returns:
+		The number of worker threads, or 0 if "pool" is NULL.
+*/
+DllEntry uint32_t LkThreadPoolGetNumThreads(const LkThreadPool* const pool)
+{
+	return pool ? pool->numThreads : 0;
+}
+
+/*
+	Function: LkThreadPoolSubmit
+		Submits a function to be executed by one of the worker threads of a thread pool. The functions are started in the same order they are submitted.
+
+	Arguments:
+		pool - The thread pool created by <LkThreadPoolCreate>.
+		function - The function to execute.
+		argument - The argument passed to "function".
+
+	Returns:
+		TRUE if the function was submitted, FALSE if there is no memory.
+*/
+DllEntry BOOL LkThreadPoolSubmit(LkThreadPool* pool, LkThreadPoolFunction function, void* argument)
+{
+	LkThreadPoolJob* job = LkMallocFrom(sizeof(LkThreadPoolJob), __func__);
+	if(job == NULL)
+		return FALSE;
+
+	job->function = function;
+	job->argument = argument;
+	job->next = NULL;
+
+	LkMutexLock(&pool->mutex);
+	if(pool->last)
+		pool->last->next = job;
+	else
+		pool->first = job;
+	pool->last = job;
+	LkCondSignal(&pool->jobReady);
+	LkMutexUnlock(&pool->mutex);
+
+	return TRUE;
+}
+
+static void RunTasks(ParallelRun* run)
+{
+	while(1)
+	{
+		uint32_t index = LkAtomicFetchAdd(&run->nextTask);
+		if(index >= run->numTasks)
+			break;
+		run->task(run->context, index);
+	}
+}
+
+// Argument of the helper jobs submitted by LkThreadPoolRun. The pool is needed to signal the end of the helper
+typedef struct
+{
+	LkThreadPool* pool;
+	ParallelRun* run;
+} ParallelHelper;
+
+static void RunHelper(void* argument)
+{
+	ParallelHelper* helper = argument;
+	RunTasks(helper->run);
+
+	LkMutexLock(&helper->pool->mutex);
+	helper->run->numHelpers--;
+	LkCondBroadcast(&helper->pool->jobDone);
+	LkMutexUnlock(&helper->pool->mutex);
+}
+
+/*
+	Function: LkThreadPoolRun
+		Executes a function for every index from 0 to "numTasks" - 1, using the worker threads of a thread pool and the calling thread.
+		It returns when all the tasks are done. The tasks can be executed in any order, and several of them at the same time.
+
+	Arguments:
+		pool - The thread pool created by <LkThreadPoolCreate>. If NULL, all the tasks are executed by the calling thread.
+		numTasks - Number of tasks.
+		task - The function executed for every task. It receives "context" and the index of the task.
+		context - The argument passed to "task".
+*/
+DllEntry void LkThreadPoolRun(LkThreadPool* pool, uint32_t numTasks, LkParallelTask task, void* context)
+{
+	ParallelRun run;
+	run.task = task;
+	run.context = context;
+	run.numTasks = numTasks;
+	run.nextTask = 0;
+	run.numHelpers = 0;
+
+	uint32_t numHelpers = 0;
+	ParallelHelper helper;
+	if(pool != NULL && numTasks > 1)
+	{
+		numHelpers = numTasks - 1 < pool->numThreads ? numTasks - 1 : pool->numThreads;
+		helper.pool = pool;
+		helper.run = &run;
+	}
+
+	uint32_t i;
+	for(i = 0; i < numHelpers; i++)
+	{
+		LkMutexLock(&pool->mutex);
+		run.numHelpers++;
+		LkMutexUnlock(&pool->mutex);
+		if(!LkThreadPoolSubmit(pool, RunHelper, &helper))
+		{
+			LkMutexLock(&pool->mutex);
+			run.numHelpers--;
+			LkMutexUnlock(&pool->mutex);
+			break;
+		}
+	}
+
+	RunTasks(&run);
+
+	if(numHelpers > 0)
+	{
+		LkMutexLock(&pool->mutex);
+
+		// The helpers that were not started yet are not needed anymore. Removing them avoids waiting for busy workers,
+		// and makes it safe to call this function from a task of the same pool.
+		LkThreadPoolJob* previous = NULL;
+		LkThreadPoolJob* job = pool->first;
+		while(job != NULL)
+		{
+			LkThreadPoolJob* next = job->next;
+			if(job->function == RunHelper && job->argument == &helper)
+			{
+				if(previous)
+					previous->next = next;
+				else
+					pool->first = next;
+				if(pool->last == job)
+					pool->last = previous;
+				LkFree(job);
+				run.numHelpers--;
+			}
+			else
+				previous = job;
+			job = next;
+		}
+
+		while(run.numHelpers > 0)
+			LkCondWait(&pool->jobDone, &pool->mutex);
+		LkMutexUnlock(&pool->mutex);
+	}
+}
+
+/*
+	Function: LkThreadPoolDestroy
+		Stops the worker threads of a thread pool and releases it. The functions already submitted are executed before the threads stop.
+
+	Arguments:
+		pool - The thread pool created by <LkThreadPoolCreate>.
+
+	Also See:
+		<Release Memory>
+*/
+DllEntry void LkThreadPoolDestroy(LkThreadPool* pool)
+{
+	if(pool == NULL)
+		return;
+
+	LkMutexLock(&pool->mutex);
+	pool->stopping = TRUE;
+	LkCondBroadcast(&pool->jobReady);
+	LkMutexUnlock(&pool->mutex);
+
+	uint32_t i;
+	for(i = 0; i < pool->numThreads; i++)
+	{
+#ifdef _WIN32
+		WaitForSingleObject(pool->threads[i], INFINITE);
+		CloseHandle(pool->threads[i]);
+#else
+		pthread_join(pool->threads[i], NULL);
+#endif
+	}
+
+	LkCondDestroy(&pool->jobReady);
+	LkCondDestroy(&pool->jobDone);
+	LkMutexDestroy(&pool->mutex);
+	LkFree(pool);
+}
+
+struct LkFuture
+{
+	LkFutureFunction function;
+	void* argument;
+	LkThreadPoolFunction releaseArgument;
+	LkFutureCallback callback;
+	void* userData;
+	char* result;
+	char* error;
+	uint8_t state;
+	// The caller, the job of the pool and the callback while it runs hold a reference each. The last one releases the future
+	uint8_t references;
+	// Set by LkFutureDestroy, so a callback that has not started is not called anymore
+	BOOL destroyed;
+	// The callback is running in callbackThread, and LkFutureDestroy waits for it unless it is called from the callback
+	BOOL inCallback;
+	LkThreadId callbackThread;
+	LkMutex mutex;
+	LkCond finished;
+};
+
+// The pool of the asynchronous operations set with LkSetAsyncThreadPool, and the default one, created the first time it is needed
+static LkThreadPool* asyncPool = NULL;
+static LkThreadPool* defaultAsyncPool = NULL;
+
+/*
+	Function: LkSetAsyncThreadPool
+		Sets the thread pool that executes the asynchronous operations of the library, like <Base_LkReadAsync>.
+		If it is not set, a pool of <LkFuture_DEFAULT_THREADS> threads is created the first time an asynchronous operation is executed.
+
+	Arguments:
+		pool - The thread pool created by <LkThreadPoolCreate>, or NULL to use the default pool. It must not be destroyed while it has operations pending.
+
+	Remarks:
+		The asynchronous operations spend most of their time waiting for the server, so the pool can have many more threads than CPUs.
+		The default pool is kept until the process ends, and it is used again when the pool is set to NULL.
+*/
+DllEntry void LkSetAsyncThreadPool(LkThreadPool* pool)
+{
+	LkAsyncPoolLock();
+	asyncPool = pool;
+	LkAsyncPoolUnlock();
+}
+
+/*
+	Function: LkGetAsyncThreadPool
+		Gets the thread pool that executes the asynchronous operations of the library, creating the default one if no pool has been set.
+
+	Returns:
+		The thread pool, or NULL if the default pool can't be created.
+
+	Also See:
+		<LkSetAsyncThreadPool>
+*/
+DllEntry LkThreadPool* LkGetAsyncThreadPool()
+{
+	LkAsyncPoolLock();
+	if(asyncPool == NULL && defaultAsyncPool == NULL)
+		defaultAsyncPool = LkThreadPoolCreate(LkFuture_DEFAULT_THREADS);
+	LkThreadPool* pool = asyncPool != NULL ? asyncPool : defaultAsyncPool;
+	LkAsyncPoolUnlock();
+
+	return pool;
+}
+
+/*
+	Function: ReleaseFuture
+		Helper function that drops a reference to a future, and releases it with the result and the error not taken yet when it was the last one.
+		The result and the error are released with free, because they are allocated by the Linkar private library.
+*/
+static void ReleaseFuture(LkFuture* future)
+{
+	LkMutexLock(&future->mutex);
+	BOOL last = --future->references == 0;
+	LkMutexUnlock(&future->mutex);
+	if(!last)
+		return;
+
+	free(future->result);
+	free(future->error);
+	LkCondDestroy(&future->finished);
+	LkMutexDestroy(&future->mutex);
+	LkFree(future);
+}
+
+/*
+	Function: CallCallback
+		Helper function that calls the callback of a finished future, if the future has not been destroyed.
+		It must be called with the mutex of the future locked, and it returns with the mutex unlocked.
+		The callback holds a reference, so it can destroy the future, and <LkFutureDestroy> called from another thread waits until the callback returns.
+*/
+static void CallCallback(LkFuture* future, LkFutureCallback callback, void* userData)
+{
+	if(future->destroyed)
+		callback = NULL;
+	if(callback)
+	{
+		future->references++;
+		future->inCallback = TRUE;
+		future->callbackThread = LkThreadSelf();
+	}
+	LkMutexUnlock(&future->mutex);
+
+	if(callback)
+	{
+		callback(future, userData);
+
+		LkMutexLock(&future->mutex);
+		future->inCallback = FALSE;
+		LkCondBroadcast(&future->finished);
+		LkMutexUnlock(&future->mutex);
+		ReleaseFuture(future);
+	}
+}
+
+/*
+	Function: FinishFuture
+		Helper function that sets the final state of a future, wakes the threads that wait for it and calls its callback.
+		It must be called with the mutex of the future locked, and it returns with the mutex unlocked.
+*/
+static void FinishFuture(LkFuture* future, uint8_t state)
+{
+	future->state = state;
+	LkCondBroadcast(&future->finished);
+	CallCallback(future, future->callback, future->userData);
+}
+
+static void RunFuture(void* argument)
+{
+	LkFuture* future = argument;
+
+	LkMutexLock(&future->mutex);
+	BOOL cancelled = future->state == LkFuture_CANCELLED;
+	if(!cancelled)
+		future->state = LkFuture_RUNNING;
+	LkMutexUnlock(&future->mutex);
+
+	if(!cancelled)
+	{
+		char* error = NULL;
+		char* result = future->function(future->argument, &error);
+
+		LkMutexLock(&future->mutex);
+		future->result = result;
+		future->error = error;
+		FinishFuture(future, LkFuture_DONE);
+	}
+
+	if(future->releaseArgument)
+		future->releaseArgument(future->argument);
+	ReleaseFuture(future);
+}
+
+/*
+	Function: LkFutureSubmit
+		Executes a function asynchronously in a thread pool. The calling thread doesn't wait for it.
+
+	Arguments:
+		pool - The thread pool created by <LkThreadPoolCreate>. If NULL, the pool of <LkGetAsyncThreadPool> is used.
+		function - The function to execute. It receives "argument" and the place for the error, and returns the result. Both strings must be allocated with malloc, like the results of the operations.
+		argument - The argument passed to "function".
+		releaseArgument - Function that releases "argument" when it is not needed anymore, after "function" has finished or the future is cancelled. It can be NULL.
+
+	Returns:
+		The future of the result, or NULL if there is no memory. In that case "argument" is not released. It must be released with <LkFutureDestroy>.
+
+	Also See:
+		<LkFutureWait>
+
+		<LkFutureGetResult>
+*/
+DllEntry LkFuture* LkFutureSubmit(LkThreadPool* pool, LkFutureFunction function, void* argument, LkThreadPoolFunction releaseArgument)
+{
+	if(pool == NULL)
+		pool = LkGetAsyncThreadPool();
+	if(pool == NULL)
+		return NULL;
+
+	LkFuture* future = LkMallocFrom(sizeof(LkFuture), __func__);
+	if(future == NULL)
+		return NULL;
+
+	future->function = function;
+	future->argument = argument;
+	future->releaseArgument = releaseArgument;
+	future->callback = NULL;
+	future->userData = NULL;
+	future->result = NULL;
+	future->error = NULL;
+	future->state = LkFuture_PENDING;
+	future->references = 2;
+	future->destroyed = FALSE;
+	future->inCallback = FALSE;
+	LkMutexInit(&future->mutex);
+	LkCondInit(&future->finished);
+
+	if(!LkThreadPoolSubmit(pool, RunFuture, future))
+	{
+		LkCondDestroy(&future->finished);
+		LkMutexDestroy(&future->mutex);
+		LkFree(future);
+		return NULL;
+	}
+
+	return future;
+}
+
+/*
+	Function: LkFutureGetState
+		Gets the state of a future without waiting.
+
+	Arguments:
+		future - The future returned by an asynchronous function.
+
+	Returns:
+		<LkFuture_PENDING>, <LkFuture_RUNNING>, <LkFuture_DONE> or <LkFuture_CANCELLED>.
+*/
+DllEntry uint8_t LkFutureGetState(LkFuture* future)
+{
+	LkMutexLock(&future->mutex);
+	uint8_t state = future->state;
+	LkMutexUnlock(&future->mutex);
+
+	return state;
+}
+
+/*
+	Function: LkFutureWaitFor
+		Waits until a future finishes, or the time is over.
+
+	Arguments:
+		future - The future returned by an asynchronous function.
+		milliseconds - Maximum time to wait. <LkFuture_INFINITE> waits until the future finishes, and 0 only checks it.
+
+	Returns:
+		TRUE if the future has finished, that is, it is done or cancelled. FALSE if the time is over.
+*/
+DllEntry BOOL LkFutureWaitFor(LkFuture* future, uint32_t milliseconds)
+{
+	LkMutexLock(&future->mutex);
+#ifdef _WIN32
+	ULONGLONG deadline = GetTickCount64() + milliseconds;
+	while(future->state < LkFuture_DONE && milliseconds > 0)
+	{
+		if(milliseconds == LkFuture_INFINITE)
+			LkCondWait(&future->finished, &future->mutex);
+		else
+		{
+			ULONGLONG now = GetTickCount64();
+			if(now >= deadline)
+				break;
+			SleepConditionVariableCS(&future->finished, &future->mutex, (DWORD)(deadline - now));
+		}
+	}
+#else
+	struct timespec deadline;
+	if(milliseconds != LkFuture_INFINITE)
+	{
+		clock_gettime(CLOCK_REALTIME, &deadline);
+		deadline.tv_sec += milliseconds / 1000;
+		deadline.tv_nsec += (long)(milliseconds % 1000) * 1000000;
+		if(deadline.tv_nsec >= 1000000000)
+		{
+			deadline.tv_sec++;
+			deadline.tv_nsec -= 1000000000;
+		}
+	}
+	while(future->state < LkFuture_DONE && milliseconds > 0)
+	{
+		if(milliseconds == LkFuture_INFINITE)
+			LkCondWait(&future->finished, &future->mutex);
+		else if(pthread_cond_timedwait(&future->finished, &future->mutex, &deadline) == ETIMEDOUT)
+			break;
+	}
+#endif
+	BOOL finished = future->state >= LkFuture_DONE;
+	LkMutexUnlock(&future->mutex);
+
+	return finished;
+}
+
+/*
+	Function: LkFutureWait
+		Waits until a future finishes.
+
+	Arguments:
+		future - The future returned by an asynchronous function.
+
+	Returns:
+		TRUE if the future is done, FALSE if it was cancelled.
+*/
+DllEntry BOOL LkFutureWait(LkFuture* future)
+{
+	LkFutureWaitFor(future, LkFuture_INFINITE);
+	return LkFutureGetState(future) == LkFuture_DONE;
+}
+
+/*
+	Function: LkFutureCancel
+		Cancels a future that has not started yet. An operation that is already running can't be stopped, because it is waiting for the server.
+
+	Arguments:
+		future - The future returned by an asynchronous function.
+
+	Returns:
+		TRUE if the future was cancelled, FALSE if it has already started.
+*/
+DllEntry BOOL LkFutureCancel(LkFuture* future)
+{
+	LkMutexLock(&future->mutex);
+	if(future->state != LkFuture_PENDING)
+	{
+		LkMutexUnlock(&future->mutex);
+		return FALSE;
+	}
+
+	FinishFuture(future, LkFuture_CANCELLED);
+	return TRUE;
+}
+
+/*
+	Function: LkFutureSetCallback
+		Sets the function that is called when a future finishes, done or cancelled.
+		It is called by the worker thread that executed the future, or by the thread that cancelled it.
+		If the future has already finished, it is called at once by the calling thread.
+
+	Arguments:
+		future - The future returned by an asynchronous function.
+		callback - The function to call. It can take the result with <LkFutureGetResult>, and release the future with <LkFutureDestroy>.
+		userData - The argument passed to "callback".
+
+	Example:
+		--- Code
+		static void OnRead(LkFuture* future, void* userData)
+		{
+			char* error;
+			char* result = LkFutureGetResult(future, &error);
+			...
+			LkFutureDestroy(future);
+		}
+
+		LkFuture* future = Base_LkReadAsync(credentialOptions, "LK.CUSTOMERS", recordIds, "", readOptions, DataFormatTYPE_MV, DataFormatCruTYPE_MV, "", 0);
+		LkFutureSetCallback(future, OnRead, NULL);
+		---
+*/
+DllEntry void LkFutureSetCallback(LkFuture* future, LkFutureCallback callback, void* userData)
+{
+	LkMutexLock(&future->mutex);
+	if(future->state >= LkFuture_DONE)
+	{
+		CallCallback(future, callback, userData);
+		return;
+	}
+
+	future->callback = callback;
+	future->userData = userData;
+	LkMutexUnlock(&future->mutex);
+}
+
+/*
+	Function: LkFutureGetResult
+		Waits until a future finishes, and takes its result and its error. The caller owns them, so the next calls return NULL.
+
+	Arguments:
+		future - The future returned by an asynchronous function.
+		error - Output argument with the system or communication errors with LinkarSERVER, or NULL if there are no errors. It is also NULL if the future was cancelled.
+
+	Returns:
+		The result of the operation, or NULL if the future was cancelled.
+
+	Also See:
+		<Release Memory>
+*/
+DllEntry char* LkFutureGetResult(LkFuture* future, char** error)
+{
+	LkFutureWaitFor(future, LkFuture_INFINITE);
+
+	LkMutexLock(&future->mutex);
+	char* result = future->result;
+	*error = future->error;
+	future->result = NULL;
+	future->error = NULL;
+	LkMutexUnlock(&future->mutex);
+
+	return result;
+}
+
+/*
+	Function: LkFutureDestroy
+		Releases a future. If it has not started yet, it is cancelled. If it is running, it is released when it finishes, without waiting for it.
+		Its callback is not called anymore, and if it is running in another thread, this function waits until it returns, so its userData can be released next.
+		It can be called from the callback. The result and the error that were not taken with <LkFutureGetResult> are released too.
+
+	Arguments:
+		future - The future returned by an asynchronous function.
+
+	Also See:
+		<Release Memory>
+*/
+DllEntry void LkFutureDestroy(LkFuture* future)
+{
+	if(future == NULL)
+		return;
+
+	LkMutexLock(&future->mutex);
+	future->destroyed = TRUE;
+	future->callback = NULL;
+	if(future->state == LkFuture_PENDING)
+		future->state = LkFuture_CANCELLED;
+	LkCondBroadcast(&future->finished);
+	if(!future->inCallback || !LkThreadEqual(future->callbackThread, LkThreadSelf()))
+	{
+		while(future->inCallback)
+			LkCondWait(&future->finished, &future->mutex);
+	}
+	LkMutexUnlock(&future->mutex);
+
+	ReleaseFuture(future);
+}
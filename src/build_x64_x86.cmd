@@ -40,13 +40,21 @@ rem Linkar.Strings Static Library
 echo.
 echo *** Linkar.Strings Static Library
 CL %COMPILER_OPTIONS_STATIC_LIB% LinkarStrings.c /Fo"LinkarStrings_st.obj"
-LIB %BIN_DIR_LIB%Linkar.lib LinkarStrings_st.obj /OUT:%BIN_DIR_LIB%Linkar.Strings.lib
+CL %COMPILER_OPTIONS_STATIC_LIB% LinkarScan.c /Fo"LinkarScan_st.obj"
+CL %COMPILER_OPTIONS_STATIC_LIB% LinkarMemory.c /Fo"LinkarMemory_st.obj"
+CL %COMPILER_OPTIONS_STATIC_LIB% LinkarThreadPool.c /Fo"LinkarThreadPool_st.obj"
+CL %COMPILER_OPTIONS_STATIC_LIB% LinkarFile.c /Fo"LinkarFile_st.obj"
+LIB %BIN_DIR_LIB%Linkar.lib LinkarStrings_st.obj LinkarScan_st.obj LinkarMemory_st.obj LinkarThreadPool_st.obj LinkarFile_st.obj /OUT:%BIN_DIR_LIB%Linkar.Strings.lib
 
 rem Linkar.Strings Dynamic Library
 echo.
 echo *** Linkar.Strings Dynamic Library
 CL %COMPILER_OPTIONS_DYNAMIC_LIB% LinkarStrings.c /Fo"LinkarStrings_dy.obj"
-LINK /DLL /MAP %BIN_DIR_DLL%Linkar.lib LinkarStrings_dy.obj /OUT:%BIN_DIR_DLL%Linkar.Strings.dll
+CL %COMPILER_OPTIONS_DYNAMIC_LIB% LinkarScan.c /Fo"LinkarScan_dy.obj"
+CL %COMPILER_OPTIONS_DYNAMIC_LIB% LinkarMemory.c /Fo"LinkarMemory_dy.obj"
+CL %COMPILER_OPTIONS_DYNAMIC_LIB% LinkarThreadPool.c /Fo"LinkarThreadPool_dy.obj"
+CL %COMPILER_OPTIONS_DYNAMIC_LIB% LinkarFile.c /Fo"LinkarFile_dy.obj"
+LINK /DLL /MAP %BIN_DIR_DLL%Linkar.lib LinkarStrings_dy.obj LinkarScan_dy.obj LinkarMemory_dy.obj LinkarThreadPool_dy.obj LinkarFile_dy.obj /OUT:%BIN_DIR_DLL%Linkar.Strings.dll
 
 del %BIN_DIR_DLL%Linkar.Strings.map
 del %BIN_DIR_DLL%Linkar.Strings.exp
@@ -61,17 +69,19 @@ rem Linkar.Functions Static Library
 echo.
 echo *** Linkar.Functions Static Library
 CL %COMPILER_OPTIONS_STATIC_LIB% MvOperations.c /Fo"MvOperations_st.obj"
+CL %COMPILER_OPTIONS_STATIC_LIB% MvDynArray.c /Fo"MvDynArray_st.obj"
 CL %COMPILER_OPTIONS_STATIC_LIB% OperationOptions.c /Fo"OperationOptions_st.obj"
 CL %COMPILER_OPTIONS_STATIC_LIB% OperationArguments.c /Fo"OperationArguments_st.obj"
-LIB MvOperations_st.obj OperationOptions_st.obj OperationArguments_st.obj /OUT:%BIN_DIR_LIB%Linkar.Functions.lib
+LIB %BIN_DIR_LIB%Linkar.Strings.lib MvOperations_st.obj MvDynArray_st.obj OperationOptions_st.obj OperationArguments_st.obj /OUT:%BIN_DIR_LIB%Linkar.Functions.lib
 
 rem Linkar.Functions Dynamic Library
 echo.
 echo *** Linkar.Functions Dynamic Library
 CL %COMPILER_OPTIONS_DYNAMIC_LIB% MvOperations.c /Fo"MvOperations_dy.obj"
+CL %COMPILER_OPTIONS_DYNAMIC_LIB% MvDynArray.c /Fo"MvDynArray_dy.obj"
 CL %COMPILER_OPTIONS_DYNAMIC_LIB% OperationOptions.c /Fo"OperationOptions_dy.obj"
 CL %COMPILER_OPTIONS_DYNAMIC_LIB% OperationArguments.c /Fo"OperationArguments_dy.obj"
-LINK /DLL /MAP %BIN_DIR_DLL%Linkar.lib MvOperations_dy.obj OperationOptions_dy.obj OperationArguments_dy.obj /OUT:%BIN_DIR_DLL%Linkar.Functions.dll
+LINK /DLL /MAP %BIN_DIR_DLL%Linkar.lib %BIN_DIR_DLL%Linkar.Strings.lib MvOperations_dy.obj MvDynArray_dy.obj OperationOptions_dy.obj OperationArguments_dy.obj /OUT:%BIN_DIR_DLL%Linkar.Functions.dll
 
 del %BIN_DIR_DLL%Linkar.Functions.map
 del %BIN_DIR_DLL%Linkar.Functions.exp
@@ -92,7 +102,7 @@ rem Linkar.Functions.Direct Dynamic Library
 echo.
 echo *** Linkar.Functions.Direct Dynamic Library
 CL %COMPILER_OPTIONS_DYNAMIC_LIB% FunctionsDirect.c /Fo"DirectFunctions_dy.obj"
-LINK /DLL /MAP %BIN_DIR_DLL%Linkar.lib %BIN_DIR_DLL%Linkar.Functions.lib DirectFunctions_dy.obj /OUT:%BIN_DIR_DLL%Linkar.Functions.Direct.dll
+LINK /DLL /MAP %BIN_DIR_DLL%Linkar.lib %BIN_DIR_DLL%Linkar.Strings.lib %BIN_DIR_DLL%Linkar.Functions.lib DirectFunctions_dy.obj /OUT:%BIN_DIR_DLL%Linkar.Functions.Direct.dll
 
 del %BIN_DIR_DLL%Linkar.Functions.Direct.map
 del %BIN_DIR_DLL%Linkar.Functions.Direct.exp
@@ -192,14 +202,14 @@ echo.
 echo *** Linkar.Commands.Direct Static Library
 CL /I..\..\includes\Linkar.Commands %COMPILER_OPTIONS_STATIC_LIB% OperationArguments.c /Fo"OperationArguments_st.obj"
 CL /I..\..\includes\Linkar.Commands %COMPILER_OPTIONS_STATIC_LIB% CommandsDirect.c /Fo"DirectCommands_st.obj"
-LIB %BIN_DIR_LIB%Linkar.lib OperationArguments_st.obj DirectCommands_st.obj /OUT:%BIN_DIR_LIB%Linkar.Commands.Direct.lib
+LIB %BIN_DIR_LIB%Linkar.lib %BIN_DIR_LIB%Linkar.Strings.lib OperationArguments_st.obj DirectCommands_st.obj /OUT:%BIN_DIR_LIB%Linkar.Commands.Direct.lib
 
 rem Linkar.Commands.Direct Dynamic Library
 echo.
 echo *** Linkar.Commands.Direct Dynamic Library
 CL /I..\..\includes\Linkar.Commands %COMPILER_OPTIONS_DYNAMIC_LIB% OperationArguments.c /Fo"OperationArguments_dy.obj"
 CL /I..\..\includes\Linkar.Commands %COMPILER_OPTIONS_DYNAMIC_LIB% CommandsDirect.c /Fo"DirectCommands_dy.obj"
-LINK /DLL /MAP %BIN_DIR_DLL%Linkar.lib OperationArguments_dy.obj DirectCommands_dy.obj /OUT:%BIN_DIR_DLL%Linkar.Commands.Direct.dll
+LINK /DLL /MAP %BIN_DIR_DLL%Linkar.lib %BIN_DIR_DLL%Linkar.Strings.lib OperationArguments_dy.obj DirectCommands_dy.obj /OUT:%BIN_DIR_DLL%Linkar.Commands.Direct.dll
 
 del %BIN_DIR_DLL%Linkar.Commands.Direct.map
 del %BIN_DIR_DLL%Linkar.Commands.Direct.exp
@@ -220,7 +230,7 @@ rem Linkar.Functions.Persistent Dynamic Library
 echo.
 echo *** Linkar.Functions.Persistent Dynamic Library
 CL %COMPILER_OPTIONS_DYNAMIC_LIB% FunctionsPersistent.c /Fo"PersistentFunctions_dy.obj"
-LINK /DLL /MAP %BIN_DIR_DLL%Linkar.lib %BIN_DIR_DLL%Linkar.Functions.lib PersistentFunctions_dy.obj /OUT:%BIN_DIR_DLL%Linkar.Functions.Persistent.dll
+LINK /DLL /MAP %BIN_DIR_DLL%Linkar.lib %BIN_DIR_DLL%Linkar.Strings.lib %BIN_DIR_DLL%Linkar.Functions.lib PersistentFunctions_dy.obj /OUT:%BIN_DIR_DLL%Linkar.Functions.Persistent.dll
 
 del %BIN_DIR_DLL%Linkar.Functions.Persistent.map
 del %BIN_DIR_DLL%Linkar.Functions.Persistent.exp
@@ -320,14 +330,14 @@ echo.
 echo *** Linkar.Commands.Persistent Static Library
 CL /I..\..\includes\Linkar.Commands %COMPILER_OPTIONS_STATIC_LIB% OperationArguments.c /Fo"OperationArguments_st.obj"
 CL /I..\..\includes\Linkar.Commands %COMPILER_OPTIONS_STATIC_LIB% CommandsPersistent.c /Fo"PersistentCommands_st.obj"
-LIB %BIN_DIR_LIB%Linkar.lib OperationArguments_st.obj PersistentCommands_st.obj /OUT:%BIN_DIR_LIB%Linkar.Commands.Persistent.lib
+LIB %BIN_DIR_LIB%Linkar.lib %BIN_DIR_LIB%Linkar.Strings.lib OperationArguments_st.obj PersistentCommands_st.obj /OUT:%BIN_DIR_LIB%Linkar.Commands.Persistent.lib
 
 rem Linkar.Commands.Persistent Dynamic Library
 echo.
 echo *** Linkar.Commands.Persistent Dynamic Library
 CL /I..\..\includes\Linkar.Commands %COMPILER_OPTIONS_DYNAMIC_LIB% OperationArguments.c /Fo"OperationArguments_dy.obj"
 CL /I..\..\includes\Linkar.Commands %COMPILER_OPTIONS_DYNAMIC_LIB% CommandsPersistent.c /Fo"PersistentCommands_dy.obj"
-LINK /DLL /MAP %BIN_DIR_DLL%Linkar.lib OperationArguments_dy.obj PersistentCommands_dy.obj /OUT:%BIN_DIR_DLL%Linkar.Commands.Persistent.dll
+LINK /DLL /MAP %BIN_DIR_DLL%Linkar.lib %BIN_DIR_DLL%Linkar.Strings.lib OperationArguments_dy.obj PersistentCommands_dy.obj /OUT:%BIN_DIR_DLL%Linkar.Commands.Persistent.dll
 
 del %BIN_DIR_DLL%Linkar.Commands.Persistent.map
 del %BIN_DIR_DLL%Linkar.Commands.Persistent.exp
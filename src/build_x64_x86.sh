@@ -42,34 +42,50 @@ cd Linkar.Strings
 
 echo "Compiling x64 Static LinkarStrings.c"
 cc $COMPILER_OPTIONS_STATIC_LIB_x64 -o LinkarStrings.o LinkarStrings.c
-ar rcs $BIN_DIR_A_x64/libLinkar.Strings.a LinkarStrings.o 
-ar rcs $BIN_DIR_A_x64/libLinkar.Functions.a LinkarStrings.o 
-ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Direct.a LinkarStrings.o 
-ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Direct.MV.a LinkarStrings.o 
-ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Direct.JSON.a LinkarStrings.o 
-ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Direct.XML.a LinkarStrings.o 
-ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Direct.TABLE.a LinkarStrings.o 
-ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Persistent.a LinkarStrings.o 
-ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Persistent.MV.a LinkarStrings.o 
-ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Persistent.JSON.a LinkarStrings.o 
-ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Persistent.XML.a LinkarStrings.o 
-ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Persistent.TABLE.a LinkarStrings.o 
+echo "Compiling x64 Static LinkarScan.c"
+cc $COMPILER_OPTIONS_STATIC_LIB_x64 -o LinkarScan.o LinkarScan.c
+echo "Compiling x64 Static LinkarMemory.c"
+cc $COMPILER_OPTIONS_STATIC_LIB_x64 -o LinkarMemory.o LinkarMemory.c
+echo "Compiling x64 Static LinkarThreadPool.c"
+cc $COMPILER_OPTIONS_STATIC_LIB_x64 -o LinkarThreadPool.o LinkarThreadPool.c
+echo "Compiling x64 Static LinkarFile.c"
+cc $COMPILER_OPTIONS_STATIC_LIB_x64 -o LinkarFile.o LinkarFile.c
+ar rcs $BIN_DIR_A_x64/libLinkar.Strings.a LinkarStrings.o LinkarScan.o LinkarMemory.o LinkarThreadPool.o LinkarFile.o
+ar rcs $BIN_DIR_A_x64/libLinkar.Functions.a LinkarStrings.o LinkarScan.o LinkarMemory.o LinkarThreadPool.o LinkarFile.o
+ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Direct.a LinkarStrings.o LinkarScan.o LinkarMemory.o LinkarThreadPool.o LinkarFile.o
+ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Direct.MV.a LinkarStrings.o LinkarScan.o LinkarMemory.o LinkarThreadPool.o LinkarFile.o
+ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Direct.JSON.a LinkarStrings.o LinkarScan.o LinkarMemory.o LinkarThreadPool.o LinkarFile.o
+ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Direct.XML.a LinkarStrings.o LinkarScan.o LinkarMemory.o LinkarThreadPool.o LinkarFile.o
+ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Direct.TABLE.a LinkarStrings.o LinkarScan.o LinkarMemory.o LinkarThreadPool.o LinkarFile.o
+ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Persistent.a LinkarStrings.o LinkarScan.o LinkarMemory.o LinkarThreadPool.o LinkarFile.o
+ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Persistent.MV.a LinkarStrings.o LinkarScan.o LinkarMemory.o LinkarThreadPool.o LinkarFile.o
+ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Persistent.JSON.a LinkarStrings.o LinkarScan.o LinkarMemory.o LinkarThreadPool.o LinkarFile.o
+ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Persistent.XML.a LinkarStrings.o LinkarScan.o LinkarMemory.o LinkarThreadPool.o LinkarFile.o
+ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Persistent.TABLE.a LinkarStrings.o LinkarScan.o LinkarMemory.o LinkarThreadPool.o LinkarFile.o
 
 echo ""
 echo "Compiling x86 Static LinkarStrings.c"
 gcc $COMPILER_OPTIONS_STATIC_LIB_x86 -o LinkarStrings.o LinkarStrings.c
-ar rcs $BIN_DIR_A_x86/libLinkar.Strings.a LinkarStrings.o 
-ar rcs $BIN_DIR_A_x86/libLinkar.Functions.a LinkarStrings.o 
-ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Direct.a LinkarStrings.o 
-ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Direct.MV.a LinkarStrings.o 
-ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Direct.JSON.a LinkarStrings.o 
-ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Direct.XML.a LinkarStrings.o 
-ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Direct.TABLE.a LinkarStrings.o 
-ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Persistent.a LinkarStrings.o 
-ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Persistent.MV.a LinkarStrings.o 
-ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Persistent.JSON.a LinkarStrings.o 
-ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Persistent.XML.a LinkarStrings.o 
-ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Persistent.TABLE.a LinkarStrings.o 
+echo "Compiling x86 Static LinkarScan.c"
+gcc $COMPILER_OPTIONS_STATIC_LIB_x86 -o LinkarScan.o LinkarScan.c
+echo "Compiling x86 Static LinkarMemory.c"
+gcc $COMPILER_OPTIONS_STATIC_LIB_x86 -o LinkarMemory.o LinkarMemory.c
+echo "Compiling x86 Static LinkarThreadPool.c"
+gcc $COMPILER_OPTIONS_STATIC_LIB_x86 -o LinkarThreadPool.o LinkarThreadPool.c
+echo "Compiling x86 Static LinkarFile.c"
+gcc $COMPILER_OPTIONS_STATIC_LIB_x86 -o LinkarFile.o LinkarFile.c
+ar rcs $BIN_DIR_A_x86/libLinkar.Strings.a LinkarStrings.o LinkarScan.o LinkarMemory.o LinkarThreadPool.o LinkarFile.o
+ar rcs $BIN_DIR_A_x86/libLinkar.Functions.a LinkarStrings.o LinkarScan.o LinkarMemory.o LinkarThreadPool.o LinkarFile.o
+ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Direct.a LinkarStrings.o LinkarScan.o LinkarMemory.o LinkarThreadPool.o LinkarFile.o
+ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Direct.MV.a LinkarStrings.o LinkarScan.o LinkarMemory.o LinkarThreadPool.o LinkarFile.o
+ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Direct.JSON.a LinkarStrings.o LinkarScan.o LinkarMemory.o LinkarThreadPool.o LinkarFile.o
+ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Direct.XML.a LinkarStrings.o LinkarScan.o LinkarMemory.o LinkarThreadPool.o LinkarFile.o
+ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Direct.TABLE.a LinkarStrings.o LinkarScan.o LinkarMemory.o LinkarThreadPool.o LinkarFile.o
+ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Persistent.a LinkarStrings.o LinkarScan.o LinkarMemory.o LinkarThreadPool.o LinkarFile.o
+ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Persistent.MV.a LinkarStrings.o LinkarScan.o LinkarMemory.o LinkarThreadPool.o LinkarFile.o
+ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Persistent.JSON.a LinkarStrings.o LinkarScan.o LinkarMemory.o LinkarThreadPool.o LinkarFile.o
+ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Persistent.XML.a LinkarStrings.o LinkarScan.o LinkarMemory.o LinkarThreadPool.o LinkarFile.o
+ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Persistent.TABLE.a LinkarStrings.o LinkarScan.o LinkarMemory.o LinkarThreadPool.o LinkarFile.o
 
 echo ""
 cd ..
@@ -84,42 +100,46 @@ cd Linkar.Functions
 
 echo "Compiling x64 Static Functions (MvOperations.c)"
 gcc $COMPILER_OPTIONS_STATIC_LIB_x64 -o MvOperations.o MvOperations.c
+echo "Compiling x64 Static Functions (MvDynArray.c)"
+gcc $COMPILER_OPTIONS_STATIC_LIB_x64 -o MvDynArray.o MvDynArray.c
 echo "Compiling x64 Static Functions (OperationOptions.c)"
 gcc $COMPILER_OPTIONS_STATIC_LIB_x64 -o OperationOptions.o OperationOptions.c
 echo "Compiling x64 Static Functions (OperationArguments.c)"
 gcc $COMPILER_OPTIONS_STATIC_LIB_x64 -o OperationArguments.o OperationArguments.c
 
-ar rcs $BIN_DIR_A_x64/libLinkar.Functions.a MvOperations.o OperationOptions.o OperationArguments.o
-ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Direct.a MvOperations.o OperationOptions.o OperationArguments.o
-ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Direct.MV.a MvOperations.o OperationOptions.o OperationArguments.o
-ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Direct.JSON.a MvOperations.o OperationOptions.o OperationArguments.o
-ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Direct.XML.a MvOperations.o OperationOptions.o OperationArguments.o
-ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Direct.TABLE.a MvOperations.o OperationOptions.o OperationArguments.o
-ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Persistent.a MvOperations.o OperationOptions.o OperationArguments.o
-ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Persistent.MV.a MvOperations.o OperationOptions.o OperationArguments.o
-ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Persistent.JSON.a MvOperations.o OperationOptions.o OperationArguments.o
-ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Persistent.XML.a MvOperations.o OperationOptions.o OperationArguments.o
-ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Persistent.TABLE.a MvOperations.o OperationOptions.o OperationArguments.o
+ar rcs $BIN_DIR_A_x64/libLinkar.Functions.a MvOperations.o MvDynArray.o OperationOptions.o OperationArguments.o
+ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Direct.a MvOperations.o MvDynArray.o OperationOptions.o OperationArguments.o
+ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Direct.MV.a MvOperations.o MvDynArray.o OperationOptions.o OperationArguments.o
+ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Direct.JSON.a MvOperations.o MvDynArray.o OperationOptions.o OperationArguments.o
+ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Direct.XML.a MvOperations.o MvDynArray.o OperationOptions.o OperationArguments.o
+ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Direct.TABLE.a MvOperations.o MvDynArray.o OperationOptions.o OperationArguments.o
+ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Persistent.a MvOperations.o MvDynArray.o OperationOptions.o OperationArguments.o
+ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Persistent.MV.a MvOperations.o MvDynArray.o OperationOptions.o OperationArguments.o
+ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Persistent.JSON.a MvOperations.o MvDynArray.o OperationOptions.o OperationArguments.o
+ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Persistent.XML.a MvOperations.o MvDynArray.o OperationOptions.o OperationArguments.o
+ar rcs $BIN_DIR_A_x64/libLinkar.Functions.Persistent.TABLE.a MvOperations.o MvDynArray.o OperationOptions.o OperationArguments.o
 
 echo ""
 echo "Compiling x86 Static Functions (MvOperations.c)"
 gcc $COMPILER_OPTIONS_STATIC_LIB_x86 -o MvOperations.o MvOperations.c
+echo "Compiling x86 Static Functions (MvDynArray.c)"
+gcc $COMPILER_OPTIONS_STATIC_LIB_x86 -o MvDynArray.o MvDynArray.c
 echo "Compiling x86 Static Functions (OperationOptions.c)"
 gcc $COMPILER_OPTIONS_STATIC_LIB_x86 -o OperationOptions.o OperationOptions.c
 echo "Compiling x86 Static Functions (OperationArguments.c)"
 gcc $COMPILER_OPTIONS_STATIC_LIB_x86 -o OperationArguments.o OperationArguments.c
 
-ar rcs $BIN_DIR_A_x86/libLinkar.Functions.a MvOperations.o OperationOptions.o OperationArguments.o
-ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Direct.a MvOperations.o OperationOptions.o OperationArguments.o
-ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Direct.MV.a MvOperations.o OperationOptions.o OperationArguments.o
-ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Direct.JSON.a MvOperations.o OperationOptions.o OperationArguments.o
-ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Direct.XML.a MvOperations.o OperationOptions.o OperationArguments.o
-ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Direct.TABLE.a MvOperations.o OperationOptions.o OperationArguments.o
-ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Persistent.a MvOperations.o OperationOptions.o OperationArguments.o
-ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Persistent.MV.a MvOperations.o OperationOptions.o OperationArguments.o
-ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Persistent.JSON.a MvOperations.o OperationOptions.o OperationArguments.o
-ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Persistent.XML.a MvOperations.o OperationOptions.o OperationArguments.o
-ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Persistent.TABLE.a MvOperations.o OperationOptions.o OperationArguments.o
+ar rcs $BIN_DIR_A_x86/libLinkar.Functions.a MvOperations.o MvDynArray.o OperationOptions.o OperationArguments.o
+ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Direct.a MvOperations.o MvDynArray.o OperationOptions.o OperationArguments.o
+ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Direct.MV.a MvOperations.o MvDynArray.o OperationOptions.o OperationArguments.o
+ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Direct.JSON.a MvOperations.o MvDynArray.o OperationOptions.o OperationArguments.o
+ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Direct.XML.a MvOperations.o MvDynArray.o OperationOptions.o OperationArguments.o
+ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Direct.TABLE.a MvOperations.o MvDynArray.o OperationOptions.o OperationArguments.o
+ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Persistent.a MvOperations.o MvDynArray.o OperationOptions.o OperationArguments.o
+ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Persistent.MV.a MvOperations.o MvDynArray.o OperationOptions.o OperationArguments.o
+ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Persistent.JSON.a MvOperations.o MvDynArray.o OperationOptions.o OperationArguments.o
+ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Persistent.XML.a MvOperations.o MvDynArray.o OperationOptions.o OperationArguments.o
+ar rcs $BIN_DIR_A_x86/libLinkar.Functions.Persistent.TABLE.a MvOperations.o MvDynArray.o OperationOptions.o OperationArguments.o
 
 echo ""
 cd ..
@@ -242,14 +262,16 @@ cd Linkar.Commands
 
 echo "Compiling x64 Static CommandsDirect.c"
 gcc $COMPILER_OPTIONS_STATIC_LIB_x64 -o OperationArguments.o OperationArguments.c
+gcc $COMPILER_OPTIONS_STATIC_LIB_x64 -o LinkarMemory.o ../Linkar.Strings/LinkarMemory.c
 gcc -I../../includes/Linkar.Commands $COMPILER_OPTIONS_STATIC_LIB_x64 -o CommandsDirect.o CommandsDirect.c
-ar rcs $BIN_DIR_A_x64/libLinkar.Commands.Direct.a OperationArguments.o CommandsDirect.o
+ar rcs $BIN_DIR_A_x64/libLinkar.Commands.Direct.a OperationArguments.o LinkarMemory.o CommandsDirect.o
 
 echo ""
 echo "Compiling x86 Static CommandsDirect.c"
 gcc $COMPILER_OPTIONS_STATIC_LIB_x86 -o OperationArguments.o OperationArguments.c
+gcc $COMPILER_OPTIONS_STATIC_LIB_x86 -o LinkarMemory.o ../Linkar.Strings/LinkarMemory.c
 gcc -I../../includes/Linkar.Commands $COMPILER_OPTIONS_STATIC_LIB_x86 -o CommandsDirect.o CommandsDirect.c
-ar rcs $BIN_DIR_A_x86/libLinkar.Commands.Direct.a OperationArguments.o CommandsDirect.o
+ar rcs $BIN_DIR_A_x86/libLinkar.Commands.Direct.a OperationArguments.o LinkarMemory.o CommandsDirect.o
 
 echo ""
 cd ..
@@ -372,14 +394,16 @@ cd Linkar.Commands
 
 echo "Building x64 Static CommandsPersistent.c"
 gcc $COMPILER_OPTIONS_STATIC_LIB_x64 -o OperationArguments.o OperationArguments.c
+gcc $COMPILER_OPTIONS_STATIC_LIB_x64 -o LinkarMemory.o ../Linkar.Strings/LinkarMemory.c
 gcc -I../../includes/Linkar.Commands $COMPILER_OPTIONS_STATIC_LIB_x64 -o CommandsPersistent.o CommandsPersistent.c
-ar rcs $BIN_DIR_A_x64/libLinkar.Commands.Persistent.a OperationArguments.o CommandsPersistent.o
+ar rcs $BIN_DIR_A_x64/libLinkar.Commands.Persistent.a OperationArguments.o LinkarMemory.o CommandsPersistent.o
 
 echo ""
 echo "Building x86 Static CommandsPersistent.c"
 gcc $COMPILER_OPTIONS_STATIC_LIB_x86 -o OperationArguments.o OperationArguments.c
+gcc $COMPILER_OPTIONS_STATIC_LIB_x86 -o LinkarMemory.o ../Linkar.Strings/LinkarMemory.c
 gcc -I../../includes/Linkar.Commands $COMPILER_OPTIONS_STATIC_LIB_x86 -o CommandsPersistent.o CommandsPersistent.c
-ar rcs $BIN_DIR_A_x86/libLinkar.Commands.Persistent.a OperationArguments.o CommandsPersistent.o
+ar rcs $BIN_DIR_A_x86/libLinkar.Commands.Persistent.a OperationArguments.o LinkarMemory.o CommandsPersistent.o
 
 echo ""
 cd ..
@@ -406,14 +430,18 @@ cd Linkar.Strings
 #Linkar.Strings Dynamic Libraries
 echo "Building x64 Dynamic Library: libLinkar.Strings.so"
 gcc -c $COMPILER_OPTIONS_DYNAMIC_LIB_x64 -o LinkarStrings.o -O -g LinkarStrings.c
-gcc -shared $COMPILER_OPTIONS_DYNAMIC_LIB_x64 -o $BIN_DIR_SO_x64/libLinkar.Strings.so LinkarStrings.o -L$BIN_DIR_SO_x64 -lLinkar
+gcc -c $COMPILER_OPTIONS_DYNAMIC_LIB_x64 -o LinkarScan.o -O -g LinkarScan.c
+gcc -c $COMPILER_OPTIONS_DYNAMIC_LIB_x64 -o LinkarMemory.o -O -g LinkarMemory.c
+gcc -c $COMPILER_OPTIONS_DYNAMIC_LIB_x64 -o LinkarThreadPool.o -O -g LinkarThreadPool.c
+gcc -c $COMPILER_OPTIONS_DYNAMIC_LIB_x64 -o LinkarFile.o -O -g LinkarFile.c
+gcc -shared $COMPILER_OPTIONS_DYNAMIC_LIB_x64 -o $BIN_DIR_SO_x64/libLinkar.Strings.so LinkarStrings.o LinkarScan.o LinkarMemory.o LinkarThreadPool.o LinkarFile.o -L$BIN_DIR_SO_x64 -lLinkar -lpthread
 if [ ! -z "${LIB_DIR_SO_x64}" ] ; then
 	ln -srf $BIN_DIR_SO_x64/libLinkar.Strings.so $LIB_DIR_SO_x64/libLinkar.Strings.so
 fi
 
 echo ""
 echo "Building x86 Dynamic Library: libLinkar.Strings.so"
-gcc -shared $COMPILER_OPTIONS_DYNAMIC_LIB_x86 -o $BIN_DIR_SO_x86/libLinkar.Strings.so LinkarStrings.c -L$BIN_DIR_SO_x86 -lLinkar
+gcc -shared $COMPILER_OPTIONS_DYNAMIC_LIB_x86 -o $BIN_DIR_SO_x86/libLinkar.Strings.so LinkarStrings.c LinkarScan.c LinkarMemory.c LinkarThreadPool.c LinkarFile.c -L$BIN_DIR_SO_x86 -lLinkar -lpthread
 if [ ! -z "${LIB_DIR_SO_x86}" ] ; then
 	ln -srf $BIN_DIR_SO_x86/libLinkar.Strings.so $LIB_DIR_SO_x86/libLinkar.Strings.so
 fi
@@ -431,13 +459,15 @@ cd Linkar.Functions
 
 echo "Compiling x64 Dynamic MvOperations.c"
 gcc -c $COMPILER_OPTIONS_DYNAMIC_LIB_x64 -o MvOperations.o -O -g MvOperations.c
+echo "Compiling x64 Dynamic MvDynArray.c"
+gcc -c $COMPILER_OPTIONS_DYNAMIC_LIB_x64 -o MvDynArray.o -O -g MvDynArray.c
 echo "Compiling x64 Dynamic OperationOptions.c"
 gcc -c $COMPILER_OPTIONS_DYNAMIC_LIB_x64 -o OperationOptions.o -O -g OperationOptions.c
 echo "Compiling x64 Dynamic OperationArguments.c"
 gcc -c $COMPILER_OPTIONS_DYNAMIC_LIB_x64 -o OperationArguments.o -O -g OperationArguments.c
 
 echo "Building x64 Dynamic Library: libLinkar.Functions.so"
-gcc -shared $COMPILER_OPTIONS_DYNAMIC_LIB_x64 -o $BIN_DIR_SO_x64/libLinkar.Functions.so MvOperations.o OperationOptions.o OperationArguments.o -L$BIN_DIR_SO_x64 -lLinkar -lLinkar.Strings
+gcc -shared $COMPILER_OPTIONS_DYNAMIC_LIB_x64 -o $BIN_DIR_SO_x64/libLinkar.Functions.so MvOperations.o MvDynArray.o OperationOptions.o OperationArguments.o -L$BIN_DIR_SO_x64 -lLinkar -lLinkar.Strings
 if [ ! -z "${LIB_DIR_SO_x64}" ] ; then
 	ln -srf $BIN_DIR_SO_x64/libLinkar.Functions.so $LIB_DIR_SO_x64/libLinkar.Functions.so
 fi
@@ -445,13 +475,15 @@ fi
 echo ""
 echo "Compiling x86 Dynamic MvOperations.c"
 gcc -c $COMPILER_OPTIONS_DYNAMIC_LIB_x86 -o MvOperations.o -O -g MvOperations.c
+echo "Compiling x86 Dynamic MvDynArray.c"
+gcc -c $COMPILER_OPTIONS_DYNAMIC_LIB_x86 -o MvDynArray.o -O -g MvDynArray.c
 echo "Compiling x86 Dynamic OperationOptions.c"
 gcc -c $COMPILER_OPTIONS_DYNAMIC_LIB_x86 -o OperationOptions.o -O -g OperationOptions.c
 echo "Compiling x86 Dynamic OperationArguments.c"
 gcc -c $COMPILER_OPTIONS_DYNAMIC_LIB_x86 -o OperationArguments.o -O -g OperationArguments.c
 
 echo "Building x86 Dynamic Library: libLinkar.Functions.so"
-gcc -shared $COMPILER_OPTIONS_DYNAMIC_LIB_x86 -o $BIN_DIR_SO_x86/libLinkar.Functions.so MvOperations.o OperationOptions.o OperationArguments.o -L$BIN_DIR_SO_x86 -lLinkar -lLinkar.Strings
+gcc -shared $COMPILER_OPTIONS_DYNAMIC_LIB_x86 -o $BIN_DIR_SO_x86/libLinkar.Functions.so MvOperations.o MvDynArray.o OperationOptions.o OperationArguments.o -L$BIN_DIR_SO_x86 -lLinkar -lLinkar.Strings
 if [ ! -z "${LIB_DIR_SO_x86}" ] ; then
 	ln -srf $BIN_DIR_SO_x86/libLinkar.Functions.so $LIB_DIR_SO_x86/libLinkar.Functions.so
 fi